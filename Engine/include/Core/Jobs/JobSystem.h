@@ -0,0 +1,287 @@
+﻿#pragma once
+#include "Core/Jobs/WorkStealingQueue.h"
+#include "Core/Assert.h"
+#include "Core/Singleton.h"
+#include "Core/Types.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Core::Jobs
+{
+	/**
+	 * @brief Job 완료 대기용 카운터 (fence)
+	 *
+	 * Job을 제출할 때마다 증가하고 완료될 때마다 감소합니다.
+	 * JobSystem::Wait(counter)는 0이 될 때까지 다른 Job을 실행하며 기다립니다.
+	 */
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		// 연결된 모든 Job이 끝났는지 확인
+		bool IsDone() const { return mPending.load(std::memory_order_acquire) == 0; }
+
+	private:
+		friend class JobSystem;
+
+		std::atomic<uint32> mPending{ 0 };
+	};
+
+	/**
+	 * @brief 실행 단위 (캐시 라인 1개 크기)
+	 *
+	 * 호출 가능 객체는 storage에 인라인으로 복사되므로 힙 할당이 없습니다.
+	 */
+	struct alignas(64) Job
+	{
+		static constexpr size_t STORAGE_SIZE = 48;
+
+		void (*function)(Job& job) = nullptr;
+		JobCounter* counter = nullptr;
+		alignas(8) std::byte storage[STORAGE_SIZE];
+	};
+
+	/**
+	 * @brief Work-Stealing 스레드 풀
+	 *
+	 * 메인 스레드(인덱스 0)와 워커 스레드(1..N)가 각자 WorkStealingQueue를 가지고,
+	 * 자기 큐가 비면 다른 스레드의 큐에서 Job을 훔쳐 실행합니다.
+	 * Wait 중인 스레드도 Job을 실행하므로 중첩 ParallelFor가 교착되지 않습니다.
+	 *
+	 * 사용 예:
+	 * @code
+	 * Core::Jobs::JobSystem::Create();          // 워커 수 = 코어 수 - 1
+	 *
+	 * Core::Jobs::ParallelFor(count, 64, [&](uint32 i)
+	 *     {
+	 *         results[i] = Compute(inputs[i]);
+	 *     });
+	 *
+	 * Core::Jobs::JobSystem::Destroy();
+	 * @endcode
+	 *
+	 * @note Job 제출/대기는 메인 스레드와 워커 스레드에서만 가능
+	 * @warning 스레드당 동시에 살아 있는 Job은 MAX_JOBS_PER_THREAD개를 넘으면 안 됨
+	 *          (Job 슬롯을 링 버퍼로 재사용)
+	 */
+	class JobSystem : public Singleton<JobSystem>
+	{
+		friend class Singleton<JobSystem>;
+
+	public:
+		static constexpr uint32 MAX_JOBS_PER_THREAD = WorkStealingQueue::CAPACITY * 2;
+		static constexpr uint32 INVALID_THREAD_INDEX = UINT32_MAX;
+
+		/**
+		 * @brief 단일 Job 제출
+		 *
+		 * @param counter 완료 시 감소할 카운터
+		 * @param func void() 호출 가능 객체 (트리비얼 복사 가능, STORAGE_SIZE 이하)
+		 */
+		template<typename Func>
+		void Run(JobCounter& counter, Func&& func);
+
+		/**
+		 * @brief [0, count) 범위를 병렬 처리하고 완료까지 대기
+		 *
+		 * 범위를 절반씩 재귀 분할하여 grainSize 이하가 될 때까지 Job을 생성합니다.
+		 *
+		 * @param count 반복 횟수
+		 * @param grainSize Job 하나가 처리할 최소 반복 수
+		 * @param func void(uint32 index) 호출 가능 객체
+		 */
+		template<typename Func>
+		void ParallelFor(uint32 count, uint32 grainSize, Func&& func);
+
+		/**
+		 * @brief 카운터가 0이 될 때까지 대기 (대기 중 다른 Job 실행)
+		 */
+		void Wait(JobCounter& counter);
+
+		// 워커 스레드 수 (메인 스레드 제외)
+		uint32 GetWorkerCount() const { return static_cast<uint32>(mWorkers.size()); }
+
+		// Job을 실행할 수 있는 전체 스레드 수 (메인 포함)
+		uint32 GetThreadCount() const { return static_cast<uint32>(mContexts.size()); }
+
+		// 스레드별 실행한 Job 수 (통계용)
+		uint64 GetExecutedJobCount(uint32 threadIndex) const;
+
+		/**
+		 * @brief 현재 스레드 인덱스
+		 * @return 0 = 메인, 1..N = 워커, INVALID_THREAD_INDEX = JobSystem 외부 스레드
+		 */
+		static uint32 GetCurrentThreadIndex();
+
+	private:
+		/**
+		 * @brief 생성자 (Singleton::Create로만 생성)
+		 * @param workerCount 워커 스레드 수 (0이면 하드웨어 스레드 수 - 1)
+		 */
+		explicit JobSystem(uint32 workerCount = 0);
+		~JobSystem() override;
+
+		// 스레드별 큐와 Job 슬롯
+		struct ThreadContext
+		{
+			WorkStealingQueue queue;
+			std::array<Job, MAX_JOBS_PER_THREAD> jobPool;
+			uint32 nextJobIndex = 0;
+			std::atomic<uint64> executedJobCount{ 0 };
+		};
+
+		// ParallelFor 범위 Job 데이터
+		template<typename Func>
+		struct RangeData
+		{
+			const Func* func;
+			uint32 begin;
+			uint32 end;
+			uint32 grainSize;
+		};
+
+		template<typename Func>
+		static void RunRange(Job& job);
+
+		Job* AllocateJob();
+		void Submit(Job* job);
+		Job* FindJob(uint32 threadIndex);
+		void Execute(Job* job, uint32 threadIndex);
+		void WorkerLoop(uint32 threadIndex);
+
+		std::vector<std::unique_ptr<ThreadContext>> mContexts;    // [0] = 메인 스레드
+		std::vector<std::thread> mWorkers;
+
+		std::atomic<uint32> mQueuedJobs{ 0 };                     // 큐에 대기 중인 Job 수
+		std::atomic<uint32> mSleepingWorkers{ 0 };
+		std::atomic<bool> mShutdown{ false };
+		std::mutex mWakeMutex;
+		std::condition_variable mWakeCondition;
+	};
+
+	/**
+	 * @brief ParallelFor 편의 함수
+	 *
+	 * JobSystem이 생성되지 않았거나, 외부 스레드에서 호출되었거나,
+	 * count가 grainSize 이하이면 호출 스레드에서 직렬 실행합니다.
+	 */
+	template<typename Func>
+	void ParallelFor(uint32 count, uint32 grainSize, Func&& func)
+	{
+		if (JobSystem::IsValid() && count > grainSize && JobSystem::GetCurrentThreadIndex() != JobSystem::INVALID_THREAD_INDEX)
+		{
+			JobSystem::GetInstance().ParallelFor(count, grainSize, func);
+			return;
+		}
+
+		for (uint32 i = 0; i < count; ++i)
+		{
+			func(i);
+		}
+	}
+
+	// ============================================================================
+	// Template 구현부
+	// ============================================================================
+
+	template<typename Func>
+	void JobSystem::Run(JobCounter& counter, Func&& func)
+	{
+		using FuncType = std::decay_t<Func>;
+		static_assert(sizeof(FuncType) <= Job::STORAGE_SIZE, "Job capture is too large (capture by reference)");
+		static_assert(alignof(FuncType) <= 8, "Job capture is over-aligned");
+		static_assert(std::is_trivially_copyable_v<FuncType> && std::is_trivially_destructible_v<FuncType>,
+			"Job callable must be trivially copyable (capture by reference or pointer)");
+
+		Job* job = AllocateJob();
+		job->function = [](Job& self)
+			{
+				(*std::launder(reinterpret_cast<FuncType*>(self.storage)))();
+			};
+		job->counter = &counter;
+		new (job->storage) FuncType(std::forward<Func>(func));
+
+		counter.mPending.fetch_add(1, std::memory_order_relaxed);
+		Submit(job);
+	}
+
+	template<typename Func>
+	void JobSystem::ParallelFor(uint32 count, uint32 grainSize, Func&& func)
+	{
+		using FuncType = std::remove_reference_t<Func>;
+
+		if (count == 0)
+		{
+			return;
+		}
+
+		grainSize = std::max(grainSize, 1u);
+
+		// 외부 스레드에서는 큐가 없으므로 직렬 실행
+		const uint32 threadIndex = GetCurrentThreadIndex();
+		if (threadIndex == INVALID_THREAD_INDEX || count <= grainSize)
+		{
+			for (uint32 i = 0; i < count; ++i)
+			{
+				func(i);
+			}
+			return;
+		}
+
+		// 루트 범위를 호출 스레드에서 직접 실행 (분할된 절반은 큐로)
+		JobCounter counter;
+		Job* root = AllocateJob();
+		root->function = &RunRange<FuncType>;
+		root->counter = &counter;
+		new (root->storage) RangeData<FuncType>{ &func, 0, count, grainSize };
+
+		counter.mPending.store(1, std::memory_order_relaxed);
+		Execute(root, threadIndex);
+		Wait(counter);
+	}
+
+	template<typename Func>
+	void JobSystem::RunRange(Job& job)
+	{
+		static_assert(sizeof(RangeData<Func>) <= Job::STORAGE_SIZE, "RangeData does not fit in Job storage");
+
+		RangeData<Func> range = *std::launder(reinterpret_cast<const RangeData<Func>*>(job.storage));
+		JobSystem& system = GetInstance();
+
+		// grainSize 이하가 될 때까지 뒤쪽 절반을 분리해 제출
+		while (range.end - range.begin > range.grainSize)
+		{
+			const uint32 middle = range.begin + (range.end - range.begin) / 2;
+
+			Job* child = system.AllocateJob();
+			child->function = &RunRange<Func>;
+			child->counter = job.counter;
+			new (child->storage) RangeData<Func>{ range.func, middle, range.end, range.grainSize };
+
+			job.counter->mPending.fetch_add(1, std::memory_order_relaxed);
+			system.Submit(child);
+
+			range.end = middle;
+		}
+
+		for (uint32 i = range.begin; i < range.end; ++i)
+		{
+			(*range.func)(i);
+		}
+	}
+
+} // namespace Core::Jobs
@@ -0,0 +1,119 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include <array>
+#include <atomic>
+
+namespace Core::Jobs
+{
+	struct Job;
+
+	/**
+	 * @brief 고정 용량 Work-Stealing Deque (Chase-Lev)
+	 *
+	 * 소유 스레드는 bottom 쪽에서 Push/Pop(LIFO)하고,
+	 * 다른 스레드는 top 쪽에서 Steal(FIFO)합니다.
+	 * 락 없이 원자적 연산만 사용합니다.
+	 *
+	 * @note Push/Pop은 소유 스레드에서만, Steal은 모든 스레드에서 호출 가능
+	 */
+	class WorkStealingQueue
+	{
+	public:
+		static constexpr uint32 CAPACITY = 4096;    // 2의 거듭제곱
+		static constexpr uint32 MASK = CAPACITY - 1;
+
+		WorkStealingQueue() = default;
+
+		WorkStealingQueue(const WorkStealingQueue&) = delete;
+		WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+
+		/**
+		 * @brief Job 추가 (소유 스레드 전용)
+		 * @return 가득 차 있으면 false
+		 */
+		bool Push(Job* job)
+		{
+			const int64 bottom = mBottom.load(std::memory_order_relaxed);
+			const int64 top = mTop.load(std::memory_order_acquire);
+			if (bottom - top >= static_cast<int64>(CAPACITY))
+			{
+				return false;
+			}
+
+			mJobs[bottom & MASK].store(job, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			mBottom.store(bottom + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+		/**
+		 * @brief 가장 최근에 추가한 Job 꺼내기 (소유 스레드 전용)
+		 * @return 비어 있거나 마지막 Job을 도난당하면 nullptr
+		 */
+		Job* Pop()
+		{
+			const int64 bottom = mBottom.load(std::memory_order_relaxed) - 1;
+			mBottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64 top = mTop.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				// 비어 있음
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			Job* job = mJobs[bottom & MASK].load(std::memory_order_relaxed);
+			if (top == bottom)
+			{
+				// 마지막 하나: Steal과 경쟁
+				if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				{
+					job = nullptr;
+				}
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+
+			return job;
+		}
+
+		/**
+		 * @brief 가장 오래된 Job 훔치기 (모든 스레드)
+		 * @return 비어 있거나 경쟁에서 지면 nullptr
+		 */
+		Job* Steal()
+		{
+			int64 top = mTop.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const int64 bottom = mBottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+			{
+				return nullptr;
+			}
+
+			Job* job = mJobs[top & MASK].load(std::memory_order_relaxed);
+			if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				return nullptr;
+			}
+
+			return job;
+		}
+
+		// 대략적인 대기 Job 수 (통계용)
+		uint32 GetApproximateSize() const
+		{
+			const int64 size = mBottom.load(std::memory_order_relaxed) - mTop.load(std::memory_order_relaxed);
+			return size > 0 ? static_cast<uint32>(size) : 0;
+		}
+
+	private:
+		// top/bottom은 서로 다른 캐시 라인에 배치 (false sharing 방지)
+		alignas(64) std::atomic<int64> mTop{ 0 };
+		alignas(64) std::atomic<int64> mBottom{ 0 };
+		alignas(64) std::array<std::atomic<Job*>, CAPACITY> mJobs = {};
+	};
+
+} // namespace Core::Jobs
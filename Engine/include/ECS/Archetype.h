@@ -14,6 +14,7 @@ namespace ECS
 	struct DirectionalLightComponent;
 	struct PointLightComponent;
 	struct HierarchyComponent;
+	struct BoundsComponent;
 }
 
 namespace ECS
@@ -30,6 +31,7 @@ namespace ECS
 	 * @example
 	 * using MyArchetype = Archetype<TransformComponent, MeshComponent>;
 	 * auto view = MyArchetype::CreateView(registry);
+	 * auto group = MyArchetype::GetGroup(registry);
 	 */
 	template<typename... Components>
 	struct Archetype
@@ -48,6 +50,19 @@ namespace ECS
 		 */
 		static auto CreateView(Registry& registry);
 
+		/**
+		 * @brief Registry에서 이 Archetype의 그룹 조회 (없으면 생성)
+		 *
+		 * View와 달리 매칭 Entity의 Component들이 연속 메모리에 패킹되어 있어
+		 * HasComponent 검사 없이 순회합니다.
+		 *
+		 * @param registry ECS Registry
+		 * @return 이 Archetype의 ArchetypeGroup
+		 *
+		 * @warning 한 Component 저장소는 하나의 그룹만 소유 가능
+		 */
+		static auto GetGroup(Registry& registry);
+
 		/**
 		 * @brief 특정 인덱스의 Component 타입 가져오기 (컴파일 타임)
 		 *
@@ -131,6 +146,17 @@ namespace ECS
 		HierarchyComponent
 	>;
 
+	/**
+	 * @brief Transform + 경계 볼륨을 가진 Entity
+	 *
+	 * 컬링과 공간 질의 대상입니다.
+	 * TransformSystem이 World Matrix 변경 시 월드 경계를 갱신합니다.
+	 */
+	using BoundedArchetype = Archetype<
+		TransformComponent,
+		BoundsComponent
+	>;
+
 	// ========== Light Archetype 정의 ==========
 
 	/**
@@ -2,6 +2,7 @@
 // 이 파일은 Archetype.h 끝에서 include됩니다.
 
 #pragma once
+#include "ECS/ArchetypeGroup.h"
 #include "ECS/Registry.h"
 
 namespace ECS
@@ -12,4 +13,10 @@ namespace ECS
 		return registry.CreateView<Components...>();
 	}
 
+	template<typename... Components>
+	auto Archetype<Components...>::GetGroup(Registry& registry)
+	{
+		return registry.GetGroup<Components...>();
+	}
+
 } // namespace ECS
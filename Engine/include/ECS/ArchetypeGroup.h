@@ -0,0 +1,211 @@
+﻿#pragma once
+#include "ECS/Registry.h"
+#include "Core/Jobs/JobSystem.h"
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+namespace ECS
+{
+	/**
+	 * @brief Archetype 그룹 핸들
+	 *
+	 * 그룹에 속한 Entity의 Component들은 각 저장소 Dense 배열의 [0, size())
+	 * 구간에 같은 순서로 연속 배치되어 있습니다. 인덱스 i의 Component들은
+	 * 모두 같은 Entity의 것이므로, 순회 중 해시 조회나 HasComponent 검사가 없습니다.
+	 *
+	 * @example
+	 * auto group = RenderableArchetype::GetGroup(registry);
+	 * group.Each([](Entity entity, TransformComponent& transform, MeshComponent& mesh, MaterialComponent& material)
+	 * {
+	 *     // ...
+	 * });
+	 *
+	 * for (auto [entity, transform, mesh, material] : group.Each())
+	 * {
+	 *     // ...
+	 * }
+	 *
+	 * @warning 순회 중 그룹 Component 추가/제거 금지 (패킹 순서가 바뀜)
+	 */
+	template<typename... Components>
+	class ArchetypeGroup
+	{
+	public:
+		using ArrayTuple = std::tuple<Components*...>;
+
+		// (Entity, Component 참조...) tuple을 순회하는 Iterator
+		class EachIterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = std::tuple<Entity, Components&...>;
+			using difference_type = std::ptrdiff_t;
+			using pointer = void;
+			using reference = value_type;
+
+			EachIterator(const Registry* registry, const Core::uint32* entityIds, const ArrayTuple& arrays, size_t index)
+				: mRegistry(registry)
+				, mEntityIds(entityIds)
+				, mArrays(arrays)
+				, mIndex(index)
+			{
+			}
+
+			value_type operator*() const
+			{
+				return std::apply([&](auto*... arrays)
+					{
+						return value_type(mRegistry->GetEntityById(mEntityIds[mIndex]), arrays[mIndex]...);
+					}, mArrays);
+			}
+
+			EachIterator& operator++()
+			{
+				++mIndex;
+				return *this;
+			}
+
+			bool operator==(const EachIterator& other) const { return mIndex == other.mIndex; }
+			bool operator!=(const EachIterator& other) const { return mIndex != other.mIndex; }
+
+		private:
+			const Registry* mRegistry;
+			const Core::uint32* mEntityIds;
+			ArrayTuple mArrays;
+			size_t mIndex;
+		};
+
+		// Each()가 반환하는 range
+		class EachRange
+		{
+		public:
+			EachRange(EachIterator first, EachIterator last)
+				: mBegin(first)
+				, mEnd(last)
+			{
+			}
+
+			EachIterator begin() const { return mBegin; }
+			EachIterator end() const { return mEnd; }
+
+		private:
+			EachIterator mBegin;
+			EachIterator mEnd;
+		};
+
+		ArchetypeGroup(Registry* registry, const ArchetypeGroupData* data, ComponentStorage<Components>*... storages)
+			: mRegistry(registry)
+			, mData(data)
+			, mStorages(storages...)
+		{
+		}
+
+		// 그룹에 속한 Entity 개수
+		size_t size() const { return mData->size; }
+		bool empty() const { return mData->size == 0; }
+
+		// 패킹 인덱스 -> Entity
+		Entity GetEntity(size_t index) const
+		{
+			const auto& entityIds = std::get<0>(mStorages)->GetEntityIds();
+			return mRegistry->GetEntityById(entityIds[index]);
+		}
+
+		// 패킹 인덱스의 Component 직접 접근
+		template<typename T>
+		T& Get(size_t index) const
+		{
+			return std::get<ComponentStorage<T>*>(mStorages)->GetComponents()[index];
+		}
+
+		// 그룹의 모든 Entity를 Component 참조와 함께 순회
+		template<typename Func>
+		void Each(Func&& func) const
+		{
+			const Core::uint32 count = mData->size;
+			const Core::uint32* entityIds = std::get<0>(mStorages)->GetEntityIds().data();
+
+			std::apply([&](auto*... arrays)
+				{
+					for (Core::uint32 i = 0; i < count; ++i)
+					{
+						func(mRegistry->GetEntityById(entityIds[i]), arrays[i]...);
+					}
+				}, GetArrays());
+		}
+
+		/**
+		 * @brief Each의 병렬 버전 (패킹 영역을 grainSize 단위로 분할)
+		 * @param func void(Entity, Components&...) 형태의 호출 가능 객체 (스레드 안전해야 함)
+		 * @warning func 안에서 Registry 구조 변경 금지
+		 */
+		template<typename Func>
+		void ParallelEach(Func&& func, Core::uint32 grainSize = DEFAULT_PARALLEL_GRAIN_SIZE) const
+		{
+			const Core::uint32* entityIds = std::get<0>(mStorages)->GetEntityIds().data();
+
+			std::apply([&](auto*... arrays)
+				{
+					Core::Jobs::ParallelFor(mData->size, grainSize, [&](Core::uint32 index)
+						{
+							func(mRegistry->GetEntityById(entityIds[index]), arrays[index]...);
+						});
+				}, GetArrays());
+		}
+
+		// (Entity, Components&...) tuple range (structured binding용)
+		EachRange Each() const
+		{
+			const Core::uint32* entityIds = std::get<0>(mStorages)->GetEntityIds().data();
+			ArrayTuple arrays = GetArrays();
+			return EachRange(
+				EachIterator(mRegistry, entityIds, arrays, 0),
+				EachIterator(mRegistry, entityIds, arrays, mData->size));
+		}
+
+	private:
+		// 각 저장소의 Dense Component 배열 시작 주소
+		ArrayTuple GetArrays() const
+		{
+			return std::apply([](auto*... storages)
+				{
+					return ArrayTuple(storages->GetComponents().data()...);
+				}, mStorages);
+		}
+
+		Registry* mRegistry;
+		const ArchetypeGroupData* mData;
+		std::tuple<ComponentStorage<Components>*...> mStorages;
+	};
+
+	// Registry에 Archetype 그룹 조회 함수 추가
+	template<typename... Components>
+	ArchetypeGroup<Components...> Registry::GetGroup()
+	{
+		static_assert(sizeof...(Components) > 0, "ArchetypeGroup requires at least one component type");
+
+		const Core::uint32 groupId = Internal::TypeIdGenerator<Internal::GroupFamily>::Get<ArchetypeGroup<Components...>>();
+
+		// 그룹 생성은 저장소를 재배치하므로 System Initialize 등 단일 스레드 구간에서 하는 것을 권장
+		std::lock_guard<std::mutex> lock(mCacheMutex);
+
+		if (groupId >= mGroups.size())
+		{
+			mGroups.resize(static_cast<size_t>(groupId) + 1);
+		}
+
+		auto& group = mGroups[groupId];
+		if (!group)
+		{
+			group = std::make_unique<ArchetypeGroupData>();
+			group->storages = { GetOrCreateStorage<Components>()... };
+			group->mask = Internal::MakeComponentMask<Components...>();
+			InitializeGroup(*group);
+		}
+
+		return ArchetypeGroup<Components...>(this, group.get(), GetStorage<Components>()...);
+	}
+
+} // namespace ECS
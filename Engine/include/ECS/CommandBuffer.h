@@ -0,0 +1,180 @@
+﻿#pragma once
+#include "ECS/Component.h"
+#include "ECS/Entity.h"
+#include "ECS/Registry.h"
+#include "Core/Assert.h"
+#include "Core/Types.h"
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ECS
+{
+	/**
+	 * @brief 구조 변경(Entity 생성/삭제, Component 추가/제거)을 지연 기록하는 버퍼
+	 *
+	 * System Update 중 Registry를 직접 수정하면 순회 중인 View/그룹이 깨지므로,
+	 * 변경 사항을 선형 아레나에 기록해 두었다가 동기화 지점에서 한 번에 적용합니다.
+	 *
+	 * 재생(Playback) 순서:
+	 * 1. 생성 예약된 Entity 일괄 생성
+	 * 2. Component 추가/제거 (Component 타입별로 묶어 적용, 같은 타입 내에서는 기록 순서 유지)
+	 * 3. Entity 삭제
+	 *
+	 * 재생 시점에 이미 무효화된 Entity를 대상으로 하는 명령은 무시됩니다.
+	 *
+	 * @note 스레드 안전하지 않음. 스레드/System마다 별도의 버퍼를 사용하세요.
+	 * @example
+	 * Entity bullet = commands.CreateEntity();
+	 * commands.AddComponent(bullet, TransformComponent{});
+	 * commands.DestroyEntity(expiredEntity);
+	 * // ... 동기화 지점
+	 * commands.Playback(registry);
+	 */
+	class CommandBuffer
+	{
+	public:
+		// 생성 예약된 Entity 표시용 버전 (id = 예약 순번)
+		static constexpr Core::uint32 PENDING_ENTITY_VERSION = UINT32_MAX - 1;
+
+		// 아레나 블록 기본 크기 (바이트)
+		static constexpr size_t ARENA_BLOCK_SIZE = 64 * 1024;
+
+		CommandBuffer() = default;
+		~CommandBuffer();
+
+		// 복사 금지
+		CommandBuffer(const CommandBuffer&) = delete;
+		CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+		/**
+		 * @brief Entity 생성 예약
+		 * @return 예약 핸들 (같은 버퍼의 AddComponent/RemoveComponent/DestroyEntity 대상으로만 사용 가능)
+		 */
+		Entity CreateEntity();
+
+		// Entity 삭제 예약
+		void DestroyEntity(Entity entity);
+
+		// Component 추가 예약 (값은 아레나로 이동)
+		template<typename T>
+		void AddComponent(Entity entity, T component);
+
+		// Component 제거 예약
+		template<typename T>
+		void RemoveComponent(Entity entity);
+
+		/**
+		 * @brief 기록된 명령을 Registry에 적용하고 버퍼를 비움
+		 * @param registry 적용 대상 Registry
+		 */
+		void Playback(Registry& registry);
+
+		// 기록된 명령을 적용하지 않고 폐기 (아레나 메모리는 재사용)
+		void Clear();
+
+		bool IsEmpty() const { return mCommands.empty() && mPendingCount == 0; }
+		size_t GetCommandCount() const { return mCommands.size() + mPendingCount; }
+
+		// 생성 예약 핸들인지 확인
+		static bool IsPendingEntity(Entity entity) { return entity.version == PENDING_ENTITY_VERSION; }
+
+	private:
+		// 값 순서 = 재생 단계 (Add/Remove는 같은 단계)
+		enum class CommandType : Core::uint8
+		{
+			AddComponent,
+			RemoveComponent,
+			DestroyEntity,
+		};
+
+		// Component 타입별 타입 소거 함수 테이블
+		struct ComponentOps
+		{
+			void (*add)(Registry&, Entity, void*);
+			void (*remove)(Registry&, Entity);
+			void (*destroy)(void*);                        // 트리비얼 소멸자면 nullptr
+		};
+
+		struct Command
+		{
+			CommandType type;
+			Core::uint32 componentId;                      // DestroyEntity는 0
+			Entity entity;                                 // 실제 Entity 또는 생성 예약 핸들
+			const ComponentOps* ops;
+			void* payload;                                 // AddComponent 초기값 (아레나)
+		};
+
+		struct ArenaBlock
+		{
+			std::unique_ptr<std::byte[]> memory;
+			size_t size = 0;
+		};
+
+		template<typename T>
+		static const ComponentOps& GetComponentOps();
+
+		// 아레나에서 선형 할당 (Clear 전까지 주소 불변)
+		void* Allocate(size_t size, size_t alignment);
+
+		// 생성 예약 핸들을 실제 Entity로 변환
+		Entity Resolve(Entity entity) const;
+
+		// 아직 남아 있는 AddComponent 초기값 소멸
+		void DestroyPayloads();
+
+		std::vector<Command> mCommands;
+		Core::uint32 mPendingCount = 0;                    // 생성 예약 Entity 수
+
+		std::vector<ArenaBlock> mBlocks;
+		size_t mCurrentBlock = 0;
+		size_t mBlockOffset = 0;
+
+		std::vector<Entity> mCreatedEntities;              // 재생 중 예약 순번 -> 실제 Entity
+	};
+
+	// ============================================================================
+	// Template 구현부
+	// ============================================================================
+
+	template<typename T>
+	const CommandBuffer::ComponentOps& CommandBuffer::GetComponentOps()
+	{
+		static const ComponentOps ops =
+		{
+			[](Registry& registry, Entity entity, void* payload)
+			{
+				registry.AddComponent(entity, std::move(*static_cast<T*>(payload)));
+			},
+			[](Registry& registry, Entity entity)
+			{
+				registry.RemoveComponent<T>(entity);
+			},
+			std::is_trivially_destructible_v<T>
+				? nullptr
+				: +[](void* payload) { static_cast<T*>(payload)->~T(); },
+		};
+		return ops;
+	}
+
+	template<typename T>
+	void CommandBuffer::AddComponent(Entity entity, T component)
+	{
+		static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned components are not supported");
+
+		void* payload = Allocate(sizeof(T), alignof(T));
+		new (payload) T(std::move(component));
+
+		mCommands.push_back({ CommandType::AddComponent, Internal::GetComponentId<T>(), entity, &GetComponentOps<T>(), payload });
+	}
+
+	template<typename T>
+	void CommandBuffer::RemoveComponent(Entity entity)
+	{
+		mCommands.push_back({ CommandType::RemoveComponent, Internal::GetComponentId<T>(), entity, &GetComponentOps<T>(), nullptr });
+	}
+
+} // namespace ECS
@@ -1,32 +1,41 @@
 ﻿#pragma once
+#include "ECS/TypeId.h"
 #include "Core/Types.h"
+#include <bitset>
+#include <string_view>
 
 namespace ECS
 {
+	// 등록 가능한 최대 Component 타입 수 (Entity 시그니처 비트 수)
+	constexpr Core::uint32 MAX_COMPONENT_TYPES = 64;
+
+	// Entity가 가진 Component 집합 (비트 위치 = Component ID)
+	using ComponentMask = std::bitset<MAX_COMPONENT_TYPES>;
+
 	namespace Internal
 	{
-		// 컴포넌트 타입마다 고유한 ID를 생성
-		inline Core::uint32 GenerateComponentId()
+		// 각 컴포넌트 타입의 고유 ID를 반환 (0부터 연속, 저장소 배열 인덱스로 사용)
+		template<typename T>
+		inline Core::uint32 GetComponentId()
 		{
-			static Core::uint32 nextId = 0;
-			return nextId++;
+			return TypeIdGenerator<ComponentFamily>::Get<T>();
 		}
 
-		// 각 컴포넌트 타입의 고유 ID를 반환
+		// 컴포넌트 타입 이름 (RTTI 없음)
 		template<typename T>
-		inline Core::uint32 GetComponentId()
+		inline std::string_view GetComponentTypeName()
 		{
-			static const Core::uint32 id = GenerateComponentId();
-			return id;
+			return GetTypeName<T>();
 		}
 
-#ifdef _DEBUG
-		template<typename T>
-		inline const char* GetComponentTypeName()
+		// Component 타입 목록으로 시그니처 마스크 생성
+		template<typename... Ts>
+		inline ComponentMask MakeComponentMask()
 		{
-			return typeid(T).name();
+			ComponentMask mask;
+			(mask.set(GetComponentId<Ts>()), ...);
+			return mask;
 		}
-#endif
 
 	} // namespace Internal
 
@@ -0,0 +1,308 @@
+﻿#pragma once
+#include "ECS/Entity.h"
+#include "Core/Assert.h"
+#include "Core/Types.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ECS
+{
+	struct ArchetypeGroupData;
+	struct QueryData;
+
+	/**
+	 * @brief 변경 틱 비교 (tick이 sinceTick 이후인지)
+	 *
+	 * 부호 있는 차이로 비교하므로 틱 카운터가 한 바퀴 돌아도 (차이 < 2^31) 올바르게 동작합니다.
+	 */
+	inline bool IsNewerTick(Core::uint32 tick, Core::uint32 sinceTick)
+	{
+		return static_cast<Core::int32>(tick - sinceTick) > 0;
+	}
+
+	/**
+	 * @brief Component 제거 직전 호출되는 훅
+	 *
+	 * Component가 아직 저장소에 있는 상태에서 호출되므로 GetComponent로 값을 읽을 수 있습니다.
+	 * 다른 Entity의 Component 값을 수정할 수는 있지만 Component 추가/제거(구조 변경)는 금지입니다.
+	 */
+	using ComponentRemoveHook = void (*)(void* context, Entity entity);
+
+	// 컴포넌트 저장소 인터페이스 (타입 소거)
+	class IComponentStorage
+	{
+	public:
+		static constexpr Core::uint32 INVALID_INDEX = UINT32_MAX;
+
+		virtual ~IComponentStorage() = default;
+		virtual void RemoveComponent(Core::uint32 entityId) = 0;
+		virtual bool HasComponent(Core::uint32 entityId) const = 0;
+
+		// 저장된 컴포넌트 개수
+		virtual size_t Size() const = 0;
+
+		// 컴포넌트를 가진 Entity ID 목록 (Dense 배열 순서)
+		virtual const std::vector<Core::uint32>& GetEntityIds() const = 0;
+
+		// Entity ID -> Dense 인덱스 (없으면 INVALID_INDEX)
+		virtual Core::uint32 GetDenseIndex(Core::uint32 entityId) const = 0;
+
+		// Dense 배열의 두 위치를 교환 (Archetype 그룹 패킹용)
+		virtual void SwapDense(Core::uint32 lhs, Core::uint32 rhs) = 0;
+
+		// 이 저장소를 소유한 Archetype 그룹 (없으면 nullptr)
+		ArchetypeGroupData* GetOwningGroup() const { return mOwningGroup; }
+		void SetOwningGroup(ArchetypeGroupData* group) { mOwningGroup = group; }
+
+		// 이 저장소의 Component를 조건으로 가지는 캐시된 쿼리 목록
+		const std::vector<QueryData*>& GetQueries() const { return mQueries; }
+		void AddQuery(QueryData* query) { mQueries.push_back(query); }
+
+		// 추가/제거 시 Registry가 그룹/쿼리를 갱신해야 하는지 여부
+		bool HasListeners() const { return mOwningGroup != nullptr || !mQueries.empty(); }
+
+		// 제거 훅 (저장소당 하나, nullptr면 해제)
+		void SetRemoveHook(ComponentRemoveHook hook, void* context)
+		{
+			mRemoveHook = hook;
+			mRemoveHookContext = context;
+		}
+		bool HasRemoveHook() const { return mRemoveHook != nullptr; }
+		void InvokeRemoveHook(Entity entity) const { mRemoveHook(mRemoveHookContext, entity); }
+
+		// 저장소 전체에서 마지막으로 추가/변경/제거가 일어난 틱 (변경이 없으면 Entity 순회 없이 스킵 가능)
+		Core::uint32 GetLastWriteTick() const { return mLastWriteTick.load(std::memory_order_relaxed); }
+
+		// 마지막으로 추가/제거(구조 변경)가 일어난 틱
+		Core::uint32 GetLastStructuralTick() const { return mLastStructuralTick; }
+
+		// 값 변경 기록 (병렬 System에서 호출 가능)
+		void NoteWrite(Core::uint32 tick) { mLastWriteTick.store(tick, std::memory_order_relaxed); }
+
+		// 추가/제거 기록
+		void NoteStructuralChange(Core::uint32 tick)
+		{
+			mLastStructuralTick = tick;
+			NoteWrite(tick);
+		}
+
+	private:
+		ArchetypeGroupData* mOwningGroup = nullptr;
+		std::vector<QueryData*> mQueries;
+
+		ComponentRemoveHook mRemoveHook = nullptr;
+		void* mRemoveHookContext = nullptr;
+
+		std::atomic<Core::uint32> mLastWriteTick{ 0 };
+		Core::uint32 mLastStructuralTick = 0;
+	};
+
+	/**
+	 * @brief Sparse Set 기반 컴포넌트 저장소
+	 *
+	 * Entity ID -> Dense 인덱스를 Sparse 배열(페이지 단위)로 매핑하고,
+	 * 실제 컴포넌트는 Dense 배열에 빈틈 없이 저장합니다.
+	 *
+	 * - 조회/추가: O(1), 해시 탐색 없음
+	 * - 제거: 마지막 원소와 교체 후 pop (swap-and-pop), O(1)
+	 * - 순회: Dense 배열의 선형 스캔 (캐시/프리페치 친화적)
+	 *
+	 * Sparse 배열은 SPARSE_PAGE_SIZE 단위 페이지로 나누어 필요한 페이지만 할당하므로
+	 * ID 공간이 듬성듬성해도 메모리가 크게 낭비되지 않습니다.
+	 *
+	 * 각 컴포넌트는 Dense 배열과 나란히 추가 틱/변경 틱을 가지며,
+	 * Changed<T>/Added<T> View 필터가 "마지막 실행 이후 바뀐 Entity"만 골라낼 때 사용합니다.
+	 *
+	 * @warning 제거(swap-and-pop)나 Dense 배열 확장 시 기존 컴포넌트 포인터가 무효화됩니다.
+	 *          포인터를 프레임 간에 보관하지 말고 필요할 때마다 GetComponent로 조회하세요.
+	 */
+	template<typename T>
+	class ComponentStorage : public IComponentStorage
+	{
+	public:
+		static constexpr Core::uint32 SPARSE_PAGE_SIZE = 4096;
+
+		ComponentStorage() = default;
+		~ComponentStorage() override = default;
+
+		// 컴포넌트 추가 (이미 있으면 덮어쓰고 변경 틱만 갱신)
+		T* AddComponent(Core::uint32 entityId, const T& component, Core::uint32 tick)
+		{
+			Core::uint32& denseIndex = GetOrCreateSparseSlot(entityId);
+			if (denseIndex != INVALID_INDEX)
+			{
+				mComponents[denseIndex] = component;
+				MarkChanged(denseIndex, tick);
+				return &mComponents[denseIndex];
+			}
+
+			denseIndex = static_cast<Core::uint32>(mComponents.size());
+			mDenseEntityIds.push_back(entityId);
+			mComponents.push_back(component);
+			mAddedTicks.push_back(tick);
+			mChangedTicks.push_back(tick);
+			NoteStructuralChange(tick);
+			return &mComponents.back();
+		}
+
+		// 컴포넌트 추가 (이동 의미론)
+		T* AddComponent(Core::uint32 entityId, T&& component, Core::uint32 tick)
+		{
+			Core::uint32& denseIndex = GetOrCreateSparseSlot(entityId);
+			if (denseIndex != INVALID_INDEX)
+			{
+				mComponents[denseIndex] = std::move(component);
+				MarkChanged(denseIndex, tick);
+				return &mComponents[denseIndex];
+			}
+
+			denseIndex = static_cast<Core::uint32>(mComponents.size());
+			mDenseEntityIds.push_back(entityId);
+			mComponents.push_back(std::move(component));
+			mAddedTicks.push_back(tick);
+			mChangedTicks.push_back(tick);
+			NoteStructuralChange(tick);
+			return &mComponents.back();
+		}
+
+		// 컴포넌트 제거 (swap-and-pop)
+		void RemoveComponent(Core::uint32 entityId) override
+		{
+			const Core::uint32 denseIndex = GetDenseIndex(entityId);
+			if (denseIndex == INVALID_INDEX)
+			{
+				return;
+			}
+
+			const Core::uint32 lastIndex = static_cast<Core::uint32>(mComponents.size() - 1);
+			if (denseIndex != lastIndex)
+			{
+				// 마지막 원소를 빈 자리로 이동
+				const Core::uint32 lastEntityId = mDenseEntityIds[lastIndex];
+				mComponents[denseIndex] = std::move(mComponents[lastIndex]);
+				mDenseEntityIds[denseIndex] = lastEntityId;
+				mAddedTicks[denseIndex] = mAddedTicks[lastIndex];
+				mChangedTicks[denseIndex] = mChangedTicks[lastIndex];
+				GetSparseSlot(lastEntityId) = denseIndex;
+			}
+
+			mComponents.pop_back();
+			mDenseEntityIds.pop_back();
+			mAddedTicks.pop_back();
+			mChangedTicks.pop_back();
+			GetSparseSlot(entityId) = INVALID_INDEX;
+		}
+
+		// 컴포넌트 조회
+		T* GetComponent(Core::uint32 entityId)
+		{
+			const Core::uint32 denseIndex = GetDenseIndex(entityId);
+			return (denseIndex != INVALID_INDEX) ? &mComponents[denseIndex] : nullptr;
+		}
+
+		const T* GetComponent(Core::uint32 entityId) const
+		{
+			const Core::uint32 denseIndex = GetDenseIndex(entityId);
+			return (denseIndex != INVALID_INDEX) ? &mComponents[denseIndex] : nullptr;
+		}
+
+		// 컴포넌트 존재 여부
+		bool HasComponent(Core::uint32 entityId) const override
+		{
+			return GetDenseIndex(entityId) != INVALID_INDEX;
+		}
+
+		// Entity ID -> Dense 인덱스 (없으면 INVALID_INDEX)
+		Core::uint32 GetDenseIndex(Core::uint32 entityId) const override
+		{
+			const Core::uint32 page = entityId / SPARSE_PAGE_SIZE;
+			if (page >= mSparsePages.size() || !mSparsePages[page])
+			{
+				return INVALID_INDEX;
+			}
+
+			return mSparsePages[page][entityId % SPARSE_PAGE_SIZE];
+		}
+
+		// Dense 배열의 두 위치를 교환 (Sparse 인덱스도 함께 갱신)
+		void SwapDense(Core::uint32 lhs, Core::uint32 rhs) override
+		{
+			if (lhs == rhs)
+			{
+				return;
+			}
+
+			std::swap(mComponents[lhs], mComponents[rhs]);
+			std::swap(mDenseEntityIds[lhs], mDenseEntityIds[rhs]);
+			std::swap(mAddedTicks[lhs], mAddedTicks[rhs]);
+			std::swap(mChangedTicks[lhs], mChangedTicks[rhs]);
+			GetSparseSlot(mDenseEntityIds[lhs]) = lhs;
+			GetSparseSlot(mDenseEntityIds[rhs]) = rhs;
+		}
+
+		size_t Size() const override { return mComponents.size(); }
+		bool Empty() const { return mComponents.empty(); }
+
+		// Dense 배열 직접 접근 (인덱스 i의 컴포넌트는 GetEntityIds()[i]의 것)
+		const std::vector<Core::uint32>& GetEntityIds() const override { return mDenseEntityIds; }
+		std::vector<T>& GetComponents() { return mComponents; }
+		const std::vector<T>& GetComponents() const { return mComponents; }
+
+		// 변경 틱 기록 (Dense 인덱스 기준, 서로 다른 인덱스는 병렬 호출 가능)
+		void MarkChanged(Core::uint32 denseIndex, Core::uint32 tick)
+		{
+			mChangedTicks[denseIndex] = tick;
+			NoteWrite(tick);
+		}
+
+		// 추가/변경 틱 조회 (Dense 인덱스 기준, 추가 시 변경 틱도 함께 기록됨)
+		Core::uint32 GetAddedTick(Core::uint32 denseIndex) const { return mAddedTicks[denseIndex]; }
+		Core::uint32 GetChangedTick(Core::uint32 denseIndex) const { return mChangedTicks[denseIndex]; }
+
+		// 미리 Dense 배열 용량 확보
+		void Reserve(size_t capacity)
+		{
+			mDenseEntityIds.reserve(capacity);
+			mComponents.reserve(capacity);
+			mAddedTicks.reserve(capacity);
+			mChangedTicks.reserve(capacity);
+		}
+
+	private:
+		// Sparse 슬롯 참조 (페이지가 반드시 존재해야 함)
+		Core::uint32& GetSparseSlot(Core::uint32 entityId)
+		{
+			const Core::uint32 page = entityId / SPARSE_PAGE_SIZE;
+			CORE_ASSERT(page < mSparsePages.size() && mSparsePages[page], "Sparse page does not exist");
+			return mSparsePages[page][entityId % SPARSE_PAGE_SIZE];
+		}
+
+		// Sparse 슬롯 참조 (페이지가 없으면 할당)
+		Core::uint32& GetOrCreateSparseSlot(Core::uint32 entityId)
+		{
+			const Core::uint32 page = entityId / SPARSE_PAGE_SIZE;
+			if (page >= mSparsePages.size())
+			{
+				mSparsePages.resize(page + 1);
+			}
+
+			if (!mSparsePages[page])
+			{
+				mSparsePages[page] = std::make_unique<Core::uint32[]>(SPARSE_PAGE_SIZE);
+				std::fill_n(mSparsePages[page].get(), SPARSE_PAGE_SIZE, INVALID_INDEX);
+			}
+
+			return mSparsePages[page][entityId % SPARSE_PAGE_SIZE];
+		}
+
+		std::vector<std::unique_ptr<Core::uint32[]>> mSparsePages;  // Entity ID -> Dense 인덱스 (페이지 단위)
+		std::vector<Core::uint32> mDenseEntityIds;                  // Dense 인덱스 -> Entity ID
+		std::vector<T> mComponents;                                 // Dense 컴포넌트 배열
+		std::vector<Core::uint32> mAddedTicks;                      // Dense 인덱스 -> 추가된 틱
+		std::vector<Core::uint32> mChangedTicks;                    // Dense 인덱스 -> 마지막 변경 틱
+	};
+
+} // namespace ECS
@@ -0,0 +1,33 @@
+﻿#pragma once
+#include "Math/BoundingVolumes.h"
+
+namespace ECS
+{
+	/**
+	 * @brief 경계 볼륨 컴포넌트 (순수 데이터)
+	 *
+	 * 로컬 경계는 보통 Mesh가 만들어질 때 계산된 값(Graphics::Mesh::GetLocalBounds)을 복사해 둡니다.
+	 * 월드 경계는 TransformSystem이 World Matrix가 바뀐 프레임에만 다시 계산하는 캐시이며,
+	 * RenderSystem의 절두체 컬링이 이 값을 읽습니다.
+	 *
+	 * @note 로컬 경계를 직접 바꾼 경우 Registry::MarkChanged<BoundsComponent>() 호출 필요
+	 *       (추가 직후에는 자동으로 월드 경계가 계산됨)
+	 *
+	 * @example
+	 * ECS::BoundsComponent bounds;
+	 * bounds.localBounds = mesh->GetLocalBounds();
+	 * bounds.localSphere = mesh->GetLocalSphere();
+	 * registry.AddComponent(entity, bounds);
+	 */
+	struct BoundsComponent
+	{
+		// 로컬 공간 (메시 정점 기준)
+		Math::AABB localBounds;
+		Math::BoundingSphere localSphere;
+
+		// 월드 공간 캐시 (TransformSystem이 갱신)
+		Math::AABB worldBounds;
+		Math::BoundingSphere worldSphere;
+	};
+
+} // namespace ECS
@@ -9,7 +9,7 @@
  */
 #pragma once
 #include "ECS/Entity.h"
-#include <vector>
+#include "Core/Types.h"
 
 namespace ECS
 {
@@ -19,6 +19,11 @@ namespace ECS
 	 * Entity 간의 부모-자식 관계를 저장합니다.
 	 * Transform 계층 구조를 위해 TransformComponent와 함께 사용됩니다.
 	 *
+	 * 자식 목록은 힙 할당 없이 형제끼리의 양방향 연결 리스트(intrusive)로 표현하므로
+	 * 자식 추가/제거가 O(1)입니다. Root들도 같은 형제 링크로 TransformSystem의 Root 목록에 연결됩니다.
+	 *
+	 * @warning 링크 필드는 TransformSystem만 수정합니다 (SetParent 사용)
+	 *
 	 * @warning position/rotation/scale 변경은 반드시 TransformSystem API 사용
 	 *          직접 수정 시 dirty 플래그가 설정되지 않음
 	 *
@@ -33,14 +38,19 @@ namespace ECS
 		/// 부모 Entity (Invalid면 Root)
 		Entity parent = Entity::Invalid();
 
-		/// 자식 Entity 목록 (순회 최적화를 위해 vector 사용)
-		std::vector<Entity> children;
+		/// 첫 번째/마지막 자식 (자식이 없으면 Invalid)
+		Entity firstChild = Entity::Invalid();
+		Entity lastChild = Entity::Invalid();
+
+		/// 이전/다음 형제 (Root면 Root 목록의 이전/다음 Root)
+		Entity prevSibling = Entity::Invalid();
+		Entity nextSibling = Entity::Invalid();
+
+		/// 직계 자식 수
+		Core::uint32 childCount = 0;
 
-		//=====================================================================
-		// TODO: [OPTIMIZATION] Phase 4+
-		// - 현재: std::vector<Entity> children
-		// - 최적화: firstChild + nextSibling 연결 리스트 (메모리 제약 시)
-		//=====================================================================
+		/// 계층 깊이 (Root = 0)
+		Core::uint32 depth = 0;
 	};
 
 } // namespace ECS
@@ -24,7 +24,6 @@ namespace ECS
 		Math::Vector3 color = Math::Vector3(1.0f, 1.0f, 1.0f);        // RGB (0~1)
 		Core::float32 intensity = 1.0f;                               // 조명 강도
 		bool castsShadow = false;                                     // Phase 6: Shadow Map
-		bool isDirty = true;                                          // Phase 3.4: ImGui 통합 대비
 	};
 
 	/**
@@ -45,8 +44,6 @@ namespace ECS
 		Core::float32 constant = 1.0f;                           // Kc
 		Core::float32 linear = 0.09f;                            // Kl (10 단위 거리 기준)
 		Core::float32 quadratic = 0.032f;                        // Kq
-
-		bool isDirty = true;                                     // Phase 3.4: ImGui 통합 대비
 	};
 
 	/**
@@ -61,7 +58,6 @@ namespace ECS
 		// - color, intensity, range
 		// - innerConeAngle, outerConeAngle
 		// - constant, linear, quadratic
-		// - isDirty
 	};
 
 } // namespace ECS
@@ -16,8 +16,29 @@
 #include "ECS/Entity.h"
 #include "Math/MathTypes.h"
 
+/**
+ * @brief Transform 행렬 캐시 레이아웃 선택
+ *
+ * 1: 아핀 압축 행렬(Math::Matrix3x4, 48 bytes)로 저장 (기본값)
+ * 0: Math::Matrix4x4(64 bytes)로 저장
+ *
+ * Transform 행렬은 항상 아핀이므로 Matrix4x4의 마지막 열 (0, 0, 0, 1)은 저장할 필요가 없습니다.
+ * 압축 레이아웃은 계층 업데이트가 읽고 쓰는 메모리를 약 25% 줄이며,
+ * Matrix4x4 변환은 렌더링 직전(RenderSystem)에서만 수행합니다.
+ */
+#ifndef ECS_COMPACT_TRANSFORM
+#define ECS_COMPACT_TRANSFORM 1
+#endif
+
 namespace ECS
 {
+	/// Transform 행렬 캐시 형식 (Math::ToMatrix4x4()로 Matrix4x4 변환)
+#if ECS_COMPACT_TRANSFORM
+	using TransformMatrix = Math::Matrix3x4;
+#else
+	using TransformMatrix = Math::Matrix4x4;
+#endif
+
 	/**
 	 * @brief Transform 컴포넌트 (순수 데이터)
 	 *
@@ -41,27 +62,25 @@ namespace ECS
 		//=====================================================================
 
 		/// Local 변환 행렬 (Scale * Rotation * Translation)
-		Math::Matrix4x4 localMatrix = Math::Matrix4x4::Identity();
+		TransformMatrix localMatrix = TransformMatrix::Identity();
 
 		/// World 변환 행렬 (Parent.worldMatrix * localMatrix)
-		Math::Matrix4x4 worldMatrix = Math::Matrix4x4::Identity();
+		TransformMatrix worldMatrix = TransformMatrix::Identity();
+
+		/// World 역전치 행렬 (노멀 변환용, worldMatrix와 함께 갱신)
+		/// 자신과 모든 조상이 균등 스케일이면 역행렬 계산 없이 worldMatrix를 그대로 사용
+		/// @note 노멀 변환에는 회전/스케일 부분만 사용 (이동 부분 값은 의미 없음)
+		TransformMatrix worldInvTranspose = TransformMatrix::Identity();
 
 		//=====================================================================
-		// Dirty Flags
+		// Dirty Flags (비트 필드로 1바이트에 저장)
 		//=====================================================================
 
 		/// Local 행렬 재계산 필요 여부 (position/rotation/scale 변경 시 true)
-		bool localDirty = true;
+		bool localDirty : 1 = true;
 
 		/// World 행렬 재계산 필요 여부 (local 변경 또는 parent 변경 시 true)
-		bool worldDirty = true;
-
-		//=====================================================================
-		// TODO: [OPTIMIZATION] Phase 4+
-		// - 현재: localMatrix + worldMatrix 캐시
-		// - 최적화: worldInvTranspose 추가 캐시 (조명 병목 시)
-		// - 최적화: 단일 dirty + 비트 플래그 (메모리 최적화 필요 시)
-		//=====================================================================
+		bool worldDirty : 1 = true;
 	};
 
 } // namespace ECS
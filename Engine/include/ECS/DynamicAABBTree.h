@@ -0,0 +1,514 @@
+﻿#pragma once
+#include "Math/BoundingVolumes.h"
+#include "Core/Assert.h"
+#include "Core/Types.h"
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace ECS
+{
+	/**
+	 * @brief 증분 갱신되는 동적 AABB 트리 (BVH)
+	 *
+	 * 리프마다 여유 여백(fat margin)을 더한 경계를 저장하여, 작은 이동은 트리를 건드리지 않고
+	 * 경계가 여유 경계를 벗어날 때만 리프를 다시 삽입합니다.
+	 *
+	 * - 삽입: 표면적 비용(SAH)이 가장 작아지는 형제를 찾아 붙인 뒤 AVL 회전으로 높이 균형 유지
+	 * - 재구성: 전체 리프를 구간 분할(binned) SAH로 위에서 아래로 다시 구성 (품질이 떨어졌을 때)
+	 * - 쿼리: 내부 노드는 여유 경계, 리프는 실제 경계로 판정
+	 *
+	 * 프록시 ID는 리프 노드 인덱스이며, 파괴 전까지(재구성 포함) 바뀌지 않습니다.
+	 *
+	 * @note 스레드 안전하지 않음. 갱신과 쿼리가 동시에 일어나지 않도록 호출 측에서 보장해야 합니다.
+	 *       (쿼리끼리는 동시에 실행해도 안전)
+	 */
+	class DynamicAABBTree
+	{
+	public:
+		static constexpr Core::uint32 INVALID_PROXY = UINT32_MAX;
+
+		// QueryFrustums에서 한 번에 처리할 수 있는 최대 절두체 수 (비트 마스크 폭)
+		static constexpr Core::uint32 MAX_BATCH_FRUSTUMS = 32;
+
+		/**
+		 * @param fatMargin 리프 경계에 더할 여유 여백 (축마다 양쪽으로 더함)
+		 */
+		explicit DynamicAABBTree(Core::float32 fatMargin = 0.1f);
+
+		//=====================================================================
+		// 프록시 관리
+		//=====================================================================
+
+		/**
+		 * @brief 리프 생성 및 삽입
+		 * @param bounds 실제 경계
+		 * @param userData 쿼리 콜백에 전달할 값 (예: Entity ID)
+		 * @return 프록시 ID
+		 */
+		Core::uint32 CreateProxy(const Math::AABB& bounds, Core::uint32 userData);
+
+		// 리프 제거
+		void DestroyProxy(Core::uint32 proxyId);
+
+		/**
+		 * @brief 리프 경계 갱신
+		 *
+		 * 새 경계가 여유 경계 안에 있고 여유 경계가 지나치게 크지 않으면 실제 경계만 바꿉니다.
+		 *
+		 * @return 트리에 다시 삽입했으면 true
+		 */
+		bool MoveProxy(Core::uint32 proxyId, const Math::AABB& bounds);
+
+		/**
+		 * @brief 전체 리프로 트리를 다시 구성 (구간 분할 SAH)
+		 *
+		 * 증분 삽입이 쌓여 품질(GetAreaRatio)이 떨어졌을 때 호출합니다.
+		 * 프록시 ID는 유지됩니다.
+		 */
+		void Rebuild();
+
+		// 모든 노드 제거
+		void Clear();
+
+		//=====================================================================
+		// 조회
+		//=====================================================================
+
+		Core::uint32 GetUserData(Core::uint32 proxyId) const;
+		const Math::AABB& GetBounds(Core::uint32 proxyId) const;
+		const Math::AABB& GetFatBounds(Core::uint32 proxyId) const;
+
+		Core::uint32 GetProxyCount() const { return mProxyCount; }
+		Core::uint32 GetNodeCount() const { return mNodeCount; }
+
+		// 트리 높이 (비어 있으면 0, 리프 하나면 0)
+		Core::uint32 GetHeight() const;
+
+		/**
+		 * @brief 트리 품질 지표 (내부 노드 표면적 합 / 루트 표면적)
+		 *
+		 * SAH 순회 비용에 비례하며, 낮을수록 좋습니다.
+		 */
+		Core::float32 GetAreaRatio() const;
+
+		Core::float32 GetFatMargin() const { return mFatMargin; }
+
+		// 구조 검증 (부모/자식 링크, 높이, 경계 포함 관계, 디버깅용)
+		void Validate() const;
+
+		//=====================================================================
+		// 쿼리 (콜백은 userData를 받음)
+		//=====================================================================
+
+		// 상자와 겹치는 리프
+		template<typename Func>
+		void QueryAABB(const Math::AABB& box, Func&& func) const;
+
+		// 구와 겹치는 리프
+		template<typename Func>
+		void QuerySphere(const Math::BoundingSphere& sphere, Func&& func) const;
+
+		/**
+		 * @brief 절두체와 겹치는 리프
+		 *
+		 * 완전히 안쪽인 서브트리는 더 판정하지 않고 모든 리프를 보고합니다.
+		 */
+		template<typename Func>
+		void QueryFrustum(const Math::Frustum& frustum, Func&& func) const;
+
+		/**
+		 * @brief 여러 절두체를 한 번의 순회로 판정 (카메라 + 그림자 분할 등)
+		 *
+		 * @param func (userData, visibleMask) 형태, visibleMask의 i번째 비트 = frustums[i]와 겹침
+		 * @note count는 MAX_BATCH_FRUSTUMS 이하
+		 */
+		template<typename Func>
+		void QueryFrustums(const Math::Frustum* frustums, Core::uint32 count, Func&& func) const;
+
+		/**
+		 * @brief 반직선과 겹치는 리프 (가까운 자식부터 순회)
+		 *
+		 * @param direction 정규화할 필요 없음 (거리는 direction 길이 단위의 매개변수 t)
+		 * @param func (userData, entryDistance) -> 새 최대 거리
+		 *        maxDistance를 그대로 반환하면 계속, 더 작은 값을 반환하면 그 거리 이후는 건너뜀, 0 이하면 중단
+		 */
+		template<typename Func>
+		void RayCast(
+			const Math::Vector3& origin,
+			const Math::Vector3& direction,
+			Core::float32 maxDistance,
+			Func&& func
+		) const;
+
+	private:
+		static constexpr Core::uint32 NULL_NODE = UINT32_MAX;
+
+		// 재구성 시 분할 후보를 나눌 구간 수
+		static constexpr Core::uint32 SAH_BIN_COUNT = 12;
+
+		// 여유 경계가 실제 경계 + (여백 x 이 값)보다 크면 다시 삽입 (오래 머문 큰 여유 경계 축소)
+		static constexpr Core::float32 LOOSE_MARGIN_FACTOR = 4.0f;
+
+		/**
+		 * @brief 트리 노드
+		 *
+		 * 리프: child1 == NULL_NODE, height == 0
+		 * 빈 노드: height == -1, parent가 다음 빈 노드를 가리킴
+		 */
+		struct Node
+		{
+			Math::AABB fatBounds;       // 여유 경계 (내부 노드는 자식 여유 경계의 합)
+			Math::AABB bounds;          // 실제 경계 (리프만 사용)
+			Core::uint32 parent = NULL_NODE;
+			Core::uint32 child1 = NULL_NODE;
+			Core::uint32 child2 = NULL_NODE;
+			Core::uint32 userData = 0;
+			Core::int32 height = -1;
+
+			bool IsLeaf() const { return child1 == NULL_NODE; }
+		};
+
+		/**
+		 * @brief 순회 스택 (얕은 트리는 고정 버퍼, 깊어지면 힙으로 넘침)
+		 */
+		template<typename T>
+		class TraversalStack
+		{
+		public:
+			void Push(const T& value)
+			{
+				if (mSize < INLINE_CAPACITY)
+				{
+					mInline[mSize] = value;
+				}
+				else
+				{
+					mOverflow.push_back(value);
+				}
+				++mSize;
+			}
+
+			T Pop()
+			{
+				--mSize;
+				if (mSize < INLINE_CAPACITY)
+				{
+					return mInline[mSize];
+				}
+				T value = mOverflow.back();
+				mOverflow.pop_back();
+				return value;
+			}
+
+			bool IsEmpty() const { return mSize == 0; }
+
+		private:
+			static constexpr Core::uint32 INLINE_CAPACITY = 64;
+
+			T mInline[INLINE_CAPACITY];
+			std::vector<T> mOverflow;
+			Core::uint32 mSize = 0;
+		};
+
+		// 다중 절두체 순회 항목
+		struct FrustumTask
+		{
+			Core::uint32 node;
+			Core::uint32 testMask;      // 아직 판정이 필요한 절두체
+			Core::uint32 insideMask;    // 조상에서 완전히 안쪽으로 확정된 절두체
+		};
+
+		// 반직선 순회 항목 (넣을 때 계산한 진입 거리)
+		struct RayTask
+		{
+			Core::uint32 node;
+			Core::float32 distance;
+		};
+
+		Core::uint32 AllocateNode();
+		void FreeNode(Core::uint32 nodeIndex);
+
+		void InsertLeaf(Core::uint32 leaf);
+		void RemoveLeaf(Core::uint32 leaf);
+
+		// 노드 A에서 AVL 회전 (새 서브트리 루트 반환)
+		Core::uint32 Balance(Core::uint32 nodeA);
+
+		// nodeIndex부터 루트까지 균형 조정 및 경계/높이 갱신
+		void RefitAncestors(Core::uint32 nodeIndex);
+
+		Math::AABB FattenBounds(const Math::AABB& bounds) const;
+
+		// 서브트리의 모든 리프 보고
+		template<typename Func>
+		void ReportSubtree(Core::uint32 nodeIndex, TraversalStack<Core::uint32>& stack, Func& func) const;
+
+	private:
+		std::vector<Node> mNodes;
+		Core::uint32 mRoot = NULL_NODE;
+		Core::uint32 mFreeList = NULL_NODE;
+		Core::uint32 mNodeCount = 0;
+		Core::uint32 mProxyCount = 0;
+		Core::float32 mFatMargin;
+	};
+
+	//=========================================================================
+	// 쿼리 구현
+	//=========================================================================
+
+	template<typename Func>
+	void DynamicAABBTree::ReportSubtree(Core::uint32 nodeIndex, TraversalStack<Core::uint32>& stack, Func& func) const
+	{
+		stack.Push(nodeIndex);
+		while (!stack.IsEmpty())
+		{
+			const Node& node = mNodes[stack.Pop()];
+			if (node.IsLeaf())
+			{
+				func(node.userData);
+			}
+			else
+			{
+				stack.Push(node.child2);
+				stack.Push(node.child1);
+			}
+		}
+	}
+
+	template<typename Func>
+	void DynamicAABBTree::QueryAABB(const Math::AABB& box, Func&& func) const
+	{
+		if (mRoot == NULL_NODE)
+		{
+			return;
+		}
+
+		TraversalStack<Core::uint32> stack;
+		stack.Push(mRoot);
+		while (!stack.IsEmpty())
+		{
+			const Node& node = mNodes[stack.Pop()];
+			if (node.IsLeaf())
+			{
+				if (Math::Intersects(node.bounds, box))
+				{
+					func(node.userData);
+				}
+			}
+			else if (Math::Intersects(node.fatBounds, box))
+			{
+				stack.Push(node.child2);
+				stack.Push(node.child1);
+			}
+		}
+	}
+
+	template<typename Func>
+	void DynamicAABBTree::QuerySphere(const Math::BoundingSphere& sphere, Func&& func) const
+	{
+		if (mRoot == NULL_NODE)
+		{
+			return;
+		}
+
+		TraversalStack<Core::uint32> stack;
+		stack.Push(mRoot);
+		while (!stack.IsEmpty())
+		{
+			const Node& node = mNodes[stack.Pop()];
+			if (node.IsLeaf())
+			{
+				if (Math::Intersects(node.bounds, sphere))
+				{
+					func(node.userData);
+				}
+			}
+			else if (Math::Intersects(node.fatBounds, sphere))
+			{
+				stack.Push(node.child2);
+				stack.Push(node.child1);
+			}
+		}
+	}
+
+	template<typename Func>
+	void DynamicAABBTree::QueryFrustum(const Math::Frustum& frustum, Func&& func) const
+	{
+		if (mRoot == NULL_NODE)
+		{
+			return;
+		}
+
+		TraversalStack<Core::uint32> stack;
+		TraversalStack<Core::uint32> subtreeStack;
+		stack.Push(mRoot);
+		while (!stack.IsEmpty())
+		{
+			const Core::uint32 nodeIndex = stack.Pop();
+			const Node& node = mNodes[nodeIndex];
+			if (node.IsLeaf())
+			{
+				if (Math::IntersectsFrustum(frustum, node.bounds))
+				{
+					func(node.userData);
+				}
+				continue;
+			}
+
+			const Math::Containment containment = Math::ClassifyFrustum(frustum, node.fatBounds);
+			if (containment == Math::Containment::Inside)
+			{
+				ReportSubtree(nodeIndex, subtreeStack, func);
+			}
+			else if (containment == Math::Containment::Intersects)
+			{
+				stack.Push(node.child2);
+				stack.Push(node.child1);
+			}
+		}
+	}
+
+	template<typename Func>
+	void DynamicAABBTree::QueryFrustums(const Math::Frustum* frustums, Core::uint32 count, Func&& func) const
+	{
+		CORE_ASSERT(count <= MAX_BATCH_FRUSTUMS, "Too many frustums in one batch: %u", count);
+		if (mRoot == NULL_NODE || count == 0)
+		{
+			return;
+		}
+
+		const Core::uint32 allMask = (count == 32) ? UINT32_MAX : ((1u << count) - 1u);
+
+		TraversalStack<FrustumTask> stack;
+		stack.Push({ mRoot, allMask, 0 });
+		while (!stack.IsEmpty())
+		{
+			const FrustumTask task = stack.Pop();
+			const Node& node = mNodes[task.node];
+
+			Core::uint32 testMask = 0;
+			Core::uint32 insideMask = task.insideMask;
+
+			if (node.IsLeaf())
+			{
+				// 리프는 실제 경계로 판정 (조상에서 완전히 안쪽이면 실제 경계도 안쪽)
+				for (Core::uint32 bits = task.testMask; bits != 0; bits &= bits - 1)
+				{
+					const Core::uint32 i = static_cast<Core::uint32>(std::countr_zero(bits));
+					if (Math::IntersectsFrustum(frustums[i], node.bounds))
+					{
+						insideMask |= 1u << i;
+					}
+				}
+				if (insideMask != 0)
+				{
+					func(node.userData, insideMask);
+				}
+				continue;
+			}
+
+			for (Core::uint32 bits = task.testMask; bits != 0; bits &= bits - 1)
+			{
+				const Core::uint32 i = static_cast<Core::uint32>(std::countr_zero(bits));
+				const Math::Containment containment = Math::ClassifyFrustum(frustums[i], node.fatBounds);
+				if (containment == Math::Containment::Inside)
+				{
+					insideMask |= 1u << i;
+				}
+				else if (containment == Math::Containment::Intersects)
+				{
+					testMask |= 1u << i;
+				}
+			}
+
+			if ((testMask | insideMask) != 0)
+			{
+				stack.Push({ node.child2, testMask, insideMask });
+				stack.Push({ node.child1, testMask, insideMask });
+			}
+		}
+	}
+
+	template<typename Func>
+	void DynamicAABBTree::RayCast(
+		const Math::Vector3& origin,
+		const Math::Vector3& direction,
+		Core::float32 maxDistance,
+		Func&& func
+	) const
+	{
+		if (mRoot == NULL_NODE)
+		{
+			return;
+		}
+
+		// 0 성분은 무한대가 되며 슬랩 판정에서 그대로 처리됨
+		const Math::Vector3 inverseDirection(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+
+		// 노드를 스택에 넣기 전에 판정하여 진입 거리를 함께 저장 (꺼낼 때 최대 거리가 줄었으면 건너뜀)
+		auto testNode = [&](const Node& node, Core::float32& outDistance)
+			{
+				return Math::IntersectsRay(
+					node.IsLeaf() ? node.bounds : node.fatBounds,
+					origin, inverseDirection, maxDistance, outDistance);
+			};
+
+		RayTask rootTask{ mRoot, 0.0f };
+		if (!testNode(mNodes[mRoot], rootTask.distance))
+		{
+			return;
+		}
+
+		TraversalStack<RayTask> stack;
+		stack.Push(rootTask);
+		while (!stack.IsEmpty())
+		{
+			const RayTask task = stack.Pop();
+			if (task.distance > maxDistance)
+			{
+				continue;
+			}
+
+			const Node& node = mNodes[task.node];
+			if (node.IsLeaf())
+			{
+				maxDistance = func(node.userData, task.distance);
+				if (maxDistance <= 0.0f)
+				{
+					return;
+				}
+				continue;
+			}
+
+			RayTask task1{ node.child1, 0.0f };
+			RayTask task2{ node.child2, 0.0f };
+			const bool hit1 = testNode(mNodes[task1.node], task1.distance);
+			const bool hit2 = testNode(mNodes[task2.node], task2.distance);
+
+			// 진입 거리가 가까운 자식을 먼저 꺼내도록 나중에 넣음
+			if (hit1 && hit2)
+			{
+				if (task1.distance <= task2.distance)
+				{
+					stack.Push(task2);
+					stack.Push(task1);
+				}
+				else
+				{
+					stack.Push(task1);
+					stack.Push(task2);
+				}
+			}
+			else if (hit1)
+			{
+				stack.Push(task1);
+			}
+			else if (hit2)
+			{
+				stack.Push(task2);
+			}
+		}
+	}
+
+} // namespace ECS
@@ -6,11 +6,75 @@
  * 생성자 주입 방식으로 Registry를 받아 안전성을 보장합니다.
  */
 #pragma once
+#include "ECS/Component.h"
+#include "Core/Assert.h"
 #include "Core/Types.h"
 
 namespace ECS
 {
 	class Registry;
+	class CommandBuffer;
+	class SystemManager;
+
+	/**
+	 * @brief System이 Update에서 접근하는 Component 집합 선언
+	 *
+	 * SystemManager는 이 선언으로 System 간 충돌을 판단해 의존 그래프(DAG)를 만들고,
+	 * 충돌하지 않는 System들을 Job System에서 동시에 실행합니다.
+	 *
+	 * - Read/Write 모두 없는 Component는 접근하지 않는다고 간주
+	 * - Exclusive: 모든 System과 직렬화 (선언하지 않은 System의 기본값)
+	 */
+	class SystemAccess
+	{
+	public:
+		// 읽기 전용 Component 선언
+		template<typename... Ts>
+		SystemAccess& Read()
+		{
+			(mReads.set(Internal::GetComponentId<Ts>()), ...);
+			return *this;
+		}
+
+		// 쓰기 Component 선언 (읽기 포함)
+		template<typename... Ts>
+		SystemAccess& Write()
+		{
+			(mWrites.set(Internal::GetComponentId<Ts>()), ...);
+			return *this;
+		}
+
+		// 다른 모든 System과 동시에 실행되지 않도록 지정
+		SystemAccess& Exclusive()
+		{
+			mExclusive = true;
+			return *this;
+		}
+
+		/**
+		 * @brief 두 System이 동시에 실행될 수 없는지 판단
+		 * @return 한쪽이 쓰는 Component를 다른 쪽이 읽거나 쓰면 true
+		 */
+		bool ConflictsWith(const SystemAccess& other) const
+		{
+			if (mExclusive || other.mExclusive)
+			{
+				return true;
+			}
+
+			return (mWrites & (other.mReads | other.mWrites)).any()
+				|| (other.mWrites & mReads).any();
+		}
+
+		const ComponentMask& GetReads() const { return mReads; }
+		const ComponentMask& GetWrites() const { return mWrites; }
+		bool IsExclusive() const { return mExclusive; }
+
+	private:
+		ComponentMask mReads;
+		ComponentMask mWrites;
+		bool mExclusive = false;
+	};
 
 	/**
 	 * @brief ECS System의 기본 인터페이스
@@ -63,6 +127,21 @@ namespace ECS
 		 */
 		virtual void Update(Core::float32 deltaTime) = 0;
 
+		/**
+		 * @brief Update에서 접근하는 Component 선언
+		 *
+		 * 등록 시 한 번 호출됩니다. 재정의하지 않으면 Exclusive로 취급되어
+		 * 다른 System과 병렬 실행되지 않습니다 (등록 순서대로 직렬 실행).
+		 *
+		 * @param access 선언을 기록할 객체
+		 * @example
+		 * void CameraSystem::DeclareAccess(SystemAccess& access) const
+		 * {
+		 *     access.Read<TransformComponent>().Write<CameraComponent>();
+		 * }
+		 */
+		virtual void DeclareAccess(SystemAccess& access) const { access.Exclusive(); }
+
 		/**
 		 * @brief System 종료
 		 *
@@ -95,8 +174,35 @@ namespace ECS
 		Registry* GetRegistry() { return mRegistry; }
 		const Registry* GetRegistry() const { return mRegistry; }
 
+		/**
+		 * @brief 지연 구조 변경용 CommandBuffer 접근자
+		 *
+		 * Update 중 Entity 생성/삭제, Component 추가/제거는 Registry 대신 여기에 기록합니다.
+		 * 기록된 명령은 SystemManager의 동기화 지점에서 적용됩니다.
+		 *
+		 * @return 이 System 전용 CommandBuffer (SystemManager 등록 후 유효)
+		 */
+		CommandBuffer& GetCommandBuffer()
+		{
+			CORE_ASSERT(mCommandBuffer != nullptr, "System is not registered to a SystemManager");
+			return *mCommandBuffer;
+		}
+
+		/**
+		 * @brief 이전 Update가 끝난 시점의 변경 틱
+		 *
+		 * Changed<T>/Added<T> 필터에 넘기면 "지난 실행 이후 바뀐 Entity"만 처리할 수 있습니다.
+		 * 이 System이 Update 중에 기록한 변경은 포함되지 않습니다 (자기 출력을 다시 처리하지 않음).
+		 * 처음 실행될 때는 0이므로 모든 Entity가 변경된 것으로 취급됩니다.
+		 */
+		Core::uint32 GetLastRunTick() const { return mLastRunTick; }
+
 	private:
+		friend class SystemManager;
+
 		Registry* mRegistry;    // 항상 유효 (생성자에서 보장)
+		CommandBuffer* mCommandBuffer = nullptr;    // SystemManager가 등록 시 설정
+		Core::uint32 mLastRunTick = 0;              // SystemManager가 Update 후 갱신
 		bool mIsActive = true;
 	};
 
@@ -1,87 +1,52 @@
 ﻿#pragma once
+#include "ECS/Component.h"
+#include "ECS/ComponentStorage.h"
 #include "ECS/Entity.h"
 #include "Core/Assert.h"
 #include "Core/Types.h"
+#include <array>
+#include <atomic>
 #include <memory>
-#include <queue>
-#include <typeindex>
-#include <unordered_map>
+#include <mutex>
+#include <span>
 #include <vector>
 
 namespace ECS
 {
+	// ParallelEach 기본 분할 단위 (Job 하나가 처리할 최소 Entity 수)
+	constexpr Core::uint32 DEFAULT_PARALLEL_GRAIN_SIZE = 64;
+
 	template<typename... Components>
 	class RegistryView;
 
-	// 컴포넌트 저장소 인터페이스 (타입 소거)
-	class IComponentStorage
+	template<typename... Components>
+	class ArchetypeGroup;
+
+	/**
+	 * @brief Archetype 그룹 내부 데이터
+	 *
+	 * 그룹이 소유한 저장소들은 Dense 배열 앞쪽 [0, size)에
+	 * 모든 Component를 가진 Entity만 같은 순서로 패킹됩니다.
+	 */
+	struct ArchetypeGroupData
 	{
-	public:
-		virtual ~IComponentStorage() = default;
-		virtual void RemoveComponent(Core::uint32 entityId) = 0;
-		virtual bool HasComponent(Core::uint32 entityId) const = 0;
+		std::vector<IComponentStorage*> storages;          // 소유 저장소 (Component 순서)
+		ComponentMask mask;                                // 그룹 Component 시그니처
+		Core::uint32 size = 0;                             // 패킹된 Entity 수
 	};
 
-	// 특정 타입의 컴포넌트 저장소
-	template<typename T>
-	class ComponentStorage : public IComponentStorage
+	/**
+	 * @brief 캐시된 View 쿼리 데이터
+	 *
+	 * Component 추가/제거 시점에 Registry가 매칭 목록을 증분 갱신하므로
+	 * View 생성 비용은 O(1), 순회 비용은 O(매칭 Entity 수)입니다.
+	 */
+	struct QueryData
 	{
-	public:
-		ComponentStorage() = default;
-		~ComponentStorage() override = default;
-
-		// 컴포넌트 추가
-		T* AddComponent(Core::uint32 entityId, const T& component)
-		{
-			mComponents[entityId] = component;
-			return &mComponents[entityId];
-		}
-
-		// 컴포넌트 추가 (이동 의미론)
-		T* AddComponent(Core::uint32 entityId, T&& component)
-		{
-			mComponents[entityId] = std::move(component);
-			return &mComponents[entityId];
-		}
-
-		// 컴포넌트 제거
-		void RemoveComponent(Core::uint32 entityId) override
-		{
-			mComponents.erase(entityId);
-		}
-
-		// 컴포넌트 조회
-		T* GetComponent(Core::uint32 entityId)
-		{
-			auto it = mComponents.find(entityId);
-			return (it != mComponents.end()) ? &it->second : nullptr;
-		}
-
-		const T* GetComponent(Core::uint32 entityId) const
-		{
-			auto it = mComponents.find(entityId);
-			return (it != mComponents.end()) ? &it->second : nullptr;
-		}
-
-		// 컴포넌트 존재 여부
-		bool HasComponent(Core::uint32 entityId) const override
-		{
-			return mComponents.find(entityId) != mComponents.end();
-		}
-
-		// 모든 컴포넌트 순회
-		std::unordered_map<Core::uint32, T>& GetAllComponents()
-		{
-			return mComponents;
-		}
-
-		const std::unordered_map<Core::uint32, T>& GetAllComponents() const
-		{
-			return mComponents;
-		}
-
-	private:
-		std::unordered_map<Core::uint32, T> mComponents;
+		std::vector<IComponentStorage*> storages;          // 쿼리 조건 저장소
+		ComponentMask mask;                                // 쿼리 Component 시그니처
+		std::vector<Core::uint32> entityIds;               // 매칭 Entity ID (순서 무관)
+		std::vector<Core::uint32> positions;               // Entity ID -> entityIds 인덱스 (INVALID_INDEX = 미포함)
 	};
 
 	// Registry: ECS의 중앙 관리자
@@ -96,6 +61,22 @@ namespace ECS
 		void DestroyEntity(Entity entity);
 		bool IsEntityValid(Entity entity) const;
 
+		/**
+		 * @brief Entity 일괄 생성
+		 *
+		 * 내부 테이블을 한 번만 확장하고 재활용 ID부터 채웁니다.
+		 *
+		 * @param count 생성할 Entity 수
+		 * @param outEntities 생성된 Entity를 받을 버퍼 (count 이상 크기)
+		 */
+		void CreateEntities(Core::uint32 count, std::span<Entity> outEntities);
+
+		/**
+		 * @brief Entity 일괄 삭제
+		 * @param entities 삭제할 Entity 목록 (모두 유효해야 하며 중복 불가)
+		 */
+		void DestroyEntities(std::span<const Entity> entities);
+
 		// Component 추가
 		template<typename T>
 		T* AddComponent(Entity entity, const T& component);
@@ -103,10 +84,37 @@ namespace ECS
 		template<typename T>
 		T* AddComponent(Entity entity, T&& component);
 
+		/**
+		 * @brief 여러 Entity에 같은 타입의 Component 일괄 추가
+		 *
+		 * 저장소를 한 번만 예약하고 모두 삽입한 뒤,
+		 * 그룹/캐시된 쿼리를 한 번의 패스로 갱신합니다.
+		 *
+		 * @param entities 대상 Entity 목록
+		 * @param components entities와 같은 순서의 Component 초기값
+		 * @example
+		 * registry.AddComponents<TransformComponent>(entities, transforms);
+		 */
+		template<typename T>
+		void AddComponents(std::span<const Entity> entities, std::span<const T> components);
+
+		// 여러 Entity에 같은 초기값의 Component 일괄 추가
+		template<typename T>
+		void AddComponents(std::span<const Entity> entities, const T& component);
+
 		// Component 제거
 		template<typename T>
 		void RemoveComponent(Entity entity);
 
+		/**
+		 * @brief T 제거 직전(RemoveComponent, DestroyEntity) 호출할 훅 등록
+		 *
+		 * Component가 다른 Entity를 참조하는 경우(계층 링크 등) 담당 System이 참조를 정리할 때 사용합니다.
+		 * 저장소당 하나만 등록할 수 있으며, hook에 nullptr을 넘기면 해제합니다.
+		 */
+		template<typename T>
+		void SetRemoveHook(ComponentRemoveHook hook, void* context);
+
 		// Component 조회
 		template<typename T>
 		T* GetComponent(Entity entity);
@@ -118,12 +126,71 @@ namespace ECS
 		template<typename T>
 		bool HasComponent(Entity entity) const;
 
+		//=====================================================================
+		// 변경 추적 (Change Tick)
+		//=====================================================================
+
+		/**
+		 * @brief 현재 변경 틱
+		 *
+		 * Component 추가/변경 시 이 값이 저장소에 기록됩니다.
+		 * SystemManager가 System 실행마다, 그리고 프레임 끝에 증가시킵니다.
+		 */
+		Core::uint32 GetChangeTick() const { return mChangeTick.load(std::memory_order_acquire); }
+
+		// 변경 틱 증가 후 새 값 반환
+		Core::uint32 AdvanceChangeTick() { return mChangeTick.fetch_add(1, std::memory_order_acq_rel) + 1; }
+
+		/**
+		 * @brief Component 값이 변경되었음을 기록
+		 *
+		 * GetComponent/View로 얻은 참조를 직접 수정한 경우 호출해야
+		 * Changed<T> 필터와 변경 기반 캐시가 변경을 감지합니다.
+		 * 서로 다른 Entity에 대해서는 병렬 호출이 안전합니다 (ParallelEach 내부 등).
+		 */
+		template<typename T>
+		void MarkChanged(Entity entity);
+
+		// sinceTick 이후 추가된 Component인지 확인
+		template<typename T>
+		bool IsAdded(Entity entity, Core::uint32 sinceTick) const;
+
+		// sinceTick 이후 추가 또는 변경된 Component인지 확인
+		template<typename T>
+		bool IsChanged(Entity entity, Core::uint32 sinceTick) const;
+
+		/**
+		 * @brief sinceTick 이후 T 저장소에 추가/변경/제거가 하나라도 있었는지 확인
+		 *
+		 * Entity를 순회하지 않는 O(1) 검사입니다. 정적인 씬에서 전체 처리를 건너뛸 때 사용합니다.
+		 */
+		template<typename T>
+		bool HasChangesSince(Core::uint32 sinceTick) const;
+
+		// sinceTick 이후 T가 추가/제거(구조 변경)되었는지 확인
+		template<typename T>
+		bool HasStructuralChangesSince(Core::uint32 sinceTick) const;
+
 		// 모든 Entity 조회 (디버깅용)
 		const std::vector<Entity>& GetAllEntities() const { return mEntities; }
 
+		// ID로 현재 버전의 Entity 조회 (저장소 순회 결과를 Entity로 변환할 때 사용)
+		Entity GetEntityById(Core::uint32 entityId) const
+		{
+			CORE_ASSERT(entityId < mVersions.size(), "Invalid entity id");
+			return Entity{ entityId, mVersions[entityId] };
+		}
+
+		// Entity가 가진 Component 시그니처 조회
+		const ComponentMask& GetComponentMask(Entity entity) const
+		{
+			CORE_ASSERT(IsEntityValid(entity), "Invalid entity");
+			return mSignatures[entity.id];
+		}
+
 		// 통계
 		Core::uint32 GetEntityCount() const { return static_cast<Core::uint32>(mEntities.size()); }
-		Core::uint32 GetRecycledCount() const { return static_cast<Core::uint32>(mFreeIds.size()); }
+		Core::uint32 GetRecycledCount() const { return mFreeCount; }
 
 		/**
 		 * @brief 특정 Component 조합을 가진 Entity들을 조회
@@ -142,16 +209,79 @@ namespace ECS
 		template<typename... Components>
 		RegistryView<Components...> CreateView();
 
+		/**
+		 * @brief 특정 Component 조합의 Archetype 그룹 조회 (없으면 생성)
+		 *
+		 * 그룹은 Components의 저장소를 소유하고, 모든 Component를 가진 Entity를
+		 * 각 저장소 Dense 배열 앞쪽에 같은 순서로 패킹해 둡니다.
+		 * 따라서 순회 시 HasComponent 검사 없이 연속 메모리만 읽습니다.
+		 *
+		 * @tparam Components 그룹을 구성할 Component 타입들
+		 * @return 그룹 핸들 (매 프레임 다시 얻어도 비용이 작음)
+		 *
+		 * @note 구현은 ArchetypeGroup.h
+		 * @warning 한 저장소는 하나의 그룹만 소유할 수 있음
+		 *          (예: RenderableArchetype 그룹과 CameraArchetype 그룹은 동시에 만들 수 없음)
+		 */
+		template<typename... Components>
+		ArchetypeGroup<Components...> GetGroup();
+
 	private:
 		// Entity 관리
-		std::vector<Entity> mEntities;                     // 활성 Entity 목록
-		std::queue<Core::uint32> mFreeIds;                 // 재활용 가능한 ID 풀
-		std::vector<Core::uint32> mVersions;               // 각 ID의 현재 버전
+		static constexpr Core::uint32 INVALID_ENTITY_ID = UINT32_MAX;
+
+		std::vector<Entity> mEntities;                     // 활성 Entity 목록 (삭제 시 swap-and-pop)
+		std::vector<Core::uint32> mVersions;               // 각 ID의 현재 버전 (삭제 시 증가)
+		std::vector<Core::uint32> mEntitySlots;            // 살아있는 ID: mEntities 인덱스 / 삭제된 ID: 다음 free ID
+		std::vector<ComponentMask> mSignatures;            // 각 ID가 가진 Component 시그니처
 
+		Core::uint32 mFreeListHead = INVALID_ENTITY_ID;    // 재활용 ID 목록 (intrusive free list) 머리
+		Core::uint32 mFreeCount = 0;                       // 재활용 대기 ID 수
 		Core::uint32 mNextEntityId = 0;                    // 다음 할당할 ID
 
-		// Component Storage 관리
-		std::unordered_map<std::type_index, std::unique_ptr<IComponentStorage>> mComponentStorages;
+		// 변경 틱 (0은 "아직 실행 안 함"을 뜻하므로 1부터 시작)
+		std::atomic<Core::uint32> mChangeTick{ 1 };
+
+		// Component Storage 관리 (Component ID로 인덱싱, 미사용 슬롯은 nullptr)
+		// 고정 크기이므로 저장소 생성이 테이블을 재할당하지 않아 병렬 System의 조회와 충돌하지 않음
+		std::array<std::unique_ptr<IComponentStorage>, MAX_COMPONENT_TYPES> mComponentStorages;
+
+		// Archetype 그룹 관리 (그룹 ID로 인덱싱)
+		std::vector<std::unique_ptr<ArchetypeGroupData>> mGroups;
+
+		// 캐시된 View 쿼리 관리 (쿼리 ID로 인덱싱)
+		std::vector<std::unique_ptr<QueryData>> mQueries;
+
+		// 병렬 System에서 View/그룹을 동시에 조회할 때 캐시 테이블 보호
+		std::mutex mCacheMutex;
+
+		// 저장소에 Component가 추가된 직후 / 제거되기 직전에 그룹과 쿼리 갱신
+		void OnComponentAdded(IComponentStorage& storage, Core::uint32 entityId);
+		void OnComponentRemoving(IComponentStorage& storage, Core::uint32 entityId);
+
+		// 일괄 추가 후 그룹과 쿼리를 한 번에 갱신
+		void OnComponentsAdded(IComponentStorage& storage, std::span<const Entity> entities);
+
+		// 그룹 멤버십 갱신
+		void AddToGroup(ArchetypeGroupData& group, Core::uint32 entityId);
+		void RemoveFromGroup(ArchetypeGroupData& group, Core::uint32 entityId);
+
+		// 새 그룹의 저장소 소유권 설정 및 기존 Entity 패킹
+		void InitializeGroup(ArchetypeGroupData& group);
+
+		// 쿼리 매칭 목록 갱신
+		void AddToQuery(QueryData& query, Core::uint32 entityId);
+		void RemoveFromQuery(QueryData& query, Core::uint32 entityId);
+
+		// 새 쿼리의 저장소 등록 및 기존 Entity 수집
+		void InitializeQuery(QueryData& query);
+
+		// View용 캐시 쿼리 조회 (없으면 생성, 구현은 RegistryView.h)
+		template<typename... Components>
+		const QueryData& GetOrCreateQuery();
+
+		template<typename... Components>
+		friend class RegistryView;
 
 		// Component Storage 가져오기 (없으면 생성)
 		template<typename T>
@@ -171,38 +301,34 @@ namespace ECS
 	template<typename T>
 	ComponentStorage<T>* Registry::GetOrCreateStorage()
 	{
-		std::type_index typeIndex(typeid(T));
+		const Core::uint32 componentId = Internal::GetComponentId<T>();
+		CORE_ASSERT(componentId < MAX_COMPONENT_TYPES, "Too many component types (increase MAX_COMPONENT_TYPES)");
 
-		auto it = mComponentStorages.find(typeIndex);
-		if (it == mComponentStorages.end())
+		auto& storage = mComponentStorages[componentId];
+		if (!storage)
 		{
-			auto storage = std::make_unique<ComponentStorage<T>>();
-			auto* ptr = storage.get();
-			mComponentStorages[typeIndex] = std::move(storage);
-			return ptr;
+			storage = std::make_unique<ComponentStorage<T>>();
 		}
 
-		return static_cast<ComponentStorage<T>*>(it->second.get());
+		return static_cast<ComponentStorage<T>*>(storage.get());
 	}
 
 	template<typename T>
 	ComponentStorage<T>* Registry::GetStorage()
 	{
-		std::type_index typeIndex(typeid(T));
-		auto it = mComponentStorages.find(typeIndex);
+		const Core::uint32 componentId = Internal::GetComponentId<T>();
 
-		CORE_ASSERT(it != mComponentStorages.end(), "Component storage does not exist");
-		return static_cast<ComponentStorage<T>*>(it->second.get());
+		CORE_ASSERT(componentId < MAX_COMPONENT_TYPES && mComponentStorages[componentId], "Component storage does not exist");
+		return static_cast<ComponentStorage<T>*>(mComponentStorages[componentId].get());
 	}
 
 	template<typename T>
 	const ComponentStorage<T>* Registry::GetStorage() const
 	{
-		std::type_index typeIndex(typeid(T));
-		auto it = mComponentStorages.find(typeIndex);
+		const Core::uint32 componentId = Internal::GetComponentId<T>();
 
-		CORE_ASSERT(it != mComponentStorages.end(), "Component storage does not exist");
-		return static_cast<const ComponentStorage<T>*>(it->second.get());
+		CORE_ASSERT(componentId < MAX_COMPONENT_TYPES && mComponentStorages[componentId], "Component storage does not exist");
+		return static_cast<const ComponentStorage<T>*>(mComponentStorages[componentId].get());
 	}
 
 	template<typename T>
@@ -211,7 +337,17 @@ namespace ECS
 		CORE_ASSERT(IsEntityValid(entity), "Invalid entity");
 
 		auto* storage = GetOrCreateStorage<T>();
-		return storage->AddComponent(entity.id, component);
+		T* result = storage->AddComponent(entity.id, component, GetChangeTick());
+		mSignatures[entity.id].set(Internal::GetComponentId<T>());
+
+		if (storage->HasListeners())
+		{
+			// 그룹 패킹으로 위치가 바뀔 수 있으므로 다시 조회
+			OnComponentAdded(*storage, entity.id);
+			result = storage->GetComponent(entity.id);
+		}
+
+		return result;
 	}
 
 	template<typename T>
@@ -220,7 +356,63 @@ namespace ECS
 		CORE_ASSERT(IsEntityValid(entity), "Invalid entity");
 
 		auto* storage = GetOrCreateStorage<T>();
-		return storage->AddComponent(entity.id, std::move(component));
+		T* result = storage->AddComponent(entity.id, std::move(component), GetChangeTick());
+		mSignatures[entity.id].set(Internal::GetComponentId<T>());
+
+		if (storage->HasListeners())
+		{
+			// 그룹 패킹으로 위치가 바뀔 수 있으므로 다시 조회
+			OnComponentAdded(*storage, entity.id);
+			result = storage->GetComponent(entity.id);
+		}
+
+		return result;
+	}
+
+	template<typename T>
+	void Registry::AddComponents(std::span<const Entity> entities, std::span<const T> components)
+	{
+		CORE_ASSERT(entities.size() == components.size(), "Entity and component counts must match");
+
+		auto* storage = GetOrCreateStorage<T>();
+		storage->Reserve(storage->Size() + entities.size());
+
+		const Core::uint32 componentId = Internal::GetComponentId<T>();
+		const Core::uint32 tick = GetChangeTick();
+		for (size_t i = 0; i < entities.size(); ++i)
+		{
+			CORE_ASSERT(IsEntityValid(entities[i]), "Invalid entity");
+
+			storage->AddComponent(entities[i].id, components[i], tick);
+			mSignatures[entities[i].id].set(componentId);
+		}
+
+		if (storage->HasListeners())
+		{
+			OnComponentsAdded(*storage, entities);
+		}
+	}
+
+	template<typename T>
+	void Registry::AddComponents(std::span<const Entity> entities, const T& component)
+	{
+		auto* storage = GetOrCreateStorage<T>();
+		storage->Reserve(storage->Size() + entities.size());
+
+		const Core::uint32 componentId = Internal::GetComponentId<T>();
+		const Core::uint32 tick = GetChangeTick();
+		for (const Entity& entity : entities)
+		{
+			CORE_ASSERT(IsEntityValid(entity), "Invalid entity");
+
+			storage->AddComponent(entity.id, component, tick);
+			mSignatures[entity.id].set(componentId);
+		}
+
+		if (storage->HasListeners())
+		{
+			OnComponentsAdded(*storage, entities);
+		}
 	}
 
 	template<typename T>
@@ -228,8 +420,34 @@ namespace ECS
 	{
 		CORE_ASSERT(IsEntityValid(entity), "Invalid entity");
 
+		const Core::uint32 componentId = Internal::GetComponentId<T>();
+		if (!mSignatures[entity.id].test(componentId))
+		{
+			return;
+		}
+
 		auto* storage = GetStorage<T>();
+		if (storage->HasRemoveHook())
+		{
+			storage->InvokeRemoveHook(entity);
+		}
+
+		if (storage->HasListeners())
+		{
+			OnComponentRemoving(*storage, entity.id);
+		}
+
 		storage->RemoveComponent(entity.id);
+		storage->NoteStructuralChange(GetChangeTick());
+		mSignatures[entity.id].reset(componentId);
+	}
+
+	template<typename T>
+	void Registry::SetRemoveHook(ComponentRemoveHook hook, void* context)
+	{
+		auto* storage = GetOrCreateStorage<T>();
+		CORE_ASSERT(!hook || !storage->HasRemoveHook(), "Remove hook already registered for this component");
+		storage->SetRemoveHook(hook, context);
 	}
 
 	template<typename T>
@@ -259,20 +477,72 @@ namespace ECS
 	template<typename T>
 	bool Registry::HasComponent(Entity entity) const
 	{
-		if (!IsEntityValid(entity))
+		// 시그니처 범위를 벗어난 ID는 어떤 Entity도 가질 수 없음 (bitset::test 예외 방지)
+		const Core::uint32 componentId = Internal::GetComponentId<T>();
+		if (componentId >= MAX_COMPONENT_TYPES || !IsEntityValid(entity))
+		{
+			return false;
+		}
+
+		// 저장소 가상 호출 없이 시그니처 비트만 확인
+		return mSignatures[entity.id].test(componentId);
+	}
+
+	template<typename T>
+	void Registry::MarkChanged(Entity entity)
+	{
+		CORE_ASSERT(HasComponent<T>(entity), "Entity does not have the component");
+
+		auto* storage = GetStorage<T>();
+		storage->MarkChanged(storage->GetDenseIndex(entity.id), GetChangeTick());
+	}
+
+	template<typename T>
+	bool Registry::IsAdded(Entity entity, Core::uint32 sinceTick) const
+	{
+		if (!HasComponent<T>(entity))
 		{
 			return false;
 		}
 
-		std::type_index typeIndex(typeid(T));
-		auto it = mComponentStorages.find(typeIndex);
+		const auto* storage = GetStorage<T>();
+		return IsNewerTick(storage->GetAddedTick(storage->GetDenseIndex(entity.id)), sinceTick);
+	}
+
+	template<typename T>
+	bool Registry::IsChanged(Entity entity, Core::uint32 sinceTick) const
+	{
+		if (!HasComponent<T>(entity))
+		{
+			return false;
+		}
 
-		if (it == mComponentStorages.end())
+		const auto* storage = GetStorage<T>();
+		return IsNewerTick(storage->GetChangedTick(storage->GetDenseIndex(entity.id)), sinceTick);
+	}
+
+	template<typename T>
+	bool Registry::HasChangesSince(Core::uint32 sinceTick) const
+	{
+		const Core::uint32 componentId = Internal::GetComponentId<T>();
+		if (componentId >= MAX_COMPONENT_TYPES || !mComponentStorages[componentId])
+		{
+			return false;
+		}
+
+		return IsNewerTick(mComponentStorages[componentId]->GetLastWriteTick(), sinceTick);
+	}
+
+	template<typename T>
+	bool Registry::HasStructuralChangesSince(Core::uint32 sinceTick) const
+	{
+		const Core::uint32 componentId = Internal::GetComponentId<T>();
+		if (componentId >= MAX_COMPONENT_TYPES || !mComponentStorages[componentId])
 		{
 			return false;
 		}
 
-		return it->second->HasComponent(entity.id);
+		return IsNewerTick(mComponentStorages[componentId]->GetLastStructuralTick(), sinceTick);
 	}
 
 } // namespace ECS
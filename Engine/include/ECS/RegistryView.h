@@ -1,65 +1,331 @@
 ﻿#pragma once
 #include "ECS/Registry.h"
+#include "Core/Jobs/JobSystem.h"
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace ECS
 {
+	/**
+	 * @brief View 필터: sinceTick 이후 T가 추가된 Entity만
+	 */
+	template<typename T>
+	struct Added
+	{
+	};
+
+	/**
+	 * @brief View 필터: sinceTick 이후 T가 추가되었거나 변경(MarkChanged)된 Entity만
+	 */
+	template<typename T>
+	struct Changed
+	{
+	};
+
+	namespace Internal
+	{
+		template<typename Filter>
+		struct ChangeFilterTraits;
+
+		template<typename T>
+		struct ChangeFilterTraits<Added<T>>
+		{
+			using Component = T;
+			static Core::uint32 GetTick(const ComponentStorage<T>& storage, Core::uint32 denseIndex) { return storage.GetAddedTick(denseIndex); }
+		};
+
+		template<typename T>
+		struct ChangeFilterTraits<Changed<T>>
+		{
+			using Component = T;
+			static Core::uint32 GetTick(const ComponentStorage<T>& storage, Core::uint32 denseIndex) { return storage.GetChangedTick(denseIndex); }
+		};
+	}
+
 	/**
 	 * @brief Component 조합 쿼리를 위한 View 클래스
 	 *
 	 * 여러 Component를 동시에 가진 Entity만 순회합니다.
+	 * 매칭 목록은 Registry에 등록된 캐시 쿼리가 Component 추가/제거 시점에
+	 * 증분 갱신하므로, View 생성은 O(1)이고 순회는 O(매칭 Entity 수)입니다.
 	 *
 	 * @example
-	 * auto view = registry.RegistryView<TransformComponent, MeshComponent>();
+	 * auto view = registry.CreateView<TransformComponent, MeshComponent>();
+	 *
+	 * // 콜백 순회
+	 * view.Each([](Entity entity, TransformComponent& transform, MeshComponent& mesh)
+	 * {
+	 *     // ...
+	 * });
+	 *
+	 * // Structured binding 순회 (break/continue 가능)
+	 * for (auto [entity, transform, mesh] : view.Each())
+	 * {
+	 *     // ...
+	 * }
+	 *
+	 * // Entity만 순회
 	 * for (Entity entity : view)
 	 * {
-	 *     auto* transform = registry.GetComponent<TransformComponent>(entity);
-	 *     auto* mesh = registry.GetComponent<MeshComponent>(entity);
 	 *     // ...
 	 * }
+	 *
+	 * // 마지막 실행 이후 Transform이 바뀐 Entity만 순회
+	 * view.Each<Changed<TransformComponent>>(GetLastRunTick(), [](Entity entity, TransformComponent& transform, MeshComponent& mesh)
+	 * {
+	 *     // ...
+	 * });
+	 *
+	 * @warning View는 스냅샷이 아닙니다. 순회 중 조건 Component를 추가/제거하거나
+	 *          Entity를 삭제하면 순회가 무효화됩니다.
 	 */
 	template<typename... Components>
 	class RegistryView
 	{
 	public:
+		// 매칭 Entity ID 목록을 Entity로 변환하며 순회하는 Iterator
+		class Iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = Entity;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const Entity*;
+			using reference = Entity;
+
+			Iterator(const Registry* registry, const Core::uint32* current)
+				: mRegistry(registry)
+				, mCurrent(current)
+			{
+			}
+
+			Entity operator*() const { return mRegistry->GetEntityById(*mCurrent); }
+
+			Iterator& operator++()
+			{
+				++mCurrent;
+				return *this;
+			}
+
+			Iterator operator++(int)
+			{
+				Iterator temp = *this;
+				++mCurrent;
+				return temp;
+			}
+
+			bool operator==(const Iterator& other) const { return mCurrent == other.mCurrent; }
+			bool operator!=(const Iterator& other) const { return mCurrent != other.mCurrent; }
+
+		private:
+			const Registry* mRegistry;
+			const Core::uint32* mCurrent;
+		};
+
+		using StorageTuple = std::tuple<ComponentStorage<Components>*...>;
+
+		// (Entity, Component 참조...) tuple을 순회하는 Iterator
+		class EachIterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = std::tuple<Entity, Components&...>;
+			using difference_type = std::ptrdiff_t;
+			using pointer = void;
+			using reference = value_type;
+
+			EachIterator(const Registry* registry, const Core::uint32* current, const StorageTuple& storages)
+				: mRegistry(registry)
+				, mCurrent(current)
+				, mStorages(storages)
+			{
+			}
+
+			value_type operator*() const
+			{
+				const Core::uint32 entityId = *mCurrent;
+				return std::apply([&](auto*... storages)
+					{
+						return value_type(mRegistry->GetEntityById(entityId), *storages->GetComponent(entityId)...);
+					}, mStorages);
+			}
+
+			EachIterator& operator++()
+			{
+				++mCurrent;
+				return *this;
+			}
+
+			bool operator==(const EachIterator& other) const { return mCurrent == other.mCurrent; }
+			bool operator!=(const EachIterator& other) const { return mCurrent != other.mCurrent; }
+
+		private:
+			const Registry* mRegistry;
+			const Core::uint32* mCurrent;
+			StorageTuple mStorages;
+		};
+
+		// Each()가 반환하는 range
+		class EachRange
+		{
+		public:
+			EachRange(EachIterator first, EachIterator last)
+				: mBegin(first)
+				, mEnd(last)
+			{
+			}
+
+			EachIterator begin() const { return mBegin; }
+			EachIterator end() const { return mEnd; }
+
+		private:
+			EachIterator mBegin;
+			EachIterator mEnd;
+		};
+
 		RegistryView(Registry* registry)
 			: mRegistry(registry)
+			, mQuery(&registry->GetOrCreateQuery<Components...>())
+			, mStorages(GetQueryStorages(*mQuery, std::index_sequence_for<Components...>{}))
 		{
-			CollectEntities();
 		}
 
 		// Iterator 인터페이스
-		std::vector<Entity>::iterator begin() { return mEntities.begin(); }
-		std::vector<Entity>::iterator end() { return mEntities.end(); }
-		std::vector<Entity>::const_iterator begin() const { return mEntities.begin(); }
-		std::vector<Entity>::const_iterator end() const { return mEntities.end(); }
+		Iterator begin() const { return Iterator(mRegistry, mQuery->entityIds.data()); }
+		Iterator end() const { return Iterator(mRegistry, mQuery->entityIds.data() + mQuery->entityIds.size()); }
 
 		// 결과 개수
-		size_t size() const { return mEntities.size(); }
-		bool empty() const { return mEntities.empty(); }
+		size_t size() const { return mQuery->entityIds.size(); }
+		bool empty() const { return mQuery->entityIds.empty(); }
 
-	private:
-		void CollectEntities()
+		/**
+		 * @brief 매칭 Entity를 Component 참조와 함께 순회
+		 *
+		 * 저장소 포인터는 View 생성 시 한 번만 조회하고, 순회 중에는
+		 * Sparse 인덱스로 Component를 바로 읽습니다 (타입 해시 조회 없음).
+		 *
+		 * @param func void(Entity, Components&...) 형태의 호출 가능 객체
+		 */
+		template<typename Func>
+		void Each(Func&& func) const
 		{
-			// 모든 활성 Entity를 순회
-			for (const Entity& entity : mRegistry->GetAllEntities())
-			{
-				// 모든 Component를 가지고 있는지 확인
-				if (HasAllComponents(entity))
+			std::apply([&](auto*... storages)
 				{
-					mEntities.push_back(entity);
-				}
+					for (Core::uint32 entityId : mQuery->entityIds)
+					{
+						func(mRegistry->GetEntityById(entityId), *storages->GetComponent(entityId)...);
+					}
+				}, mStorages);
+		}
+
+		/**
+		 * @brief Each의 병렬 버전 (Core::Jobs::ParallelFor 기반)
+		 *
+		 * 매칭 Entity 목록을 grainSize 단위로 나누어 여러 스레드에서 func를 호출합니다.
+		 * JobSystem이 없으면 직렬로 실행됩니다.
+		 *
+		 * @param func void(Entity, Components&...) 형태의 호출 가능 객체 (스레드 안전해야 함)
+		 * @param grainSize Job 하나가 처리할 최소 Entity 수
+		 * @warning func 안에서 Registry 구조 변경 금지 (Entity 생성/삭제, Component 추가/제거)
+		 */
+		template<typename Func>
+		void ParallelEach(Func&& func, Core::uint32 grainSize = DEFAULT_PARALLEL_GRAIN_SIZE) const
+		{
+			const Core::uint32* entityIds = mQuery->entityIds.data();
+			const Core::uint32 count = static_cast<Core::uint32>(mQuery->entityIds.size());
+
+			std::apply([&](auto*... storages)
+				{
+					Core::Jobs::ParallelFor(count, grainSize, [&](Core::uint32 index)
+						{
+							const Core::uint32 entityId = entityIds[index];
+							func(mRegistry->GetEntityById(entityId), *storages->GetComponent(entityId)...);
+						});
+				}, mStorages);
+		}
+
+		/**
+		 * @brief 변경 필터를 통과한 Entity만 순회
+		 *
+		 * 필터가 여러 개면 모두 만족해야 합니다 (AND).
+		 * 필터 대상 저장소에 sinceTick 이후 쓰기가 전혀 없으면 순회 없이 바로 반환합니다.
+		 *
+		 * @tparam Filters Added<T> / Changed<T> (T는 View의 Component 중 하나)
+		 * @param sinceTick 기준 틱 (보통 ISystem::GetLastRunTick())
+		 * @param func void(Entity, Components&...) 형태의 호출 가능 객체
+		 */
+		template<typename... Filters, typename Func>
+		void Each(Core::uint32 sinceTick, Func&& func) const
+		{
+			static_assert(sizeof...(Filters) > 0, "Each(sinceTick, func) requires at least one Added<T>/Changed<T> filter");
+			static_assert((IsViewComponent<typename Internal::ChangeFilterTraits<Filters>::Component>() && ...),
+				"Filtered component must be one of the view components");
+
+			if (!(HasWritesSince<Filters>(sinceTick) && ...))
+			{
+				return;
 			}
+
+			std::apply([&](auto*... storages)
+				{
+					for (Core::uint32 entityId : mQuery->entityIds)
+					{
+						if (!(PassesFilter<Filters>(entityId, sinceTick) && ...))
+						{
+							continue;
+						}
+
+						func(mRegistry->GetEntityById(entityId), *storages->GetComponent(entityId)...);
+					}
+				}, mStorages);
 		}
 
-		// 가변 템플릿으로 모든 Component 존재 확인
-		bool HasAllComponents(Entity entity) const
+		// (Entity, Components&...) tuple range (structured binding용)
+		EachRange Each() const
 		{
-			return (mRegistry->HasComponent<Components>(entity) && ...);
+			const Core::uint32* first = mQuery->entityIds.data();
+			const Core::uint32* last = first + mQuery->entityIds.size();
+			return EachRange(EachIterator(mRegistry, first, mStorages), EachIterator(mRegistry, last, mStorages));
+		}
+
+	private:
+		template<typename T>
+		static constexpr bool IsViewComponent()
+		{
+			return (std::is_same_v<T, Components> || ...);
+		}
+
+		// 필터 대상 저장소에 sinceTick 이후 쓰기가 있었는지 (없으면 순회 생략)
+		template<typename Filter>
+		bool HasWritesSince(Core::uint32 sinceTick) const
+		{
+			using T = typename Internal::ChangeFilterTraits<Filter>::Component;
+			return IsNewerTick(std::get<ComponentStorage<T>*>(mStorages)->GetLastWriteTick(), sinceTick);
+		}
+
+		template<typename Filter>
+		bool PassesFilter(Core::uint32 entityId, Core::uint32 sinceTick) const
+		{
+			using Traits = Internal::ChangeFilterTraits<Filter>;
+			const auto* storage = std::get<ComponentStorage<typename Traits::Component>*>(mStorages);
+			return IsNewerTick(Traits::GetTick(*storage, storage->GetDenseIndex(entityId)), sinceTick);
+		}
+
+		// 쿼리가 mCacheMutex 안에서 기록한 저장소 포인터 사용
+		// (병렬 System이 다른 저장소를 만드는 중에도 Registry의 저장소 테이블을 읽지 않음)
+		template<size_t... Indices>
+		static StorageTuple GetQueryStorages(const QueryData& query, std::index_sequence<Indices...>)
+		{
+			return StorageTuple(static_cast<ComponentStorage<Components>*>(query.storages[Indices])...);
 		}
 
 		Registry* mRegistry;
-		std::vector<Entity> mEntities;
+		const QueryData* mQuery;
+		StorageTuple mStorages;
 	};
 
 	// Registry에 RegistryView 생성 함수 추가
@@ -69,4 +335,30 @@ namespace ECS
 		return RegistryView<Components...>(this);
 	}
 
+	template<typename... Components>
+	const QueryData& Registry::GetOrCreateQuery()
+	{
+		static_assert(sizeof...(Components) > 0, "RegistryView requires at least one component type");
+
+		const Core::uint32 queryId = Internal::TypeIdGenerator<Internal::QueryFamily>::Get<RegistryView<Components...>>();
+
+		std::lock_guard<std::mutex> lock(mCacheMutex);
+
+		if (queryId >= mQueries.size())
+		{
+			mQueries.resize(static_cast<size_t>(queryId) + 1);
+		}
+
+		auto& query = mQueries[queryId];
+		if (!query)
+		{
+			query = std::make_unique<QueryData>();
+			query->storages = { GetOrCreateStorage<Components>()... };
+			query->mask = Internal::MakeComponentMask<Components...>();
+			InitializeQuery(*query);
+		}
+
+		return *query;
+	}
+
 } // namespace ECS
@@ -3,20 +3,30 @@
  * @brief ECS System들의 생명주기를 관리하는 매니저
  *
  * System 등록 시 Registry를 자동으로 주입합니다.
+ * System들이 선언한 Component 접근(SystemAccess)으로 의존 그래프를 만들어
+ * 충돌하지 않는 System을 Job System에서 병렬 실행합니다.
  */
 #pragma once
+#include "ECS/CommandBuffer.h"
 #include "ECS/ISystem.h"
+#include "ECS/TypeId.h"
 
 #include "Core/Assert.h"
 #include "Core/Logging/LogMacros.h"
 #include "Core/Types.h"
 
+#include <atomic>
 #include <memory>
-#include <typeindex>
+#include <string>
+#include <string_view>
 #include <type_traits>
-#include <unordered_map>
 #include <vector>
 
+namespace Core::Jobs
+{
+	class JobCounter;
+}
+
 namespace ECS
 {
 	class Registry;
@@ -24,9 +34,15 @@ namespace ECS
 	/**
 	 * @brief ECS System들의 생명주기를 관리하는 매니저
 	 *
-	 * System을 등록하고, 실행 순서대로 Update를 호출합니다.
+	 * System을 등록하고, 의존 그래프(DAG) 순서대로 Update를 호출합니다.
 	 * 각 System은 한 번만 등록 가능합니다.
 	 *
+	 * 스케줄링 규칙:
+	 * - 먼저 등록된 System과 접근이 충돌하면(한쪽이 쓰는 Component를 다른 쪽이 읽거나 씀)
+	 *   그 System이 끝난 뒤 실행
+	 * - 충돌이 없으면 Job System에서 동시에 실행
+	 * - DeclareAccess를 재정의하지 않은 System은 모든 System과 직렬화 (기존 등록 순서 보장)
+	 *
 	 * 생성자 주입 방식:
 	 * - RegisterSystem<T>()가 내부적으로 Registry를 첫 번째 인자로 전달
 	 * - System은 생성 시점에 유효한 Registry를 보장받음
@@ -68,12 +84,24 @@ namespace ECS
 		/**
 		 * @brief 모든 활성 System 업데이트
 		 *
-		 * 등록 순서대로 각 System의 Update를 호출합니다.
+		 * 의존 그래프에 따라 각 System의 Update를 호출하고 (JobSystem이 있으면 병렬),
+		 * 모두 끝나면 동기화 지점으로서 기록된 CommandBuffer들을 재생합니다.
+		 *
+		 * @note 병렬 실행 시 Exclusive System을 포함한 모든 Update가 임의의 Job 스레드(워커 포함)에서 호출됨
+		 *       (메인 스레드 전용 상태는 Update 밖에서 처리하거나 SetParallelUpdate(false))
 		 *
 		 * @param deltaTime 이전 프레임으로부터 경과 시간 (초)
 		 */
 		void UpdateSystems(Core::float32 deltaTime);
 
+		/**
+		 * @brief 동기화 지점: 모든 System의 CommandBuffer를 Registry에 적용
+		 *
+		 * System 등록 순서대로 각 버퍼를 재생합니다.
+		 * UpdateSystems 끝에서 자동 호출되며, 추가 동기화가 필요할 때 직접 호출할 수 있습니다.
+		 */
+		void PlaybackCommandBuffers();
+
 		/**
 		 * @brief 모든 System 종료 및 제거
 		 *
@@ -105,14 +133,67 @@ namespace ECS
 		 */
 		size_t GetSystemCount() const { return mSystems.size(); }
 
+		/**
+		 * @brief 병렬 업데이트 사용 여부 (false면 등록 순서대로 직렬 실행)
+		 */
+		void SetParallelUpdate(bool enabled) { mParallelUpdate = enabled; }
+		bool IsParallelUpdate() const { return mParallelUpdate; }
+
+		/**
+		 * @brief 현재 스케줄과 System별 마지막 Update 시간을 텍스트로 출력 (디버그용)
+		 *
+		 * 예:
+		 *   [L0] TransformSystem     0.120 ms
+		 *   [L1] CameraSystem        0.004 ms  after: TransformSystem
+		 *   [L1] LightingSystem      0.001 ms  after: TransformSystem
+		 *
+		 * 같은 레벨(L)의 System은 서로 독립이며 동시에 실행될 수 있습니다.
+		 */
+		std::string DumpSchedule() const;
+
 	private:
 		Registry* mRegistry;
 
 		// System 저장 (등록 순서 유지)
 		std::vector<std::unique_ptr<ISystem>> mSystems;
 
-		// 타입별 빠른 조회용 맵
-		std::unordered_map<std::type_index, ISystem*> mSystemMap;
+		// System별 CommandBuffer (mSystems와 같은 순서)
+		std::vector<std::unique_ptr<CommandBuffer>> mCommandBuffers;
+
+		// 스케줄 노드 (mSystems와 같은 순서)
+		struct SystemNode
+		{
+			std::string_view name;
+			SystemAccess access;
+			std::vector<Core::uint32> dependencies;     // 먼저 끝나야 하는 System 인덱스
+			std::vector<Core::uint32> dependents;       // 이 System 뒤에 실행되는 System 인덱스
+			Core::uint32 level = 0;                     // DAG 깊이 (같은 레벨은 독립)
+			Core::float64 lastUpdateMs = 0.0;           // 마지막 Update 소요 시간
+		};
+
+		std::vector<SystemNode> mNodes;
+		std::unique_ptr<std::atomic<Core::uint32>[]> mPendingDependencies;    // 프레임별 남은 선행 System 수
+		bool mScheduleDirty = true;
+		bool mParallelUpdate = true;
+
+		// 접근 선언으로 의존 그래프 재구성
+		void BuildSchedule();
+
+		// System 하나 실행 (시간 측정 포함)
+		void RunSystem(Core::uint32 index, Core::float32 deltaTime);
+
+		// System을 Job으로 제출, 끝나면 준비된 후속 System 제출
+		void ScheduleSystem(Core::uint32 index, Core::Jobs::JobCounter& counter, Core::float32 deltaTime);
+
+		// 타입별 빠른 조회용 테이블 (System ID로 인덱싱, 미등록 슬롯은 nullptr)
+		std::vector<ISystem*> mSystemLookup;
+
+		// System 타입 ID (0부터 연속)
+		template<typename T>
+		static Core::uint32 GetSystemId()
+		{
+			return Internal::TypeIdGenerator<Internal::SystemFamily>::Get<T>();
+		}
 	};
 
 	// ============================================================================
@@ -124,12 +205,13 @@ namespace ECS
 	{
 		static_assert(std::is_base_of_v<ISystem, T>, "T must inherit from ISystem");
 
-		std::type_index typeIndex(typeid(T));
+		const Core::uint32 systemId = GetSystemId<T>();
+		const std::string_view typeName = Internal::GetTypeName<T>();
 
 		// 이미 등록된 System인지 확인
-		if (mSystemMap.find(typeIndex) != mSystemMap.end())
+		if (HasSystem<T>())
 		{
-			LOG_WARN("[SystemManager] System already registered: %s", typeid(T).name());
+			LOG_WARN("[SystemManager] System already registered: %.*s", static_cast<int>(typeName.size()), typeName.data());
 			return nullptr;
 		}
 
@@ -137,14 +219,30 @@ namespace ECS
 		auto system = std::make_unique<T>(*mRegistry, std::forward<Args>(args)...);
 		T* systemPtr = system.get();
 
+		// 전용 CommandBuffer 연결 (Initialize에서도 사용 가능)
+		auto commandBuffer = std::make_unique<CommandBuffer>();
+		systemPtr->mCommandBuffer = commandBuffer.get();
+
 		// 초기화 (파라미터 없음)
 		systemPtr->Initialize();
 
 		// 저장
+		// 스케줄 노드 (접근 선언 수집)
+		SystemNode node;
+		node.name = typeName;
+		systemPtr->DeclareAccess(node.access);
+
 		mSystems.push_back(std::move(system));
-		mSystemMap[typeIndex] = systemPtr;
+		mCommandBuffers.push_back(std::move(commandBuffer));
+		mNodes.push_back(std::move(node));
+		mScheduleDirty = true;
+		if (systemId >= mSystemLookup.size())
+		{
+			mSystemLookup.resize(static_cast<size_t>(systemId) + 1, nullptr);
+		}
+		mSystemLookup[systemId] = systemPtr;
 
-		LOG_INFO("[SystemManager] System registered: %s", typeid(T).name());
+		LOG_INFO("[SystemManager] System registered: %.*s", static_cast<int>(typeName.size()), typeName.data());
 
 		return systemPtr;
 	}
@@ -154,15 +252,13 @@ namespace ECS
 	{
 		static_assert(std::is_base_of_v<ISystem, T>, "T must inherit from ISystem");
 
-		std::type_index typeIndex(typeid(T));
-		auto it = mSystemMap.find(typeIndex);
-
-		if (it == mSystemMap.end())
+		const Core::uint32 systemId = GetSystemId<T>();
+		if (systemId >= mSystemLookup.size())
 		{
 			return nullptr;
 		}
 
-		return static_cast<T*>(it->second);
+		return static_cast<T*>(mSystemLookup[systemId]);
 	}
 
 	template<typename T>
@@ -170,8 +266,8 @@ namespace ECS
 	{
 		static_assert(std::is_base_of_v<ISystem, T>, "T must inherit from ISystem");
 
-		std::type_index typeIndex(typeid(T));
-		return mSystemMap.find(typeIndex) != mSystemMap.end();
+		const Core::uint32 systemId = GetSystemId<T>();
+		return systemId < mSystemLookup.size() && mSystemLookup[systemId] != nullptr;
 	}
 
 } // namespace ECS
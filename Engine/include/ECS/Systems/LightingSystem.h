@@ -29,6 +29,7 @@ namespace ECS
 
 		void Initialize() override;
 		void Update(Core::float32 deltaTime) override;
+		void DeclareAccess(SystemAccess& access) const override;
 		void Shutdown() override;
 
 		//=====================================================================
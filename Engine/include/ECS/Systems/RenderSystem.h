@@ -1,7 +1,9 @@
 ﻿#pragma once
 #include "ECS/ISystem.h"
 #include "Core/Types.h"
+#include "Graphics/RenderQueue.h"
 #include "Graphics/RenderTypes.h"
+#include <vector>
 
 namespace Framework
 {
@@ -15,6 +17,15 @@ namespace ECS
 	 *
 	 * Renderable Entity들을 순회하여 FrameData를 구성합니다.
 	 * CameraSystem, LightingSystem과 협력합니다.
+	 *
+	 * BoundsComponent가 있는 Entity는 렌더 아이템을 만들기 전에 Main Camera 절두체로 컬링합니다.
+	 * (BoundsComponent가 없으면 항상 보이는 것으로 취급)
+	 *
+	 * 렌더 아이템마다 64비트 정렬 키를 만들어 기수 정렬하고, 블렌딩 Material은 transparentItems로 분리합니다.
+	 * (불투명: 상태 순 + 앞에서 뒤로, 투명: 뒤에서 앞으로)
+	 *
+	 * 조명 데이터는 변경 틱으로 캐시하여, 조명이나 Point Light의 Transform이
+	 * 바뀐 프레임에만 다시 수집합니다.
 	 */
 	class RenderSystem : public ISystem
 	{
@@ -28,6 +39,7 @@ namespace ECS
 
 		void Initialize() override;
 		void Update(Core::float32 deltaTime) override;
+		void DeclareAccess(SystemAccess& access) const override;
 		void Shutdown() override;
 
 		//=====================================================================
@@ -36,9 +48,39 @@ namespace ECS
 
 		const Graphics::FrameData& GetFrameData() const { return mFrameData; }
 
+		/// 절두체 컬링 사용 여부 (끄면 모든 Renderable을 출력, 비교/디버깅용)
+		void SetFrustumCullingEnabled(bool enabled) { mFrustumCullingEnabled = enabled; }
+		bool IsFrustumCullingEnabled() const { return mFrustumCullingEnabled; }
+
 	private:
+		// 렌더 아이템 병렬 수집 시 Job 하나가 처리할 Entity 수 (구간마다 경계를 모아 배치 컬링)
+		static constexpr Core::uint32 CULL_CHUNK_SIZE = 256;
+
+		// 캐시된 조명 데이터 (변경이 있을 때만 재수집)
+		struct LightCache
+		{
+			std::vector<Graphics::DirectionalLightData> directionalLights;
+			std::vector<Graphics::PointLightData> pointLights;
+			std::vector<Entity> directionalLightEntities;
+			std::vector<Entity> pointLightEntities;
+		};
+
+		// 마지막 수집 이후 조명 관련 Component가 바뀌었는지 확인
+		bool AreLightsChanged(Registry& registry) const;
+
+		// 조명 캐시 재수집
+		void CollectLights(Registry& registry);
+
 		Framework::ResourceManager* mResourceManager;
 		Graphics::FrameData mFrameData;
+
+		// 렌더 아이템 정렬 (작업 버퍼 재사용)
+		Graphics::RenderQueueSorter mRenderQueueSorter;
+
+		LightCache mLightCache;
+		Core::uint32 mLightCacheTick = 0;    // 캐시를 만든 시점의 변경 틱 (0 = 아직 없음)
+
+		bool mFrustumCullingEnabled = true;
 	};
 
 } // namespace ECS
@@ -0,0 +1,114 @@
+﻿#pragma once
+#include "ECS/ISystem.h"
+#include "ECS/DynamicAABBTree.h"
+#include "ECS/Entity.h"
+#include "Core/Types.h"
+#include "Math/BoundingVolumes.h"
+#include <vector>
+
+namespace ECS
+{
+	class Registry;
+
+	/**
+	 * @brief BoundsComponent 월드 경계의 공간 인덱스 System
+	 *
+	 * TransformSystem이 갱신한 worldBounds를 동적 AABB 트리(DynamicAABBTree)에 반영하고,
+	 * 절두체/구/상자/반직선 쿼리를 Entity 단위로 제공합니다.
+	 * 렌더 컬링, 조명 영향 범위 수집, 마우스 피킹 등이 같은 인덱스를 공유할 수 있습니다.
+	 *
+	 * - 지난 실행 이후 바뀐 BoundsComponent만 트리에 반영 (변경 틱)
+	 * - BoundsComponent 제거(Entity 삭제 포함) 시 제거 훅으로 리프 제거
+	 * - TransformComponent만 제거된 Entity는 다음 Update에서 리프 제거 (Transform+Bounds 쿼리와 일치)
+	 * - 증분 삽입으로 트리 품질이 마지막 재구성 대비 REBUILD_QUALITY_FACTOR배 이상 나빠지면 SAH로 재구성
+	 *
+	 * @note TransformSystem 다음에 등록해야 같은 프레임의 경계가 반영됩니다.
+	 *       쿼리는 이 System의 Update가 끝난 뒤(다음 단계의 System 또는 렌더링)에 호출하세요.
+	 */
+	class SpatialIndexSystem : public ISystem
+	{
+	public:
+		explicit SpatialIndexSystem(Registry& registry);
+		~SpatialIndexSystem() override = default;
+
+		//=====================================================================
+		// ISystem 인터페이스
+		//=====================================================================
+
+		void Initialize() override;
+		void Update(Core::float32 deltaTime) override;
+		void DeclareAccess(SystemAccess& access) const override;
+		void Shutdown() override;
+
+		//=====================================================================
+		// 쿼리 (결과 벡터는 기존 내용을 지우지 않고 뒤에 추가)
+		//=====================================================================
+
+		// 절두체와 겹치는 Entity
+		void QueryFrustum(const Math::Frustum& frustum, std::vector<Entity>& outEntities) const;
+
+		// 구와 겹치는 Entity (Point Light 영향 범위 등)
+		void QuerySphere(const Math::BoundingSphere& sphere, std::vector<Entity>& outEntities) const;
+
+		// 상자와 겹치는 Entity
+		void QueryBox(const Math::AABB& box, std::vector<Entity>& outEntities) const;
+
+		/**
+		 * @brief 여러 절두체를 한 번의 순회로 판정
+		 *
+		 * @param outMasks outEntities와 같은 순서로, i번째 비트 = frustums[i]와 겹침
+		 * @note count는 DynamicAABBTree::MAX_BATCH_FRUSTUMS 이하
+		 */
+		void QueryFrustums(
+			const Math::Frustum* frustums,
+			Core::uint32 count,
+			std::vector<Entity>& outEntities,
+			std::vector<Core::uint32>& outMasks
+		) const;
+
+		/**
+		 * @brief 반직선과 가장 먼저 만나는 Entity (월드 AABB 기준)
+		 *
+		 * @param outDistance 만난 지점까지의 거리 (direction 길이 단위, nullptr 가능)
+		 * @return 만난 Entity (없으면 Invalid)
+		 */
+		Entity RayCast(
+			const Math::Vector3& origin,
+			const Math::Vector3& direction,
+			Core::float32 maxDistance,
+			Core::float32* outDistance = nullptr
+		) const;
+
+		//=====================================================================
+		// 통계
+		//=====================================================================
+
+		const DynamicAABBTree& GetTree() const { return mTree; }
+		Core::uint32 GetRebuildCount() const { return mRebuildCount; }
+
+	private:
+		// 트리 품질(면적 비)이 마지막 재구성 직후보다 이 배수 이상 나빠지면 재구성
+		static constexpr Core::float32 REBUILD_QUALITY_FACTOR = 1.5f;
+
+		// TransformComponent가 없어진 Entity의 리프 제거 (Transform 구조 변경이 있었을 때만 호출)
+		void PruneUntransformed();
+
+		// BoundsComponent 제거 시 리프 제거
+		void OnBoundsRemoved(Entity entity);
+
+		// Registry 제거 훅 진입점
+		static void BoundsRemoveHook(void* context, Entity entity);
+
+	private:
+		DynamicAABBTree mTree;
+
+		// Entity ID -> 프록시 ID (없으면 INVALID_PROXY)
+		std::vector<Core::uint32> mProxyByEntity;
+
+		// 마지막 재구성 직후의 면적 비 (0 = 아직 재구성하지 않음)
+		Core::float32 mRebuiltAreaRatio = 0.0f;
+
+		Core::uint32 mRebuildCount = 0;
+	};
+
+} // namespace ECS
@@ -10,6 +10,7 @@
 #pragma once
 #include "ECS/ISystem.h"
 #include "ECS/Components/TransformComponent.h"
+#include "ECS/Components/BoundsComponent.h"
 #include "ECS/Components/HierarchyComponent.h"
 #include "ECS/Entity.h"
 #include "Core/Types.h"
@@ -46,12 +47,17 @@ namespace ECS
 		/**
 		 * @brief 매 프레임 Transform 계층 구조 업데이트
 		 *
-		 * 1. Root Entity부터 DFS 순회
-		 * 2. localDirty면 localMatrix 재계산
-		 * 3. worldDirty면 worldMatrix 재계산 + 자식 worldDirty 마킹
-		 * 4. Hierarchy 없는 Entity는 단독 처리
+		 * 1. 계층 구조가 바뀌었으면 너비 우선 평탄화 배열 재구성
+		 * 2. localDirty면 localMatrix 재계산 (Math 배치 커널), 부모가 dirty면 자식도 dirty
+		 * 3. 평탄화 배열을 선형 순회하며 worldMatrix 계산
+		 *    (작은 Root 서브트리는 묶음 단위, 큰 서브트리는 레벨 단위로 병렬 처리)
+		 * 4. Hierarchy 없는 Entity는 단독 처리 (계층 처리와 동시에 실행)
+		 * 5. World Matrix 또는 로컬 경계가 바뀐 Entity의 BoundsComponent 월드 경계 갱신
+		 *
+		 * @note 노드마다 같은 연산을 같은 입력으로 수행하므로 병렬 결과는 직렬 결과와 비트 단위로 같음
 		 */
 		void Update(Core::float32 deltaTime) override;
+		void DeclareAccess(SystemAccess& access) const override;
 
 		void Shutdown() override;
 
@@ -62,6 +68,8 @@ namespace ECS
 		/**
 		 * @brief 부모-자식 관계 설정
 		 *
+		 * 링크 연결/해제는 O(1)이며, 옮긴 서브트리의 depth 갱신만 서브트리 크기에 비례합니다.
+		 *
 		 * @param child 자식 Entity
 		 * @param parent 부모 Entity (Invalid면 Root로 설정)
 		 * @return 성공 여부
@@ -77,11 +85,23 @@ namespace ECS
 		 */
 		Entity GetParent(Entity entity) const;
 
+		/// 첫 번째 자식 (없으면 Invalid)
+		Entity GetFirstChild(Entity entity) const;
+
+		/// 다음 형제 (없으면 Invalid, Root면 다음 Root)
+		Entity GetNextSibling(Entity entity) const;
+
+		/// 직계 자식 수
+		Core::uint32 GetChildCount(Entity entity) const;
+
+		/// 계층 깊이 (Root = 0, HierarchyComponent가 없으면 0)
+		Core::uint32 GetDepth(Entity entity) const;
+
 		/**
 		 * @brief 자식 Entity 목록 조회
-		 * @return 자식 Entity 벡터 (없으면 빈 벡터)
+		 * @param outChildren 자식 Entity를 받을 벡터 (기존 내용은 지움)
 		 */
-		const std::vector<Entity>& GetChildren(Entity entity) const;
+		void GetChildren(Entity entity, std::vector<Entity>& outChildren) const;
 
 		/**
 		 * @brief Root Entity 여부 확인
@@ -89,10 +109,17 @@ namespace ECS
 		 */
 		bool IsRoot(Entity entity) const;
 
+		/// 첫 번째 Root (GetNextSibling으로 나머지 Root 순회)
+		Entity GetFirstRoot() const { return mFirstRoot; }
+
+		/// Root Entity 수
+		Core::uint32 GetRootCount() const { return mRootCount; }
+
 		/**
 		 * @brief 모든 Root Entity 목록 조회
+		 * @param outRoots Root Entity를 받을 벡터 (기존 내용은 지움)
 		 */
-		const std::vector<Entity>& GetRootEntities() const { return mRootEntities; }
+		void GetRootEntities(std::vector<Entity>& outRoots) const;
 
 		//=========================================================================
 		// 고수준 API (Entity 기반) - Dirty Flag 자동 마킹
@@ -158,53 +185,135 @@ namespace ECS
 		static void RotateAround(TransformComponent& transform, const Math::Vector3& axis, Core::float32 angle);
 
 		/// Local Matrix 계산 (캐시 사용하지 않음, 항상 재계산)
-		static Math::Matrix4x4 CalculateLocalMatrix(const TransformComponent& transform);
+		static TransformMatrix CalculateLocalMatrix(const TransformComponent& transform);
+
+		/// 캐시된 Local Matrix 반환 (Matrix4x4가 필요하면 Math::ToMatrix4x4() 사용)
+		static const TransformMatrix& GetLocalMatrix(const TransformComponent& transform);
 
-		/// 캐시된 Local Matrix 반환
-		static const Math::Matrix4x4& GetLocalMatrix(const TransformComponent& transform);
+		/// 캐시된 World Matrix 반환 (Matrix4x4가 필요하면 Math::ToMatrix4x4() 사용)
+		static const TransformMatrix& GetWorldMatrix(const TransformComponent& transform);
 
-		/// 캐시된 World Matrix 반환
-		static const Math::Matrix4x4& GetWorldMatrix(const TransformComponent& transform);
+		/// 캐시된 World 역전치 행렬 반환 (노멀 변환용)
+		static const TransformMatrix& GetWorldInvTranspose(const TransformComponent& transform);
 
-		static Math::Matrix4x4 GetWorldInvTranspose(const TransformComponent& transform);
+		/// 캐시된 World Matrix로 월드 경계(AABB, 구) 계산
+		static void UpdateWorldBounds(BoundsComponent& bounds, const TransformComponent& transform);
 
 		static Math::Vector3 GetForward(const TransformComponent& transform);
 		static Math::Vector3 GetRight(const TransformComponent& transform);
 		static Math::Vector3 GetUp(const TransformComponent& transform);
 
 	private:
-		/// Root Entity 목록에 추가
-		void AddRootEntity(Entity entity);
+		/// 부모의 자식 목록 끝(parent가 Invalid면 Root 목록 끝)에 연결
+		void LinkEntity(Entity entity, HierarchyComponent& hierarchy, Entity parent);
+
+		/// 현재 부모의 자식 목록(Root면 Root 목록)에서 분리 (연결되어 있지 않으면 아무것도 하지 않음)
+		void UnlinkEntity(Entity entity, HierarchyComponent& hierarchy);
 
-		/// Root Entity 목록에서 제거
-		void RemoveRootEntity(Entity entity);
+		/// entity와 모든 자손의 depth 갱신 (entity는 depth, 자손은 부모 + 1)
+		void UpdateSubtreeDepth(Entity entity, HierarchyComponent& hierarchy, Core::uint32 depth);
+
+		/// HierarchyComponent 제거(Entity 삭제 포함) 시 링크 정리 (자식들은 Root가 됨)
+		void OnHierarchyRemoved(Entity entity);
+
+		/// Registry 제거 훅 진입점
+		static void HierarchyRemoveHook(void* context, Entity entity);
 
 		/// 단일 Entity의 Local Matrix 업데이트 (dirty면 재계산)
 		void UpdateLocalMatrix(TransformComponent& transform);
 
-		/// 계층 구조 DFS 순회 및 World Matrix 업데이트
-		void UpdateHierarchy(Entity entity, const Math::Matrix4x4& parentWorldMatrix);
+		/// worldMatrix로부터 worldInvTranspose 갱신 (균등 스케일이면 역행렬 계산 생략)
+		static void UpdateWorldInvTranspose(TransformComponent& transform, bool uniformWorldScale);
+
+		/// Root부터 너비 우선으로 계층 구조를 평탄화 (부모가 항상 자식보다 앞)
+		void RebuildFlatHierarchy();
+
+		/// 평탄화 배열의 World 행렬 캐시를 Component 값으로 다시 채움
+		void SyncFlatWorldMatrices();
+
+		/// 평탄화 배열을 선형 순회하며 World Matrix 업데이트 (Job System 사용)
+		void UpdateFlatHierarchy();
+
+		/// 평탄 구간 [begin, end)의 Local/dirty 갱신 및 World 계산 (부모는 구간 앞 또는 이미 처리됨)
+		void UpdateFlatRange(Core::uint32 begin, Core::uint32 end);
 
 		/// Hierarchy 없는 Entity들 업데이트
 		void UpdateStandaloneEntities();
 
+		/// 마지막 갱신 이후 Transform 또는 로컬 경계가 바뀐 Entity의 월드 경계 갱신
+		void UpdateBoundedEntities();
+
 		/// Transform 변경 시 dirty 플래그 설정
 		void MarkLocalDirty(TransformComponent& transform);
 
 	private:
-		/// Root Entity 목록 (parent가 Invalid인 HierarchyComponent를 가진 Entity)
-		std::vector<Entity> mRootEntities;
+		/// Root 목록 (parent가 Invalid인 Entity들을 형제 링크로 연결, 삽입/제거 O(1))
+		Entity mFirstRoot = Entity::Invalid();
+		Entity mLastRoot = Entity::Invalid();
+		Core::uint32 mRootCount = 0;
 
-		/// 빈 children 벡터 (GetChildren 반환용)
-		static const std::vector<Entity> sEmptyChildren;
+		/// 평탄화 배열에서 부모가 없음을 나타내는 인덱스
+		static constexpr Core::uint32 INVALID_FLAT_INDEX = UINT32_MAX;
 
-		//=========================================================================
-		// TODO: [OPTIMIZATION] Phase 4+
-		// - 현재: DFS 재귀 순회
-		// - 최적화: 명시적 스택 (깊이 100+ 시)
-		// - 최적화: Topological Sort 캐싱 (Entity 10,000+ 시)
-		// - 최적화: 독립 서브트리 병렬 처리 (Job System 도입 후)
-		//=========================================================================
+		/// 작은 Root 서브트리를 묶어 Job 하나에 배정할 최소 노드 수
+		static constexpr Core::uint32 HIERARCHY_BATCH_SIZE = 1024;
+
+		/// 이 크기 이상의 Root 서브트리는 레벨 단위로 나누어 병렬 처리
+		static constexpr Core::uint32 LARGE_SUBTREE_SIZE = 4096;
+
+		/// 레벨 분할 및 결과 기록 단계에서 Job 하나가 처리할 최소 노드 수
+		static constexpr Core::uint32 HIERARCHY_GRAIN_SIZE = 512;
+
+		/// 평탄 인덱스 구간 [begin, end)
+		struct FlatRange
+		{
+			Core::uint32 begin;
+			Core::uint32 end;
+		};
+
+		/**
+		 * @brief 너비 우선 순서로 평탄화한 계층 구조 (SoA)
+		 *
+		 * Root 서브트리마다 연속 구간에 너비 우선으로 배치되므로, 부모는 항상 자식보다 앞에 있어
+		 * 재귀나 자식 목록 탐색 없이 선형 순회로 World 행렬을 계산할 수 있습니다.
+		 * 서로 다른 서브트리와 같은 레벨의 노드는 독립적이므로 병렬 처리 단위가 됩니다.
+		 * SetParent 또는 HierarchyComponent 추가/제거 시에만 다시 만듭니다.
+		 */
+		struct FlatHierarchy
+		{
+			std::vector<Entity> entities;                   // 너비 우선 순서의 Entity
+			std::vector<Core::uint32> parentIndices;        // 부모의 평탄 인덱스 (Root면 INVALID_FLAT_INDEX)
+			std::vector<TransformMatrix> localMatrices;     // dirty 노드의 Local 행렬
+			std::vector<TransformMatrix> worldMatrices;     // World 행렬 캐시 (프레임 간 유지)
+			std::vector<TransformComponent*> transforms;    // 이번 프레임 Component 포인터 (없으면 nullptr)
+			std::vector<Core::uint8> dirtyFlags;            // 이번 프레임 World 재계산 여부
+			std::vector<Core::uint8> uniformFlags;          // 자신과 모든 조상이 균등 스케일인지 여부
+			std::vector<TransformMatrix> inverseTransposes; // 비균등 스케일 dirty 노드의 World 역전치
+
+			// Local 행렬 일괄 합성용 SoA 버퍼 (구간 시작 위치부터 채우므로 구간끼리 겹치지 않음)
+			std::vector<Math::Vector3> composePositions;
+			std::vector<Math::Quaternion> composeRotations;
+			std::vector<Math::Vector3> composeScales;
+			std::vector<TransformMatrix> composedMatrices;
+			std::vector<Core::uint32> composeIndices;       // 합성 결과를 돌려줄 평탄 인덱스
+
+			std::vector<FlatRange> batches;                 // 작은 서브트리 묶음 (Job 하나가 직렬 처리)
+			std::vector<FlatRange> levels;                  // 큰 서브트리의 레벨 구간 (순서대로, 레벨 내부는 병렬)
+		};
+
+		FlatHierarchy mFlatHierarchy;
+
+		/// 계층 구조(부모-자식 관계)가 바뀌어 평탄화 배열 재구성이 필요한지
+		bool mHierarchyDirty = true;
+
+		/// ForceUpdateWorldMatrix 등으로 World 행렬 캐시가 Component와 달라졌는지
+		bool mFlatWorldStale = false;
+
+		/// 평탄화 배열을 만든 시점의 변경 틱 (HierarchyComponent 추가/제거 감지)
+		Core::uint32 mHierarchyBuildTick = 0;
+
+		/// 월드 경계를 마지막으로 갱신한 시점의 변경 틱 (0 = 아직 없음)
+		Core::uint32 mBoundsTick = 0;
 	};
 
 } // namespace ECS
@@ -0,0 +1,83 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include <atomic>
+#include <string_view>
+
+namespace ECS
+{
+	namespace Internal
+	{
+		// ID 계열 태그 (계열마다 독립된 0부터의 연속 ID 공간)
+		struct ComponentFamily;
+		struct QueryFamily;
+		struct GroupFamily;
+		struct SystemFamily;
+
+		/**
+		 * @brief 타입별 고유 정수 ID 발급기
+		 *
+		 * 타입 T가 처음 조회될 때 Family 안에서 0부터 순서대로 ID를 발급합니다.
+		 * ID가 연속이므로 type_index 해시 맵 대신 평면 배열의 인덱스로 쓸 수 있습니다.
+		 *
+		 * @tparam Family ID 공간을 구분하는 태그 타입
+		 *
+		 * @note 정적 라이브러리로 링크되는 한 실행 파일 내에서 ID는 유일합니다.
+		 */
+		template<typename Family>
+		class TypeIdGenerator
+		{
+		public:
+			template<typename T>
+			static Core::uint32 Get()
+			{
+				static const Core::uint32 sId = sNextId.fetch_add(1, std::memory_order_relaxed);
+				return sId;
+			}
+
+			// 지금까지 발급된 ID 개수
+			static Core::uint32 GetCount()
+			{
+				return sNextId.load(std::memory_order_relaxed);
+			}
+
+		private:
+			static inline std::atomic<Core::uint32> sNextId{ 0 };
+		};
+
+		/**
+		 * @brief RTTI 없이 타입 이름 얻기 (로그/디버그 표시용)
+		 *
+		 * 컴파일러가 제공하는 함수 시그니처 문자열에서 템플릿 인자 부분을 잘라냅니다.
+		 * 반환값은 널 종료되지 않으므로 printf 계열에서는 "%.*s"로 출력합니다.
+		 */
+		template<typename T>
+		inline std::string_view GetTypeName()
+		{
+#if defined(_MSC_VER)
+			// "... GetTypeName<struct ECS::TransformComponent>(void)"
+			std::string_view name = __FUNCSIG__;
+			const size_t first = name.find("GetTypeName<") + sizeof("GetTypeName<") - 1;
+			const size_t last = name.rfind(">(void)");
+#else
+			// "... GetTypeName() [with T = ECS::TransformComponent; ...]" 또는 "[T = ECS::TransformComponent]"
+			std::string_view name = __PRETTY_FUNCTION__;
+			const size_t first = name.find("T = ") + sizeof("T = ") - 1;
+			const size_t last = name.find_first_of(";]", first);
+#endif
+			name = name.substr(first, last - first);
+
+			// MSVC의 "struct " / "class " 접두어 제거
+			for (std::string_view prefix : { std::string_view("struct "), std::string_view("class ") })
+			{
+				if (name.substr(0, prefix.size()) == prefix)
+				{
+					name.remove_prefix(prefix.size());
+				}
+			}
+
+			return name;
+		}
+
+	} // namespace Internal
+
+} // namespace ECS
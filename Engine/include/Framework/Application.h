@@ -31,6 +31,7 @@ namespace Framework
 		bool windowResizable = true;
 		bool enableVSync = true;
 		bool enableDebugLayer = true;  // DirectX 12 디버그 레이어
+		Core::uint32 workerThreadCount = 0;  // Job System 워커 수 (0 = 하드웨어 스레드 수 - 1)
 	};
 
 	/**
@@ -13,7 +13,7 @@ namespace Framework
 	/**
 	 * @brief 성능 모니터링 패널
 	 *
-	 * FPS, Frame Time, Entity/Component 통계를 실시간으로 표시합니다.
+	 * FPS, Frame Time, Entity/Component, 컬링 통계를 실시간으로 표시합니다.
 	 */
 	class PerformancePanel
 	{
@@ -37,6 +37,14 @@ namespace Framework
 		 */
 		void Render(ECS::Registry* registry = nullptr);
 
+		/**
+		 * @brief 이번 프레임 렌더링 통계 설정 (RenderSystem의 FrameData::stats)
+		 * @param renderableCount 수집 대상 Renderable 수
+		 * @param visibleCount 렌더 아이템으로 출력된 수
+		 * @param culledCount 절두체 컬링으로 제외된 수
+		 */
+		void SetRenderStats(Core::uint32 renderableCount, Core::uint32 visibleCount, Core::uint32 culledCount);
+
 		/**
 		 * @brief 패널 표시 여부 설정
 		 */
@@ -60,6 +68,12 @@ namespace Framework
 		Core::float32 mMinFrameTime = FLT_MAX;
 		Core::float32 mMaxFrameTime = 0.0f;
 
+		// 렌더링 통계 (SetRenderStats가 호출된 적 없으면 표시하지 않음)
+		Core::uint32 mRenderableCount = 0;
+		Core::uint32 mVisibleCount = 0;
+		Core::uint32 mCulledCount = 0;
+		bool mHasRenderStats = false;
+
 		// 상태
 		bool mIsVisible = true;
 	};
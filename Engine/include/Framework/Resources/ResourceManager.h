@@ -8,6 +8,7 @@ namespace Graphics
 {
 	class Mesh;
 	class Material;
+	struct MaterialDesc;
 	class Texture;
 	class DX12Device;
 	class DX12Renderer;
@@ -61,6 +62,14 @@ namespace Framework
 			const std::wstring& pixelShader
 		);
 
+		/**
+		 * @brief MaterialDesc로 Material 생성 (블렌드/인스턴싱 등 세부 설정)
+		 */
+		ResourceId CreateMaterial(
+			const std::string& name,
+			const Graphics::MaterialDesc& desc
+		);
+
 		Graphics::Material* GetMaterial(ResourceId id);
 		const Graphics::Material* GetMaterial(ResourceId id) const;
 		bool RemoveMaterial(ResourceId id);
@@ -0,0 +1,77 @@
+﻿#pragma once
+#include "Graphics/GraphicsTypes.h"
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Graphics
+{
+	class DX12ConstantBuffer;
+	class Material;
+
+	/**
+	 * @brief Material별 영구 Constant Buffer (b1) 관리 클래스
+	 *
+	 * Material마다 256바이트 슬롯을 프레임 수만큼 할당하고, Material 상수가 바뀐 경우에만 업로드합니다.
+	 * - 슬롯은 64KB 페이지(DX12ConstantBuffer) 단위로 늘어남
+	 * - 프레임 복사본마다 마지막으로 업로드한 Material 상수 버전을 기록해 Dirty 판정
+	 * - 바뀌지 않은 Material은 주소만 바인딩 (업로드 없음)
+	 *
+	 * 프레임 복사본은 해당 프레임의 Fence 대기 후에만 기록하므로 GPU가 읽는 중인 데이터를 덮어쓰지 않습니다.
+	 *
+	 * @note 슬롯은 Material 주소로 찾으며, Material 제거 시 Release()로 반환해야 합니다
+	 */
+	class DX12MaterialConstantsPool
+	{
+	public:
+		static constexpr Core::uint32 SLOT_SIZE = D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT;
+		static constexpr Core::uint32 SLOTS_PER_PAGE = 256;  // 페이지당 64KB (프레임별)
+
+		DX12MaterialConstantsPool();
+		~DX12MaterialConstantsPool();
+
+		DX12MaterialConstantsPool(const DX12MaterialConstantsPool&) = delete;
+		DX12MaterialConstantsPool& operator=(const DX12MaterialConstantsPool&) = delete;
+
+		bool Initialize(ID3D12Device* device);
+		void Shutdown();
+
+		/**
+		 * @brief Material 상수의 GPU 주소 반환 (바뀐 경우에만 업로드)
+		 *
+		 * 처음 보는 Material이면 슬롯을 할당합니다.
+		 *
+		 * @param material 바인딩할 Material
+		 * @param frameIndex 현재 프레임 인덱스
+		 * @return SetGraphicsRootConstantBufferView용 GPU 주소 (실패 시 0)
+		 */
+		D3D12_GPU_VIRTUAL_ADDRESS GetGPUAddress(const Material& material, Core::uint32 frameIndex);
+
+		/**
+		 * @brief Material의 슬롯 반환 (Material 제거 시 호출)
+		 */
+		void Release(const Material& material);
+
+		// 통계
+		Core::uint32 GetMaterialCount() const { return static_cast<Core::uint32>(mSlots.size()); }
+		Core::uint64 GetUploadCount() const { return mUploadCount; }
+
+	private:
+		static constexpr Core::uint32 INVALID_SLOT = 0xFFFFFFFF;
+
+		Core::uint32 AcquireSlot();
+
+		ID3D12Device* mDevice = nullptr;
+
+		std::vector<std::unique_ptr<DX12ConstantBuffer>> mPages;
+
+		// 슬롯별, 프레임 복사본별 업로드된 상수 버전 (0 = 업로드 안 됨)
+		std::vector<std::array<Core::uint64, FRAME_BUFFER_COUNT>> mUploadedVersions;
+		std::vector<Core::uint32> mFreeSlots;
+		std::unordered_map<const Material*, Core::uint32> mSlots;
+
+		Core::uint64 mUploadCount = 0;
+	};
+
+} // namespace Graphics
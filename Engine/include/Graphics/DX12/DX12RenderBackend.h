@@ -0,0 +1,22 @@
+﻿#pragma once
+#include "Graphics/GraphicsTypes.h"
+#include "Graphics/RenderCommand.h"
+
+namespace Graphics
+{
+	/**
+	 * @brief 렌더 명령 스트림을 D3D12 커맨드 리스트로 변환하는 백엔드
+	 *
+	 * 명령을 기록 순서대로 ID3D12GraphicsCommandList 호출로 옮깁니다.
+	 * Root Signature와 Descriptor Heap은 호출자가 먼저 설정해야 합니다.
+	 */
+	class DX12RenderBackend
+	{
+	public:
+		/**
+		 * @brief stream의 모든 명령을 commandList에 기록
+		 */
+		static void Execute(ID3D12GraphicsCommandList* commandList, const RenderCommandStream& stream);
+	};
+
+} // namespace Graphics
@@ -1,8 +1,11 @@
 ﻿#pragma once
 #include "Graphics/GraphicsTypes.h"
+#include "Graphics/InstanceBatcher.h"
+#include "Graphics/ParallelCommandEncoder.h"
 #include "Graphics/RenderTypes.h"
 #include <array>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace Framework
@@ -17,17 +20,10 @@ namespace Graphics
 	{
 		Math::Matrix4x4 worldMatrix;
 		Math::Matrix4x4 mvpMatrix;
+		Math::Matrix4x4 normalMatrix;  // World 역전치 (노멀 변환용)
 	};
 
-	// Material Constant Buffer (b1) - Phase 3.3
-	struct MaterialConstants
-	{
-		Math::Vector4 baseColor;
-		Core::float32 metallic;
-		Core::float32 roughness;
-		Core::uint32 textureFlags;
-		Core::float32 padding;
-	};
+	static_assert(sizeof(ObjectConstants) == sizeof(InstanceData), "ObjectConstants and InstanceData must share a layout");
 
 	struct LightingConstants
 	{
@@ -72,6 +68,9 @@ namespace Graphics
 	class DX12PipelineStateCache;
 	class DX12ShaderCompiler;
 	class DX12ConstantBuffer;
+	class DX12UploadAllocator;
+	class DX12MaterialConstantsPool;
+	class Material;
 	class DX12DepthStencilBuffer;
 	class DX12DescriptorHeap;
 	class DebugRenderer;
@@ -85,6 +84,15 @@ namespace Graphics
 	 * Phase 3.3: Lighting System 통합
 	 * - LightingConstantBuffer 추가 (b2)
 	 * - MaterialConstantBuffer 추가 (b1)
+	 *
+	 * 인스턴싱: 연속한 같은 (Mesh, Material) 아이템을 InstanceBatcher로 묶어
+	 * 인스턴스 버퍼(t0, space1)에 기록하고, 인스턴싱을 지원하는 Material은 배치당 Draw 1회로 그림
+	 *
+	 * 렌더 명령: RenderCommandBuilder가 아이템을 RenderCommandStream으로 기록하고
+	 * DX12RenderBackend가 커맨드 리스트로 변환 (IRenderResourceProvider로 PSO/상수/업로드 메모리 제공)
+	 *
+	 * 병렬 기록: 아이템이 많으면 ParallelCommandEncoder가 청크별 스트림을 워커 스레드에서 기록하고,
+	 * 메인 스레드가 청크 순서대로 현재 커맨드 리스트에 변환 (청크마다 EncodeContext와 업로드 할당자 사용)
 	 */
 	class DX12Renderer
 	{
@@ -151,6 +159,13 @@ namespace Graphics
 		 */
 		void RenderDebug(const FrameData& frameData);
 
+		/**
+		 * @brief Material의 GPU 상수 슬롯 반환
+		 *
+		 * Material을 제거할 때 호출합니다 (ResourceManager::RemoveMaterial).
+		 */
+		void ReleaseMaterialConstants(const Material& material);
+
 
 		// Setters
 		void SetCurrentFrameFenceValue(Core::uint64 value) { mFrameFenceValues[mCurrentFrameIndex] = value; }
@@ -183,8 +198,9 @@ namespace Graphics
 		/**
 		 * @brief 렌더 아이템 그리기
 		 *
-		 * @param items 렌더링할 아이템 목록
-		 * @param resourceMgr ResourceManager (텍스처 조회용)
+		 * 아이템 순서를 유지한 채 (Mesh, Material) 배치로 묶어 그립니다.
+		 *
+		 * @param items 렌더링할 아이템 목록 (정렬 키 순서)
 		 */
 		void DrawRenderItems(const std::vector<RenderItem>& items);
 
@@ -195,6 +211,12 @@ namespace Graphics
 		 */
 		void UpdateLightingBuffer(const FrameData& frameData);
 
+		/**
+		 * @brief 병렬 기록 청크 수만큼 EncodeContext 확보
+		 * @return 사용할 수 있는 청크 수 (생성 실패 시 기존 개수)
+		 */
+		Core::uint32 ReserveEncodeContexts(Core::uint32 chunkCount);
+
 		// 헬퍼 함수
 		DX12CommandContext* GetCurrentCommandContext();
 		void UpdateViewportAndScissor();
@@ -211,12 +233,20 @@ namespace Graphics
 		std::unique_ptr<DX12ShaderCompiler> mShaderCompiler;
 
 		// Constant Buffers
-		std::unique_ptr<DX12ConstantBuffer> mObjectConstantBuffer;		// b0: MVP
-		std::unique_ptr<DX12ConstantBuffer> mMaterialConstantBuffer;    // b1: Material (Phase 3.3)
+		std::unique_ptr<DX12MaterialConstantsPool> mMaterialConstantsPool;  // b1: Material별 영구 상수
 		std::unique_ptr<DX12ConstantBuffer> mLightingConstantBuffer;    // b2: Lighting (Phase 3.3)
 
-		Core::uint32 mCurrentObjectCBIndex = 0;
-		static constexpr Core::uint32 MAX_OBJECTS_PER_FRAME = 100;
+		// 렌더 명령 기록 청크별 리소스 제공자 (IRenderResourceProvider 구현, DX12Renderer.cpp에 정의)
+		// 프레임 임시 데이터(b0: Object Constants, t0 space1: Instance Buffer)는 청크마다 별도의
+		// DX12UploadAllocator에서 할당하고, PSO 캐시와 Material 상수 풀은 mEncodeMutex로 공유
+		class EncodeContext;
+		std::vector<std::unique_ptr<EncodeContext>> mEncodeContexts;
+		std::vector<IRenderResourceProvider*> mEncodeProviders;
+		std::mutex mEncodeMutex;
+
+		// 렌더 명령 (프레임마다 재사용)
+		ParallelCommandEncoder mCommandEncoder;
+		RenderCommandStream mCommandPreamble;    // 청크 스트림 공통 바인딩 (Lighting)
 
 		std::unique_ptr<DX12DepthStencilBuffer> mDepthStencilBuffer;
 		std::unique_ptr<DX12DescriptorHeap> mSrvDescriptorHeap;
@@ -0,0 +1,158 @@
+﻿#pragma once
+#include "Graphics/GraphicsTypes.h"
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Graphics
+{
+	/**
+	 * @brief 프레임 임시 데이터용 선형 Upload Heap 할당자
+	 *
+	 * 상수/정점/인덱스처럼 한 프레임만 쓰는 데이터를 Upload Heap 페이지에서 포인터 증가만으로 할당합니다.
+	 * - 페이지가 가득 차면 새 페이지를 사용하며, 필요할 때만 페이지를 생성 (상한 없음)
+	 * - 페이지보다 큰 요청은 전용 대형 페이지를 사용 (회수 후에도 별도 풀에 두고 대형 요청에만 재사용)
+	 * - EndFrame()에서 이번 프레임 페이지를 Fence 값과 함께 보류하고,
+	 *   BeginFrame()에서 GPU가 그 Fence를 지난 페이지를 회수해 재사용
+	 *
+	 * 모든 페이지는 생성 시 Map되어 종료까지 유지됩니다.
+	 *
+	 * @note 스레드 안전하지 않음 (스레드마다 별도 인스턴스 사용)
+	 *
+	 * @code
+	 * allocator.BeginFrame(commandQueue->GetCompletedFenceValue());
+	 *
+	 * auto cb = allocator.AllocateConstants(objectConstants);
+	 * cmdList->SetGraphicsRootConstantBufferView(0, cb.gpuAddress);
+	 *
+	 * Core::uint64 fenceValue = commandQueue->ExecuteCommandLists(1, lists);
+	 * allocator.EndFrame(fenceValue);
+	 * @endcode
+	 */
+	class DX12UploadAllocator
+	{
+	public:
+		static constexpr size_t DEFAULT_PAGE_SIZE = 2 * 1024 * 1024;  // 2MB
+
+		/**
+		 * @brief 할당 결과 (같은 페이지의 CPU/GPU 주소)
+		 */
+		struct Allocation
+		{
+			void* cpuAddress = nullptr;                     // Write-Combined 메모리 (쓰기 전용)
+			D3D12_GPU_VIRTUAL_ADDRESS gpuAddress = 0;
+			size_t size = 0;
+
+			template<typename T>
+			T* As() const { return static_cast<T*>(cpuAddress); }
+
+			bool IsValid() const { return cpuAddress != nullptr; }
+		};
+
+		DX12UploadAllocator() = default;
+		~DX12UploadAllocator();
+
+		DX12UploadAllocator(const DX12UploadAllocator&) = delete;
+		DX12UploadAllocator& operator=(const DX12UploadAllocator&) = delete;
+
+		/**
+		 * @brief 할당자 초기화 (페이지는 첫 할당 시 생성)
+		 *
+		 * @param device DirectX 12 Device
+		 * @param pageSize 기본 페이지 크기 (바이트, 64KB 단위로 올림)
+		 */
+		bool Initialize(ID3D12Device* device, size_t pageSize = DEFAULT_PAGE_SIZE);
+
+		void Shutdown();
+
+		/**
+		 * @brief 프레임 시작: GPU가 완료한 프레임의 페이지 회수
+		 *
+		 * @param completedFenceValue GPU가 완료한 마지막 Fence 값
+		 */
+		void BeginFrame(Core::uint64 completedFenceValue);
+
+		/**
+		 * @brief 프레임 종료: 이번 프레임에 사용한 페이지를 fenceValue까지 보류
+		 *
+		 * @param fenceValue 이번 프레임 커맨드 리스트 제출 후 Signal된 Fence 값
+		 */
+		void EndFrame(Core::uint64 fenceValue);
+
+		/**
+		 * @brief size 바이트 할당 (포인터 증가)
+		 *
+		 * @param alignment 정렬 (2의 거듭제곱, 상수 버퍼는 256)
+		 * @return 실패 시 IsValid() == false
+		 */
+		Allocation Allocate(size_t size, size_t alignment = D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT);
+
+		/**
+		 * @brief 상수 버퍼 데이터 할당 후 복사 (256바이트 정렬)
+		 */
+		template<typename T>
+		Allocation AllocateConstants(const T& data)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Type must be trivially copyable for GPU upload");
+
+			Allocation allocation = Allocate(sizeof(T), D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT);
+			if (allocation.IsValid())
+			{
+				memcpy(allocation.cpuAddress, &data, sizeof(T));
+			}
+			return allocation;
+		}
+
+		/**
+		 * @brief 임시 정점 데이터 할당 후 복사
+		 */
+		D3D12_VERTEX_BUFFER_VIEW AllocateVertices(const void* vertices, size_t vertexCount, size_t vertexStride);
+
+		/**
+		 * @brief 임시 인덱스 데이터 할당 후 복사 (R16_UINT / R32_UINT)
+		 */
+		D3D12_INDEX_BUFFER_VIEW AllocateIndices(const void* indices, size_t indexCount, DXGI_FORMAT format);
+
+		// 통계
+		Core::uint32 GetPageCount() const { return static_cast<Core::uint32>(mPages.size()); }
+		Core::uint32 GetAvailablePageCount() const { return static_cast<Core::uint32>(mAvailablePages.size() + mAvailableLargePages.size()); }
+		Core::uint32 GetRetiredPageCount() const { return static_cast<Core::uint32>(mRetiredPages.size()); }
+		size_t GetFrameAllocatedBytes() const { return mFrameAllocatedBytes; }
+		size_t GetPageSize() const { return mPageSize; }
+
+	private:
+		struct Page
+		{
+			ComPtr<ID3D12Resource> resource;
+			Core::uint8* cpuBase = nullptr;
+			D3D12_GPU_VIRTUAL_ADDRESS gpuBase = 0;
+			size_t size = 0;
+			Core::uint64 fenceValue = 0;   // 이 값이 완료되면 재사용 가능
+		};
+
+		/**
+		 * @brief 최소 minSize 크기의 페이지 확보 (회수된 페이지 우선, 없으면 생성)
+		 *
+		 * 기본 페이지 크기 이하 요청은 기본 페이지 풀, 초과 요청은 대형 페이지 풀에서만 가져옵니다.
+		 */
+		Page* AcquirePage(size_t minSize);
+
+		Page* CreatePage(size_t size);
+
+		ID3D12Device* mDevice = nullptr;
+		size_t mPageSize = DEFAULT_PAGE_SIZE;
+
+		std::vector<std::unique_ptr<Page>> mPages;   // 모든 페이지 소유
+		std::vector<Page*> mAvailablePages;          // 재사용 가능 (기본 크기)
+		std::vector<Page*> mAvailableLargePages;     // 재사용 가능 (기본 크기 초과, 대형 요청 전용)
+		std::deque<Page*> mRetiredPages;             // GPU 사용 중 (Fence 순서)
+		std::vector<Page*> mFramePages;              // 이번 프레임에 사용 중 
+
+		Page* mCurrentPage = nullptr;
+		size_t mCurrentOffset = 0;
+		size_t mFrameAllocatedBytes = 0;
+	};
+
+} // namespace Graphics
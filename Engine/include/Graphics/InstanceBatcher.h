@@ -0,0 +1,108 @@
+﻿#pragma once
+#include "Graphics/RenderTypes.h"
+#include "Core/Types.h"
+#include <span>
+#include <vector>
+
+namespace Graphics
+{
+	// 전방 선언
+	class Mesh;
+	class Material;
+
+	/**
+	 * @brief 인스턴스별 셰이더 데이터 (StructuredBuffer 원소)
+	 *
+	 * HLSL 레이아웃과 일치 (192바이트, 행렬은 HLSL column-major용으로 전치된 상태)
+	 * ObjectConstants(b0)와 같은 레이아웃이므로 인스턴싱을 지원하지 않는 셰이더에도 그대로 복사할 수 있습니다.
+	 *
+	 * @code
+	 * struct InstanceData { float4x4 worldMatrix; float4x4 mvpMatrix; float4x4 normalMatrix; };
+	 * StructuredBuffer<InstanceData> gInstances : register(t0, space1);
+	 * @endcode
+	 */
+	struct InstanceData
+	{
+		Math::Matrix4x4 worldMatrix;
+		Math::Matrix4x4 mvpMatrix;
+		Math::Matrix4x4 normalMatrix;
+	};
+
+	static_assert(sizeof(InstanceData) == 192, "InstanceData must match the HLSL StructuredBuffer stride");
+
+	/**
+	 * @brief 같은 Mesh/Material을 공유하는 연속 아이템 묶음 (인스턴스 Draw 1회)
+	 */
+	struct InstanceBatch
+	{
+		const Mesh* mesh = nullptr;
+		const Material* material = nullptr;
+		Core::uint32 firstItem = 0;        // 원본 아이템 배열의 시작 인덱스
+		Core::uint32 firstInstance = 0;    // 인스턴스 버퍼의 시작 원소
+		Core::uint32 instanceCount = 0;
+	};
+
+	/**
+	 * @brief RenderItem 목록을 (Mesh, Material) 인스턴스 배치로 묶고 인스턴스 데이터를 채우는 클래스
+	 *
+	 * 그래픽 API에 의존하지 않는 CPU 단계입니다. 렌더러는 Build() 후 GetInstanceCount()만큼
+	 * 업로드 메모리를 확보하고 PackInstances()로 직접 채운 뒤, 배치마다 한 번 그립니다.
+	 *
+	 * - 아이템 순서를 바꾸지 않고 연속한 같은 (Mesh, Material)만 묶습니다.
+	 *   불투명 큐는 RenderQueueSorter가 상태 순으로 정렬해 두므로 같은 쌍이 모이고,
+	 *   투명 큐는 뒤에서 앞으로의 순서가 그대로 유지됩니다.
+	 * - Mesh 또는 Material이 없는 아이템은 건너뜁니다.
+	 *
+	 * 작업 버퍼를 재사용하므로 프레임마다 같은 인스턴스를 사용하세요.
+	 *
+	 * @note 스레드 안전하지 않음 (스레드마다 별도 인스턴스 사용)
+	 */
+	class InstanceBatcher
+	{
+	public:
+		/**
+		 * @brief 배치 구성 (인스턴스 데이터는 채우지 않음)
+		 *
+		 * @param items 그리기 순서로 정렬된 아이템 (PackInstances 호출까지 유지되어야 함)
+		 *              배치의 firstItem은 items 기준 인덱스
+		 */
+		void Build(std::span<const RenderItem> items);
+
+		/**
+		 * @brief 모든 배치의 인스턴스 데이터를 배치 순서대로 기록
+		 *
+		 * @param dest GetInstanceCount()개 이상의 원소를 쓸 수 있는 메모리 (Upload Heap 가능)
+		 */
+		void PackInstances(InstanceData* dest) const;
+
+		/**
+		 * @brief [firstBatch, firstBatch + batchCount) 배치의 인스턴스 데이터만 기록
+		 *
+		 * 배치마다 기록 위치가 정해져 있으므로 서로 다른 구간은 동시에 기록할 수 있습니다.
+		 *
+		 * @param dest PackInstances(dest)와 같은 버퍼 시작 주소
+		 */
+		void PackInstances(InstanceData* dest, Core::uint32 firstBatch, Core::uint32 batchCount) const;
+
+		/**
+		 * @brief 배치 하나의 인스턴스 데이터를 stride 간격으로 기록
+		 *
+		 * @param dest 배치 첫 인스턴스를 기록할 주소 (firstInstance와 무관)
+		 * @param stride 인스턴스 사이 간격 (sizeof(InstanceData) 이상, Object Constants로 쓸 때는 256)
+		 */
+		void PackBatch(Core::uint32 batchIndex, void* dest, size_t stride) const;
+
+		/// RenderItem 하나를 셰이더 레이아웃으로 변환 (전치 포함)
+		static InstanceData MakeInstanceData(const RenderItem& item);
+
+		const std::vector<InstanceBatch>& GetBatches() const { return mBatches; }
+		Core::uint32 GetBatchCount() const { return static_cast<Core::uint32>(mBatches.size()); }
+		Core::uint32 GetInstanceCount() const { return mInstanceCount; }
+
+	private:
+		std::span<const RenderItem> mItems;
+		std::vector<InstanceBatch> mBatches;
+		Core::uint32 mInstanceCount = 0;
+	};
+
+} // namespace Graphics
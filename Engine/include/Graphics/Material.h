@@ -2,6 +2,7 @@
 #include "Graphics/GraphicsTypes.h"
 #include "Graphics/TextureType.h"
 #include "Framework/Resources/ResourceId.h" 
+#include "Math/MathTypes.h"
 #include <string>
 #include <array>
 
@@ -61,6 +62,20 @@ namespace Graphics
 		return a;
 	}
 
+	/**
+	 * @brief Material Constant Buffer (b1) 레이아웃
+	 *
+	 * Shader의 MaterialConstants cbuffer와 일치해야 합니다.
+	 */
+	struct MaterialConstants
+	{
+		Math::Vector4 baseColor;
+		Core::float32 metallic;
+		Core::float32 roughness;
+		Core::uint32 textureFlags;
+		Core::float32 padding;
+	};
+
 	/**
 	 * @brief Material 생성을 위한 설정 구조체
 	 */
@@ -93,6 +108,16 @@ namespace Graphics
 		uint32 sampleQuality = 0;
 		uint32 sampleMask = 0xFFFFFFFF;
 
+		// 정점 셰이더가 인스턴스 버퍼(StructuredBuffer<InstanceData>, t0 space1)를 읽는지
+		// true이면 같은 Mesh를 공유하는 연속 아이템을 인스턴스 Draw 한 번으로 그림
+		// false이면 아이템마다 그리며 b0와 인스턴스 버퍼가 모두 그 아이템을 가리킴 (어느 셰이더든 올바름)
+		bool instancing = false;
+
+		// Material 상수 (b1)
+		Math::Vector4 baseColor = Math::Vector4(1.0f, 1.0f, 1.0f, 1.0f);  // 기본 흰색
+		Core::float32 metallic = 0.0f;
+		Core::float32 roughness = 0.5f;
+
 		// 텍스쳐 경로
 		// const wchar_t* diffuseTexturePath = nullptr;
 		// const wchar_t* normalTexturePath = nullptr;
@@ -180,6 +205,34 @@ namespace Graphics
 
 		Core::uint32 GetTextureFlags() const;
 
+		// 블렌딩을 사용하는지 (투명 큐로 분류, 뒤에서 앞으로 정렬)
+		bool IsTransparent() const { return mBlendDesc.RenderTarget[0].BlendEnable == TRUE; }
+
+		// 인스턴스 Draw 가능 여부 (MaterialDesc::instancing)
+		bool SupportsInstancing() const { return mSupportsInstancing; }
+
+		// Material 상수 (b1) - 변경 시 상수 버전 갱신
+		void SetBaseColor(const Math::Vector4& color);
+		void SetMetallic(Core::float32 metallic);
+		void SetRoughness(Core::float32 roughness);
+
+		const Math::Vector4& GetBaseColor() const { return mBaseColor; }
+		Core::float32 GetMetallic() const { return mMetallic; }
+		Core::float32 GetRoughness() const { return mRoughness; }
+
+		/**
+		 * @brief GPU에 올릴 Material 상수 생성
+		 */
+		MaterialConstants GetConstants() const;
+
+		/**
+		 * @brief Material 상수 버전 (상수나 텍스처 구성이 바뀔 때마다 갱신)
+		 *
+		 * 모든 Material에 걸쳐 유일한 값이므로, 렌더러는 마지막으로 업로드한 버전과 비교해
+		 * 바뀐 Material만 다시 업로드합니다 (Dirty 판정). 0은 사용하지 않습니다.
+		 */
+		Core::uint64 GetConstantsVersion() const { return mConstantsVersion; }
+
 		//// Texture 관련
 		//std::shared_ptr<Texture> GetTexture(TextureType type) const;
 		//bool HasTexture(TextureType type) const;
@@ -257,6 +310,11 @@ namespace Graphics
 			uint32 index
 		);
 
+		/**
+		 * @brief 상수 버전 갱신 (GPU 상수 재업로드 필요 표시)
+		 */
+		void MarkConstantsDirty();
+
 		/**
 		 * @brief 문자열 해시 계산 헬퍼 함수
 		 */
@@ -282,6 +340,13 @@ namespace Graphics
 		uint32 mSampleCount;
 		uint32 mSampleQuality;
 		uint32 mSampleMask;
+		bool mSupportsInstancing = false;
+
+		// Material 상수 (b1)
+		Math::Vector4 mBaseColor = Math::Vector4(1.0f, 1.0f, 1.0f, 1.0f);
+		Core::float32 mMetallic = 0.0f;
+		Core::float32 mRoughness = 0.5f;
+		Core::uint64 mConstantsVersion = 0;
 
 		uint32 mDescriptorStartIndex;
 
@@ -3,6 +3,7 @@
 #include "Graphics/DX12/DX12IndexBuffer.h"
 #include "Graphics/DX12/DX12VertexBuffer.h"
 #include "Graphics/VertexTypes.h"
+#include "Math/BoundingVolumes.h"
 #include "Math/MathTypes.h"
 
 
@@ -16,6 +17,7 @@ namespace Graphics
 	 *
 	 * VertexBuffer와 IndexBuffer를 하나의 렌더링 단위로 조합하여 관리합니다.
 	 * GPU 메모리에 지오메트리 데이터를 업로드하고 렌더링 시 바인딩/드로우를 수행합니다.
+	 * 초기화 시 정점 위치로 로컬 경계 볼륨(AABB, 구)을 계산해 둡니다 (컬링용).
 	 */
 	class Mesh
 	{
@@ -83,8 +85,12 @@ namespace Graphics
 		 * 렌더링에 필요한 모든 상태 (PSO, Root Signature)는 외부에서 미리 설정되어 있어야 합니다.
 		 *
 		 * @param commandList 바인딩 및 드로우 커맨드를 기록할 커맨드 리스트
+		 * @param instanceCount 그릴 인스턴스 수 (인스턴스 데이터는 셰이더가 SV_InstanceID로 조회)
 		 */
-		void Draw(ID3D12GraphicsCommandList* commandList) const;
+		void Draw(ID3D12GraphicsCommandList* commandList, uint32 instanceCount = 1) const;
+
+		// Vertex/Index Buffer만 바인딩 (Draw 호출은 호출자가 수행)
+		void Bind(ID3D12GraphicsCommandList* commandList) const;
 
 		// Getters
 		size_t GetVertexCount() const { return mVertexBuffer.GetVertexCount(); }
@@ -93,10 +99,18 @@ namespace Graphics
 		bool HasIndexBuffer() const { return mIndexBuffer.IsInitialized(); }
 		D3D12_INPUT_LAYOUT_DESC GetInputLayout() const { return mInputLayout; }
 
+		/// 로컬 공간 AABB (정점 위치 기준)
+		const Math::AABB& GetLocalBounds() const { return mLocalBounds; }
+
+		/// 로컬 공간 경계 구 (중심 = AABB 중심)
+		const Math::BoundingSphere& GetLocalSphere() const { return mLocalSphere; }
+
 	private:
 		DX12VertexBuffer mVertexBuffer;  // 버텍스 버퍼
 		DX12IndexBuffer mIndexBuffer;    // 인덱스 버퍼 (선택적)
 		D3D12_INPUT_LAYOUT_DESC mInputLayout = {};
+		Math::AABB mLocalBounds;         // 로컬 AABB
+		Math::BoundingSphere mLocalSphere; // 로컬 경계 구
 		bool mInitialized = false;       // 초기화 여부
 	};
 
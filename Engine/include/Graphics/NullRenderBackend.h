@@ -0,0 +1,56 @@
+﻿#pragma once
+#include "Graphics/RenderCommand.h"
+#include "Core/Types.h"
+#include <array>
+
+namespace Graphics
+{
+	/**
+	 * @brief NullRenderBackend 실행 통계
+	 */
+	struct RenderBackendStats
+	{
+		std::array<Core::uint64, static_cast<size_t>(RenderCommandType::Count)> commandCounts{};
+		Core::uint64 commandCount = 0;
+		Core::uint64 drawCount = 0;
+		Core::uint64 instanceCount = 0;
+		Core::uint64 errorCount = 0;
+
+		Core::uint64 GetCount(RenderCommandType type) const { return commandCounts[static_cast<size_t>(type)]; }
+	};
+
+	/**
+	 * @brief GPU 없이 렌더 명령 스트림을 세고 검증하는 백엔드
+	 *
+	 * 명령을 실행하지 않고 DX12RenderBackend가 커맨드 리스트에 기록할 내용이 유효한지 확인합니다.
+	 * Submit()마다 새 커맨드 리스트처럼 바인딩 상태를 초기화합니다.
+	 * - PSO/Mesh/GPU 주소가 비어 있지 않은지, Root 슬롯이 범위 안인지, CBV가 256바이트 정렬인지
+	 * - Draw 전에 PSO, Mesh, 모든 Root 슬롯이 설정되었는지
+	 * - 인스턴스 수가 0이 아니고 Draw 범위가 바인딩된 Mesh 범위(SetMesh의 MeshExtent) 안인지
+	 *
+	 * Mesh를 역참조하지 않으므로 D3D12 헤더 없이 빌드됩니다.
+	 * 헤드리스 벤치마크와 회귀 테스트(Linux CI 포함)에 사용합니다.
+	 */
+	class NullRenderBackend
+	{
+	public:
+		/**
+		 * @brief 스트림 검증 및 통계 누적
+		 *
+		 * @return 검증 오류가 없으면 true
+		 */
+		bool Submit(const RenderCommandStream& stream);
+
+		void ResetStats() { mStats = {}; }
+		const RenderBackendStats& GetStats() const { return mStats; }
+
+	private:
+		static constexpr Core::uint32 MAX_REPORTED_ERRORS = 8;  // Submit당 로그 출력 수
+
+		void ReportError(size_t commandIndex, const char* message);
+
+		RenderBackendStats mStats;
+		Core::uint32 mReportedErrors = 0;
+	};
+
+} // namespace Graphics
@@ -0,0 +1,91 @@
+﻿#pragma once
+#include "Graphics/RenderCommand.h"
+#include "Graphics/RenderCommandBuilder.h"
+#include "Core/Types.h"
+#include <span>
+#include <vector>
+
+namespace Graphics
+{
+	/**
+	 * @brief 정렬된 RenderItem 목록을 청크로 나눠 워커 스레드에서 청크별 명령 스트림으로 기록하는 클래스
+	 *
+	 * 아이템을 연속 구간(청크)으로 나누고, 청크마다 별도의 RenderCommandBuilder와 RenderCommandStream으로
+	 * JobSystem의 ParallelFor에서 동시에 기록합니다. 호출자는 GetStream(0..N-1)을 순서대로 제출하면
+	 * 직렬로 기록한 것과 같은 순서로 그려집니다.
+	 *
+	 * - 청크 경계는 가능하면 (Mesh, Material)이 바뀌는 위치로 옮겨 배치가 끊기지 않게 합니다.
+	 * - 청크 스트림은 독립적으로 유효하도록 모든 바인딩을 처음부터 다시 기록합니다
+	 *   (청크당 PSO/Material/Mesh 바인딩이 최대 한 번씩 늘어남).
+	 * - provider는 청크마다 하나씩 받습니다. 업로드 메모리는 provider별로 분리되어야 하고,
+	 *   PSO/Material 상수 조회는 여러 스레드에서 동시에 호출될 수 있습니다.
+	 *
+	 * JobSystem이 없거나 JobSystem 외부 스레드에서 호출하면 청크를 순서대로 직렬 기록합니다.
+	 *
+	 * @note 스레드 안전하지 않음 (Encode는 한 스레드에서만 호출)
+	 */
+	class ParallelCommandEncoder
+	{
+	public:
+		// 청크 하나가 맡을 최소 아이템 수 (이보다 적으면 Job 분배 비용이 더 큼)
+		static constexpr Core::uint32 MIN_ITEMS_PER_CHUNK = 1024;
+
+		/**
+		 * @brief 아이템 수와 JobSystem 스레드 수로 청크 수 결정
+		 *
+		 * @param itemCount 기록할 아이템 수
+		 * @param minItemsPerChunk 청크당 최소 아이템 수
+		 * @return 1 이상 (JobSystem을 사용할 수 없으면 1)
+		 */
+		static Core::uint32 ComputeChunkCount(size_t itemCount, Core::uint32 minItemsPerChunk = MIN_ITEMS_PER_CHUNK);
+
+		/**
+		 * @brief items를 providers.size()개 청크로 나눠 청크별 스트림에 기록
+		 *
+		 * @param items 그리기 순서로 정렬된 아이템
+		 * @param providers 청크별 리소스 조회 (개수 = 청크 수)
+		 * @param preamble 청크 스트림마다 먼저 복사할 명령 (조명 등 공유 바인딩, nullptr 가능)
+		 * @return 모든 청크가 성공하면 true (실패한 청크도 그때까지 기록한 명령은 유지)
+		 */
+		bool Encode(
+			std::span<const RenderItem> items,
+			std::span<IRenderResourceProvider* const> providers,
+			const RenderCommandStream* preamble = nullptr
+		);
+
+		Core::uint32 GetChunkCount() const { return mChunkCount; }
+
+		/// 청크 스트림 (chunkIndex 순서로 제출)
+		const RenderCommandStream& GetStream(Core::uint32 chunkIndex) const;
+
+		/// 청크가 맡은 아이템 구간
+		Core::uint32 GetChunkFirstItem(Core::uint32 chunkIndex) const;
+		Core::uint32 GetChunkItemCount(Core::uint32 chunkIndex) const;
+
+		/// 모든 청크 스트림의 명령 수 합계
+		size_t GetCommandCount() const;
+
+	private:
+		struct Chunk
+		{
+			RenderCommandBuilder builder;
+			RenderCommandStream stream;
+			Core::uint32 firstItem = 0;
+			Core::uint32 itemCount = 0;
+			bool succeeded = true;
+		};
+
+		void SplitChunks(std::span<const RenderItem> items, Core::uint32 chunkCount);
+		void EncodeChunk(
+			Chunk& chunk,
+			std::span<const RenderItem> items,
+			IRenderResourceProvider& provider,
+			const RenderCommandStream* preamble
+		);
+
+		// 작업 버퍼 재사용을 위해 줄이지 않음 (활성 청크는 앞의 mChunkCount개)
+		std::vector<Chunk> mChunks;
+		Core::uint32 mChunkCount = 0;
+	};
+
+} // namespace Graphics
@@ -0,0 +1,184 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include <type_traits>
+#include <vector>
+
+namespace Graphics
+{
+	class Mesh;
+
+	/**
+	 * @brief 기본 Root Signature 슬롯 (DX12Renderer::CreateDefaultRootSignature과 일치)
+	 */
+	enum class RootSlot : Core::uint8
+	{
+		ObjectConstants = 0,    // b0: Object Constants (인스턴싱 미지원 셰이더)
+		MaterialConstants,      // b1: Material 상수
+		Lighting,               // b2: 조명
+		MaterialTextures,       // t0~t6: Material 텍스처 Descriptor Table
+		InstanceBuffer,         // t0, space1: StructuredBuffer<InstanceData>
+
+		Count
+	};
+
+	/**
+	 * @brief 렌더 명령 종류
+	 */
+	enum class RenderCommandType : Core::uint8
+	{
+		SetPipelineState,
+		SetConstantBuffer,      // Root CBV
+		SetShaderResource,      // Root SRV
+		SetDescriptorTable,
+		SetMesh,                // Vertex/Index Buffer 바인딩
+		DrawIndexed,
+		DrawInstanced,
+
+		Count
+	};
+
+	struct DrawIndexedArgs
+	{
+		Core::uint32 indexCount;
+		Core::uint32 instanceCount;
+		Core::uint32 startIndex;
+		Core::int32 baseVertex;
+		Core::uint32 startInstance;
+	};
+
+	struct DrawInstancedArgs
+	{
+		Core::uint32 vertexCount;
+		Core::uint32 instanceCount;
+		Core::uint32 startVertex;
+		Core::uint32 startInstance;
+	};
+
+	/**
+	 * @brief Mesh의 그리기 범위 (Graphics::Mesh 없이 Draw 인자 생성과 검증에 사용)
+	 */
+	struct MeshExtent
+	{
+		Core::uint32 vertexCount;
+		Core::uint32 indexCount;    // 0이면 Index Buffer 없음 (DrawInstanced)
+	};
+
+	struct SetMeshArgs
+	{
+		const Mesh* mesh;           // 백엔드가 바인딩할 Mesh (DX12: Vertex/Index Buffer View)
+		MeshExtent extent;          // 헤드리스 검증용 범위
+	};
+
+	/**
+	 * @brief 그래픽 API에 의존하지 않는 고정 크기(32바이트) POD 렌더 명령
+	 *
+	 * GPU 주소와 Descriptor Handle은 64비트 값, PSO와 Mesh는 백엔드가 해석하는 불투명 포인터입니다.
+	 * 이 헤더와 명령 생성 경로(RenderCommandBuilder, InstanceBatcher, NullRenderBackend)는 D3D12 헤더 없이 컴파일됩니다.
+	 */
+	struct RenderCommand
+	{
+		RenderCommandType type;
+		RootSlot slot;                      // Set* 명령의 Root 슬롯
+
+		union
+		{
+			const void* pipelineState;      // SetPipelineState (DX12: ID3D12PipelineState*)
+			Core::uint64 gpuAddress;        // SetConstantBuffer / SetShaderResource
+			Core::uint64 descriptorHandle;  // SetDescriptorTable (GPU Descriptor Handle)
+			SetMeshArgs setMesh;            // SetMesh
+			DrawIndexedArgs drawIndexed;
+			DrawInstancedArgs drawInstanced;
+		};
+	};
+
+	static_assert(std::is_trivially_copyable_v<RenderCommand>, "RenderCommand must be POD");
+	static_assert(sizeof(RenderCommand) == 32, "RenderCommand should stay 32 bytes");
+
+	/**
+	 * @brief 렌더 명령 스트림 (기록 순서 = 실행 순서)
+	 *
+	 * 렌더러 프론트엔드(RenderCommandBuilder)가 기록하고 백엔드(DX12RenderBackend, NullRenderBackend)가 실행합니다.
+	 * Clear()는 용량을 유지하므로 프레임마다 같은 스트림을 재사용하세요.
+	 */
+	class RenderCommandStream
+	{
+	public:
+		void Clear() { mCommands.clear(); }
+		void Reserve(size_t commandCount) { mCommands.reserve(commandCount); }
+
+		void SetPipelineState(const void* pipelineState)
+		{
+			RenderCommand& command = Push(RenderCommandType::SetPipelineState, RootSlot::Count);
+			command.pipelineState = pipelineState;
+		}
+
+		void SetConstantBuffer(RootSlot slot, Core::uint64 gpuAddress)
+		{
+			RenderCommand& command = Push(RenderCommandType::SetConstantBuffer, slot);
+			command.gpuAddress = gpuAddress;
+		}
+
+		void SetShaderResource(RootSlot slot, Core::uint64 gpuAddress)
+		{
+			RenderCommand& command = Push(RenderCommandType::SetShaderResource, slot);
+			command.gpuAddress = gpuAddress;
+		}
+
+		void SetDescriptorTable(RootSlot slot, Core::uint64 descriptorHandle)
+		{
+			RenderCommand& command = Push(RenderCommandType::SetDescriptorTable, slot);
+			command.descriptorHandle = descriptorHandle;
+		}
+
+		void SetMesh(const Mesh* mesh, MeshExtent extent)
+		{
+			RenderCommand& command = Push(RenderCommandType::SetMesh, RootSlot::Count);
+			command.setMesh = { mesh, extent };
+		}
+
+		void DrawIndexed(
+			Core::uint32 indexCount,
+			Core::uint32 instanceCount,
+			Core::uint32 startIndex = 0,
+			Core::int32 baseVertex = 0,
+			Core::uint32 startInstance = 0
+		)
+		{
+			RenderCommand& command = Push(RenderCommandType::DrawIndexed, RootSlot::Count);
+			command.drawIndexed = { indexCount, instanceCount, startIndex, baseVertex, startInstance };
+		}
+
+		void DrawInstanced(
+			Core::uint32 vertexCount,
+			Core::uint32 instanceCount,
+			Core::uint32 startVertex = 0,
+			Core::uint32 startInstance = 0
+		)
+		{
+			RenderCommand& command = Push(RenderCommandType::DrawInstanced, RootSlot::Count);
+			command.drawInstanced = { vertexCount, instanceCount, startVertex, startInstance };
+		}
+
+		/// 다른 스트림의 명령을 끝에 이어 붙임
+		void Append(const RenderCommandStream& other)
+		{
+			mCommands.insert(mCommands.end(), other.mCommands.begin(), other.mCommands.end());
+		}
+
+		const std::vector<RenderCommand>& GetCommands() const { return mCommands; }
+		size_t GetCommandCount() const { return mCommands.size(); }
+		bool IsEmpty() const { return mCommands.empty(); }
+
+	private:
+		RenderCommand& Push(RenderCommandType type, RootSlot slot)
+		{
+			RenderCommand& command = mCommands.emplace_back();
+			command.type = type;
+			command.slot = slot;
+			return command;
+		}
+
+		std::vector<RenderCommand> mCommands;
+	};
+
+} // namespace Graphics
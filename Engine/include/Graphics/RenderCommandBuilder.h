@@ -0,0 +1,104 @@
+﻿#pragma once
+#include "Graphics/InstanceBatcher.h"
+#include "Graphics/RenderCommand.h"
+#include "Core/Types.h"
+#include <span>
+#include <vector>
+
+namespace Graphics
+{
+	class Material;
+	class Mesh;
+
+	/**
+	 * @brief 프레임 업로드 메모리 영역 (CPU 기록 주소 + GPU 주소)
+	 */
+	struct UploadRegion
+	{
+		void* cpuAddress = nullptr;
+		Core::uint64 gpuAddress = 0;
+	};
+
+	/**
+	 * @brief 렌더 명령 생성에 필요한 백엔드 리소스 조회 인터페이스
+	 *
+	 * DX12Renderer가 PSO 캐시/Material 상수 풀/업로드 할당자로 구현하고,
+	 * 헤드리스 테스트는 가짜 주소를 돌려주는 구현을 사용합니다.
+	 * Material/Mesh 정보도 이 인터페이스로 얻으므로 명령 생성 경로는 D3D12 헤더에 의존하지 않습니다.
+	 */
+	class IRenderResourceProvider
+	{
+	public:
+		virtual ~IRenderResourceProvider() = default;
+
+		/// Material과 Mesh 입력 레이아웃에 맞는 PSO (nullptr이면 배치를 건너뜀)
+		virtual const void* GetPipelineState(const Material& material, const Mesh& mesh) = 0;
+
+		/// Material이 인스턴스 Draw를 지원하는지 (MaterialDesc::instancing)
+		virtual bool SupportsInstancing(const Material& material) = 0;
+
+		/// Mesh의 정점/인덱스 수
+		virtual MeshExtent GetMeshExtent(const Mesh& mesh) = 0;
+
+		/// Material 상수(b1) GPU 주소 (0이면 배치를 건너뜀)
+		virtual Core::uint64 GetMaterialConstants(const Material& material) = 0;
+
+		/// Material 텍스처 Descriptor Table (0이면 할당되지 않음)
+		virtual Core::uint64 GetMaterialDescriptorTable(const Material& material) = 0;
+
+		/// 프레임 업로드 메모리 할당 (256바이트 정렬, 실패 시 cpuAddress == nullptr)
+		virtual UploadRegion AllocateUpload(size_t size) = 0;
+	};
+
+	/**
+	 * @brief 정렬된 RenderItem 목록을 렌더 명령 스트림으로 변환하는 렌더러 프론트엔드
+	 *
+	 * InstanceBatcher로 (Mesh, Material) 배치를 만들고 인스턴스 데이터를 업로드 메모리에 기록한 뒤,
+	 * 직전과 같은 PSO/Material/Mesh 바인딩은 생략하며 명령을 기록합니다.
+	 * - 인스턴싱 Material: 배치마다 Instance Buffer(t0, space1) 설정 + Draw 1회
+	 * - 그 외: 아이템마다 256바이트 간격 슬롯에 기록, b0와 Instance Buffer를 모두 그 슬롯으로 설정 + Draw 1회
+	 *   (인스턴스 버퍼만 읽는 셰이더도 instanceID 0으로 올바른 행렬을 읽음)
+	 *
+	 * 업로드 메모리는 호출당 한 번 할당하며, 아이템마다 인스턴스 데이터를 한 번만 기록합니다.
+	 *
+	 * Root Signature, Descriptor Heap, 조명(b2)은 호출자가 설정합니다.
+	 *
+	 * @note 스레드 안전하지 않음 (스레드마다 별도 인스턴스 사용)
+	 */
+	class RenderCommandBuilder
+	{
+	public:
+		/**
+		 * @brief items를 그리는 명령을 stream 끝에 추가
+		 *
+		 * @param items 그리기 순서로 정렬된 아이템 (병렬 기록 시 청크 구간)
+		 * @param provider 백엔드 리소스 조회
+		 * @param stream 명령을 기록할 스트림
+		 * @return 업로드 메모리 할당 실패 시 false (그때까지 기록한 명령은 유지)
+		 */
+		bool Build(
+			std::span<const RenderItem> items,
+			IRenderResourceProvider& provider,
+			RenderCommandStream& stream
+		);
+
+		const InstanceBatcher& GetBatcher() const { return mBatcher; }
+
+	private:
+		// Object Constants(b0) 슬롯 간격 (D3D12 CBV 주소 정렬)
+		static constexpr size_t OBJECT_CONSTANTS_STRIDE = 256;
+
+		static size_t AlignObjectConstants(size_t size)
+		{
+			return (size + OBJECT_CONSTANTS_STRIDE - 1) & ~(OBJECT_CONSTANTS_STRIDE - 1);
+		}
+
+		static void EmitDraw(RenderCommandStream& stream, const MeshExtent& extent, Core::uint32 instanceCount);
+
+		InstanceBatcher mBatcher;
+
+		// 배치별 인스턴싱 여부 (작업 버퍼 재사용)
+		std::vector<bool> mBatchInstancing;
+	};
+
+} // namespace Graphics
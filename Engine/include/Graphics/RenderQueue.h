@@ -0,0 +1,155 @@
+﻿#pragma once
+#include "Graphics/RenderTypes.h"
+#include "Core/Types.h"
+#include <bit>
+#include <vector>
+
+namespace Graphics
+{
+	//=============================================================================
+	// 정렬 키 (64비트)
+	//=============================================================================
+	//
+	// 불투명: [63:62 레이어][61:46 파이프라인][45:30 머티리얼][29:14 메시][13:0 깊이]
+	//   - 상태 순으로 묶고, 같은 상태 안에서는 앞에서 뒤로 (Early-Z)
+	// 투명:   [63:62 레이어][61:38 깊이 반전][37:22 파이프라인][21:11 머티리얼][10:0 메시]
+	//   - 뒤에서 앞으로 (올바른 블렌딩), 깊이가 같을 때만 상태로 묶음
+	//
+	// 파이프라인/머티리얼/메시 필드는 64비트 해시/ID를 필드 폭으로 접은 값이므로
+	// 서로 다른 리소스가 같은 값이 될 수 있습니다 (정렬 순서에만 영향).
+
+	constexpr Core::uint32 SORT_KEY_LAYER_SHIFT = 62;
+
+	constexpr Core::uint32 OPAQUE_PIPELINE_BITS = 16;
+	constexpr Core::uint32 OPAQUE_MATERIAL_BITS = 16;
+	constexpr Core::uint32 OPAQUE_MESH_BITS = 16;
+	constexpr Core::uint32 OPAQUE_DEPTH_BITS = 14;
+
+	constexpr Core::uint32 TRANSPARENT_DEPTH_BITS = 24;
+	constexpr Core::uint32 TRANSPARENT_PIPELINE_BITS = 16;
+	constexpr Core::uint32 TRANSPARENT_MATERIAL_BITS = 11;
+	constexpr Core::uint32 TRANSPARENT_MESH_BITS = 11;
+
+	/**
+	 * @brief 64비트 해시/ID를 bits 폭으로 축소 (피보나치 해싱, 상위 비트 사용)
+	 */
+	inline Core::uint64 FoldSortKeyId(Core::uint64 value, Core::uint32 bits)
+	{
+		return (value * 0x9E3779B97F4A7C15ull) >> (64 - bits);
+	}
+
+	/**
+	 * @brief 뷰 공간 깊이를 bits 폭 정수로 양자화
+	 *
+	 * 양수 float의 비트 표현은 크기 순서와 같으므로 상위 비트를 그대로 사용합니다.
+	 * (가까운 거리일수록 정밀도가 높은 로그 분포, 0 이하/NaN은 0)
+	 */
+	inline Core::uint64 QuantizeSortDepth(Core::float32 viewDepth, Core::uint32 bits)
+	{
+		if (!(viewDepth > 0.0f))
+		{
+			return 0;
+		}
+		return std::bit_cast<Core::uint32>(viewDepth) >> (31 - bits);
+	}
+
+	/**
+	 * @brief 불투명 아이템 정렬 키 (상태 우선, 앞에서 뒤로)
+	 *
+	 * @param pipelineHash 파이프라인 상태 해시 (Material::GetHash)
+	 * @param materialId 머티리얼 식별자 (ResourceId 등)
+	 * @param meshId 메시 식별자 (ResourceId 등)
+	 * @param viewDepth 카메라 기준 뷰 공간 깊이
+	 */
+	inline Core::uint64 MakeOpaqueSortKey(
+		RenderLayer layer,
+		Core::uint64 pipelineHash,
+		Core::uint64 materialId,
+		Core::uint64 meshId,
+		Core::float32 viewDepth
+	)
+	{
+		return (static_cast<Core::uint64>(layer) << SORT_KEY_LAYER_SHIFT)
+			| (FoldSortKeyId(pipelineHash, OPAQUE_PIPELINE_BITS) << (OPAQUE_MATERIAL_BITS + OPAQUE_MESH_BITS + OPAQUE_DEPTH_BITS))
+			| (FoldSortKeyId(materialId, OPAQUE_MATERIAL_BITS) << (OPAQUE_MESH_BITS + OPAQUE_DEPTH_BITS))
+			| (FoldSortKeyId(meshId, OPAQUE_MESH_BITS) << OPAQUE_DEPTH_BITS)
+			| QuantizeSortDepth(viewDepth, OPAQUE_DEPTH_BITS);
+	}
+
+	/**
+	 * @brief 투명 아이템 정렬 키 (뒤에서 앞으로, 같은 깊이에서 상태로 묶음)
+	 */
+	inline Core::uint64 MakeTransparentSortKey(
+		RenderLayer layer,
+		Core::uint64 pipelineHash,
+		Core::uint64 materialId,
+		Core::uint64 meshId,
+		Core::float32 viewDepth
+	)
+	{
+		const Core::uint64 depthMask = (1ull << TRANSPARENT_DEPTH_BITS) - 1;
+		const Core::uint64 invertedDepth = depthMask - QuantizeSortDepth(viewDepth, TRANSPARENT_DEPTH_BITS);
+
+		return (static_cast<Core::uint64>(layer) << SORT_KEY_LAYER_SHIFT)
+			| (invertedDepth << (TRANSPARENT_PIPELINE_BITS + TRANSPARENT_MATERIAL_BITS + TRANSPARENT_MESH_BITS))
+			| (FoldSortKeyId(pipelineHash, TRANSPARENT_PIPELINE_BITS) << (TRANSPARENT_MATERIAL_BITS + TRANSPARENT_MESH_BITS))
+			| (FoldSortKeyId(materialId, TRANSPARENT_MATERIAL_BITS) << TRANSPARENT_MESH_BITS)
+			| FoldSortKeyId(meshId, TRANSPARENT_MESH_BITS);
+	}
+
+	/// 정렬 키의 레이어
+	inline RenderLayer GetSortKeyLayer(Core::uint64 sortKey)
+	{
+		return static_cast<RenderLayer>(sortKey >> SORT_KEY_LAYER_SHIFT);
+	}
+
+	//=============================================================================
+	// 정렬
+	//=============================================================================
+
+	/**
+	 * @brief RenderItem을 sortKey 오름차순으로 정렬 (안정 정렬, O(n))
+	 *
+	 * 8비트 자리 8개의 LSD 기수 정렬입니다.
+	 * - 히스토그램은 한 번의 순회로 모든 자리를 계산하고, 모든 키가 같은 자리는 건너뜀
+	 * - 키와 인덱스(16바이트)만 정렬한 뒤 RenderItem은 마지막에 한 번만 재배치
+	 * - 작은 입력은 삽입 정렬
+	 *
+	 * 작업 버퍼를 재사용하므로 프레임마다 같은 인스턴스를 사용하세요.
+	 *
+	 * @note 스레드 안전하지 않음 (스레드마다 별도 인스턴스 사용)
+	 */
+	class RenderQueueSorter
+	{
+	public:
+		// 이 개수 이하이면 삽입 정렬
+		static constexpr Core::uint32 SMALL_SORT_THRESHOLD = 64;
+
+		void Sort(std::vector<RenderItem>& items);
+
+	private:
+		struct SortEntry
+		{
+			Core::uint64 key;
+			Core::uint32 index;
+		};
+
+		std::vector<SortEntry> mEntries;
+		std::vector<SortEntry> mScratch;
+		std::vector<RenderItem> mItemScratch;
+	};
+
+	/**
+	 * @brief 연속한 아이템 사이의 상태 변경 횟수 (첫 아이템의 바인딩 포함)
+	 */
+	struct RenderStateChanges
+	{
+		Core::uint32 pipelineChanges = 0;   // Material::GetHash가 바뀐 횟수 (PSO 교체)
+		Core::uint32 materialChanges = 0;   // Material이 바뀐 횟수 (상수/Descriptor Table 교체)
+		Core::uint32 meshChanges = 0;       // Mesh가 바뀐 횟수 (정점/인덱스 버퍼 교체)
+	};
+
+	/// 아이템을 주어진 순서대로 그릴 때의 상태 변경 횟수 계산
+	RenderStateChanges CountStateChanges(const std::vector<RenderItem>& items);
+
+} // namespace Graphics
@@ -1,5 +1,5 @@
 ﻿#pragma once
-#include "Graphics/GraphicsTypes.h"
+#include "Core/Types.h"
 #include "Math/MathTypes.h"
 #include "Math/MathUtils.h"
 #include "ECS/Entity.h" 
@@ -20,6 +20,8 @@ namespace Graphics
 		const Material* material = nullptr;
 		Math::Matrix4x4 worldMatrix = Math::Matrix4x4::Identity();
 		Math::Matrix4x4 mvpMatrix = Math::Matrix4x4::Identity();
+		Math::Matrix4x4 normalMatrix = Math::Matrix4x4::Identity();  // World 역전치 (노멀 변환용)
+		Core::uint64 sortKey = 0;   // 그리기 순서 (RenderQueue.h의 MakeOpaqueSortKey / MakeTransparentSortKey)
 	};
 
 	/**
@@ -64,6 +66,23 @@ namespace Graphics
 		}
 	};
 
+	/**
+	 * @brief 프레임별 렌더링 통계 (PerformancePanel 표시용)
+	 */
+	struct RenderStats
+	{
+		Core::uint32 renderableCount = 0;   // 수집 대상 Renderable Entity 수
+		Core::uint32 visibleCount = 0;      // 렌더 아이템으로 출력된 수
+		Core::uint32 culledCount = 0;       // 절두체 컬링으로 제외된 수
+
+		void Clear()
+		{
+			renderableCount = 0;
+			visibleCount = 0;
+			culledCount = 0;
+		}
+	};
+
 	/**
 	 * @brief 프레임별 렌더링 데이터
 	 *
@@ -87,6 +106,9 @@ namespace Graphics
 		// Debug 시각화 데이터
 		DebugInfo debug;
 
+		// 통계
+		RenderStats stats;
+
 		void Clear()
 		{
 			opaqueItems.clear();
@@ -94,11 +116,12 @@ namespace Graphics
 			directionalLights.clear();
 			pointLights.clear();
 			debug.Clear();
+			stats.Clear();
 		}
 	};
 
 	/**
-	 * @brief 렌더 레이어 (향후 확장)
+	 * @brief 렌더 레이어 (정렬 키 최상위 2비트, 값이 작을수록 먼저 그림)
 	 */
 	enum class RenderLayer : Core::uint8
 	{
@@ -0,0 +1,418 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Math/MathTypes.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+namespace Math
+{
+	//=============================================================================
+	// 경계 볼륨 (Bounding Volume)
+	//
+	// 컬링과 공간 질의에 쓰는 단순 도형입니다.
+	// 행렬은 엔진 규약(행 벡터, v * M)을 따릅니다.
+	//=============================================================================
+
+	/**
+	 * @brief 축 정렬 경계 상자 (중심 + 반 크기)
+	 *
+	 * 평면 판정이 중심과의 거리 + 투영 반경 비교 한 번으로 끝나므로 min/max 대신 이 형식으로 저장합니다.
+	 */
+	struct AABB
+	{
+		Vector3 center = Vector3::Zero();
+		Vector3 extents = Vector3::Zero();   // 각 축 반 크기 (>= 0)
+
+		static AABB FromMinMax(const Vector3& minPoint, const Vector3& maxPoint) noexcept
+		{
+			AABB box;
+			box.center = (minPoint + maxPoint) * 0.5f;
+			box.extents = (maxPoint - minPoint) * 0.5f;
+			return box;
+		}
+
+		Vector3 GetMin() const noexcept { return center - extents; }
+		Vector3 GetMax() const noexcept { return center + extents; }
+
+		/// 표면적 (SAH 비용 계산용)
+		Core::float32 GetSurfaceArea() const noexcept
+		{
+			return 8.0f * (extents.x * extents.y + extents.y * extents.z + extents.z * extents.x);
+		}
+	};
+
+	/**
+	 * @brief 경계 구
+	 */
+	struct BoundingSphere
+	{
+		Vector3 center = Vector3::Zero();
+		Core::float32 radius = 0.0f;
+	};
+
+	/**
+	 * @brief 절두체 (안쪽을 향하는 정규화된 평면 6개)
+	 *
+	 * 평면 (a, b, c, d)는 점 p에 대해 a * p.x + b * p.y + c * p.z + d >= 0 이면 안쪽입니다.
+	 */
+	struct Frustum
+	{
+		enum PlaneIndex : Core::uint32
+		{
+			Left = 0,
+			Right,
+			Bottom,
+			Top,
+			Near,
+			Far,
+			PLANE_COUNT
+		};
+
+		Vector4 planes[PLANE_COUNT];
+	};
+
+	/**
+	 * @brief 절두체 판정 결과 (계층 순회에서 완전 포함이면 자식 판정을 생략)
+	 */
+	enum class Containment : Core::uint8
+	{
+		Outside = 0,    // 완전히 바깥
+		Intersects,     // 경계에 걸침
+		Inside          // 완전히 안쪽
+	};
+
+	//=============================================================================
+	// 생성
+	//=============================================================================
+
+	/**
+	 * @brief 정점 배열의 로컬 AABB와 경계 구 계산
+	 *
+	 * 구의 중심은 AABB 중심, 반지름은 중심에서 가장 먼 정점까지의 거리입니다.
+	 *
+	 * @tparam Vertex position(Vector3) 멤버를 가진 정점 형식
+	 */
+	template<typename Vertex>
+	inline void ComputeBounds(const Vertex* vertices, size_t vertexCount, AABB& outBox, BoundingSphere& outSphere) noexcept
+	{
+		if (!vertices || vertexCount == 0)
+		{
+			outBox = AABB{};
+			outSphere = BoundingSphere{};
+			return;
+		}
+
+		Vector3 minPoint = vertices[0].position;
+		Vector3 maxPoint = vertices[0].position;
+		for (size_t i = 1; i < vertexCount; ++i)
+		{
+			const Vector3& p = vertices[i].position;
+			minPoint = Vector3(std::min(minPoint.x, p.x), std::min(minPoint.y, p.y), std::min(minPoint.z, p.z));
+			maxPoint = Vector3(std::max(maxPoint.x, p.x), std::max(maxPoint.y, p.y), std::max(maxPoint.z, p.z));
+		}
+
+		outBox = AABB::FromMinMax(minPoint, maxPoint);
+
+		Core::float32 maxDistanceSq = 0.0f;
+		for (size_t i = 0; i < vertexCount; ++i)
+		{
+			maxDistanceSq = std::max(maxDistanceSq, (vertices[i].position - outBox.center).LengthSquared());
+		}
+
+		outSphere.center = outBox.center;
+		outSphere.radius = std::sqrt(maxDistanceSq);
+	}
+
+	/**
+	 * @brief View * Projection 행렬에서 절두체 평면 추출 (Gribb-Hartmann)
+	 *
+	 * 클립 공간 조건 -w <= x, y <= w, 0 <= z <= w (D3D 규약)를 행렬 열의 조합으로 바꾼 뒤 정규화합니다.
+	 *
+	 * @param viewProjection 월드 -> 클립 변환 행렬
+	 */
+	inline Frustum ExtractFrustum(const Matrix4x4& viewProjection) noexcept
+	{
+		const auto& m = viewProjection.m;
+		const Vector4 col0(m[0][0], m[1][0], m[2][0], m[3][0]);
+		const Vector4 col1(m[0][1], m[1][1], m[2][1], m[3][1]);
+		const Vector4 col2(m[0][2], m[1][2], m[2][2], m[3][2]);
+		const Vector4 col3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+		Frustum frustum;
+		frustum.planes[Frustum::Left] = col3 + col0;
+		frustum.planes[Frustum::Right] = col3 - col0;
+		frustum.planes[Frustum::Bottom] = col3 + col1;
+		frustum.planes[Frustum::Top] = col3 - col1;
+		frustum.planes[Frustum::Near] = col2;
+		frustum.planes[Frustum::Far] = col3 - col2;
+
+		for (Vector4& plane : frustum.planes)
+		{
+			const Core::float32 length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+			if (length > 0.0f)
+			{
+				plane = plane * (1.0f / length);
+			}
+		}
+
+		return frustum;
+	}
+
+	//=============================================================================
+	// 변환
+	//=============================================================================
+
+	/**
+	 * @brief 로컬 AABB를 월드 AABB로 변환 (Arvo 방식)
+	 *
+	 * 중심은 점 변환, 반 크기는 행렬 3x3 부분의 절댓값으로 변환합니다.
+	 * 회전이 있으면 결과는 변환된 상자를 감싸는 (더 큰) 축 정렬 상자입니다.
+	 */
+	inline AABB TransformAABB(const AABB& box, const Matrix4x4& matrix) noexcept
+	{
+		const auto& m = matrix.m;
+		const Vector3& c = box.center;
+		const Vector3& e = box.extents;
+
+		AABB result;
+		result.center = Vector3(
+			((c.x * m[0][0] + c.y * m[1][0]) + c.z * m[2][0]) + m[3][0],
+			((c.x * m[0][1] + c.y * m[1][1]) + c.z * m[2][1]) + m[3][1],
+			((c.x * m[0][2] + c.y * m[1][2]) + c.z * m[2][2]) + m[3][2]
+		);
+		result.extents = Vector3(
+			(e.x * std::abs(m[0][0]) + e.y * std::abs(m[1][0])) + e.z * std::abs(m[2][0]),
+			(e.x * std::abs(m[0][1]) + e.y * std::abs(m[1][1])) + e.z * std::abs(m[2][1]),
+			(e.x * std::abs(m[0][2]) + e.y * std::abs(m[1][2])) + e.z * std::abs(m[2][2])
+		);
+		return result;
+	}
+
+	/// @brief TransformAABB의 Matrix3x4 버전 (m[r][c] = Matrix4x4::m[c][r])
+	inline AABB TransformAABB(const AABB& box, const Matrix3x4& matrix) noexcept
+	{
+		const auto& m = matrix.m;
+		const Vector3& c = box.center;
+		const Vector3& e = box.extents;
+
+		AABB result;
+		result.center = Vector3(
+			((c.x * m[0][0] + c.y * m[0][1]) + c.z * m[0][2]) + m[0][3],
+			((c.x * m[1][0] + c.y * m[1][1]) + c.z * m[1][2]) + m[1][3],
+			((c.x * m[2][0] + c.y * m[2][1]) + c.z * m[2][2]) + m[2][3]
+		);
+		result.extents = Vector3(
+			(e.x * std::abs(m[0][0]) + e.y * std::abs(m[0][1])) + e.z * std::abs(m[0][2]),
+			(e.x * std::abs(m[1][0]) + e.y * std::abs(m[1][1])) + e.z * std::abs(m[1][2]),
+			(e.x * std::abs(m[2][0]) + e.y * std::abs(m[2][1])) + e.z * std::abs(m[2][2])
+		);
+		return result;
+	}
+
+	/**
+	 * @brief 로컬 경계 구를 월드 경계 구로 변환
+	 * @note 반지름에는 가장 큰 축 스케일을 곱함 (비균등 스케일이면 보수적인 구)
+	 */
+	inline BoundingSphere TransformSphere(const BoundingSphere& sphere, const Matrix4x4& matrix) noexcept
+	{
+		const auto& m = matrix.m;
+		const Vector3& c = sphere.center;
+
+		const Core::float32 scaleSq = std::max({
+			m[0][0] * m[0][0] + m[0][1] * m[0][1] + m[0][2] * m[0][2],
+			m[1][0] * m[1][0] + m[1][1] * m[1][1] + m[1][2] * m[1][2],
+			m[2][0] * m[2][0] + m[2][1] * m[2][1] + m[2][2] * m[2][2]
+		});
+
+		BoundingSphere result;
+		result.center = Vector3(
+			((c.x * m[0][0] + c.y * m[1][0]) + c.z * m[2][0]) + m[3][0],
+			((c.x * m[0][1] + c.y * m[1][1]) + c.z * m[2][1]) + m[3][1],
+			((c.x * m[0][2] + c.y * m[1][2]) + c.z * m[2][2]) + m[3][2]
+		);
+		result.radius = sphere.radius * std::sqrt(scaleSq);
+		return result;
+	}
+
+	/// @brief TransformSphere의 Matrix3x4 버전
+	inline BoundingSphere TransformSphere(const BoundingSphere& sphere, const Matrix3x4& matrix) noexcept
+	{
+		const auto& m = matrix.m;
+		const Vector3& c = sphere.center;
+
+		// 로컬 축 c의 월드 길이 = 열 c의 길이
+		const Core::float32 scaleSq = std::max({
+			m[0][0] * m[0][0] + m[1][0] * m[1][0] + m[2][0] * m[2][0],
+			m[0][1] * m[0][1] + m[1][1] * m[1][1] + m[2][1] * m[2][1],
+			m[0][2] * m[0][2] + m[1][2] * m[1][2] + m[2][2] * m[2][2]
+		});
+
+		BoundingSphere result;
+		result.center = Vector3(
+			((c.x * m[0][0] + c.y * m[0][1]) + c.z * m[0][2]) + m[0][3],
+			((c.x * m[1][0] + c.y * m[1][1]) + c.z * m[1][2]) + m[1][3],
+			((c.x * m[2][0] + c.y * m[2][1]) + c.z * m[2][2]) + m[2][3]
+		);
+		result.radius = sphere.radius * std::sqrt(scaleSq);
+		return result;
+	}
+
+	/// @brief 두 AABB를 모두 감싸는 AABB
+	inline AABB Merge(const AABB& a, const AABB& b) noexcept
+	{
+		const Vector3 aMin = a.GetMin(), aMax = a.GetMax();
+		const Vector3 bMin = b.GetMin(), bMax = b.GetMax();
+		return AABB::FromMinMax(
+			Vector3(std::min(aMin.x, bMin.x), std::min(aMin.y, bMin.y), std::min(aMin.z, bMin.z)),
+			Vector3(std::max(aMax.x, bMax.x), std::max(aMax.y, bMax.y), std::max(aMax.z, bMax.z))
+		);
+	}
+
+	//=============================================================================
+	// 판정 (단일 원소, 다수 원소는 MathBatch.h의 FrustumCullBatch 사용)
+	//=============================================================================
+
+	/// @brief outer가 inner를 완전히 포함하는지
+	inline bool Contains(const AABB& outer, const AABB& inner) noexcept
+	{
+		const Vector3 d = inner.center - outer.center;
+		return std::abs(d.x) + inner.extents.x <= outer.extents.x
+			&& std::abs(d.y) + inner.extents.y <= outer.extents.y
+			&& std::abs(d.z) + inner.extents.z <= outer.extents.z;
+	}
+
+	/// @brief 두 AABB가 겹치는지 (맞닿은 경우 포함)
+	inline bool Intersects(const AABB& a, const AABB& b) noexcept
+	{
+		const Vector3 d = a.center - b.center;
+		return std::abs(d.x) <= a.extents.x + b.extents.x
+			&& std::abs(d.y) <= a.extents.y + b.extents.y
+			&& std::abs(d.z) <= a.extents.z + b.extents.z;
+	}
+
+	/// @brief AABB와 구가 겹치는지 (상자 위 최근접점까지의 거리로 판정)
+	inline bool Intersects(const AABB& box, const BoundingSphere& sphere) noexcept
+	{
+		const Vector3 d = sphere.center - box.center;
+		const Core::float32 dx = std::max(std::abs(d.x) - box.extents.x, 0.0f);
+		const Core::float32 dy = std::max(std::abs(d.y) - box.extents.y, 0.0f);
+		const Core::float32 dz = std::max(std::abs(d.z) - box.extents.z, 0.0f);
+		return dx * dx + dy * dy + dz * dz <= sphere.radius * sphere.radius;
+	}
+
+	/**
+	 * @brief 반직선과 AABB 교차 (슬랩 방식)
+	 *
+	 * @param origin 반직선 시작점
+	 * @param inverseDirection 방향의 성분별 역수 (0 성분은 무한대가 되어도 됨)
+	 * @param maxDistance 검사할 최대 매개변수 t
+	 * @param outDistance 진입 지점의 t (시작점이 상자 안이면 0)
+	 * @return [0, maxDistance] 구간에서 교차하면 true
+	 */
+	inline bool IntersectsRay(
+		const AABB& box,
+		const Vector3& origin,
+		const Vector3& inverseDirection,
+		Core::float32 maxDistance,
+		Core::float32& outDistance
+	) noexcept
+	{
+		const Vector3 boxMin = box.GetMin();
+		const Vector3 boxMax = box.GetMax();
+
+		Core::float32 tMin = 0.0f;
+		Core::float32 tMax = maxDistance;
+
+		const Core::float32 o[3] = { origin.x, origin.y, origin.z };
+		const Core::float32 inv[3] = { inverseDirection.x, inverseDirection.y, inverseDirection.z };
+		const Core::float32 lo[3] = { boxMin.x, boxMin.y, boxMin.z };
+		const Core::float32 hi[3] = { boxMax.x, boxMax.y, boxMax.z };
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			Core::float32 t0 = (lo[axis] - o[axis]) * inv[axis];
+			Core::float32 t1 = (hi[axis] - o[axis]) * inv[axis];
+			if (t0 > t1)
+			{
+				std::swap(t0, t1);
+			}
+
+			// NaN(0 * 무한대, 시작점이 슬랩 경계 위)은 비교가 false가 되어 구간을 좁히지 않음
+			tMin = (t0 > tMin) ? t0 : tMin;
+			tMax = (t1 < tMax) ? t1 : tMax;
+			if (tMin > tMax)
+			{
+				return false;
+			}
+		}
+
+		outDistance = tMin;
+		return true;
+	}
+
+	/**
+	 * @brief AABB의 절두체 포함 관계 (바깥 / 걸침 / 안쪽)
+	 *
+	 * 모든 평면에 대해 (중심 거리 - 투영 반경) >= 0 이면 완전히 안쪽입니다.
+	 */
+	inline Containment ClassifyFrustum(const Frustum& frustum, const AABB& box) noexcept
+	{
+		bool inside = true;
+		for (const Vector4& plane : frustum.planes)
+		{
+			const Core::float32 distance =
+				((plane.x * box.center.x + plane.y * box.center.y) + plane.z * box.center.z) + plane.w;
+			const Core::float32 radius =
+				(std::abs(plane.x) * box.extents.x + std::abs(plane.y) * box.extents.y) + std::abs(plane.z) * box.extents.z;
+
+			if (distance + radius < 0.0f)
+			{
+				return Containment::Outside;
+			}
+			inside = inside && (distance - radius >= 0.0f);
+		}
+		return inside ? Containment::Inside : Containment::Intersects;
+	}
+
+	/**
+	 * @brief AABB가 절두체와 겹치거나 안에 있는지 (보수적 판정)
+	 *
+	 * 평면마다 중심 거리 + 투영 반경이 음수면 상자 전체가 바깥입니다.
+	 * 모서리 근처에서는 실제로 바깥인 상자도 보이는 것으로 판정될 수 있습니다.
+	 */
+	inline bool IntersectsFrustum(const Frustum& frustum, const AABB& box) noexcept
+	{
+		for (const Vector4& plane : frustum.planes)
+		{
+			const Core::float32 distance =
+				((plane.x * box.center.x + plane.y * box.center.y) + plane.z * box.center.z) + plane.w;
+			const Core::float32 radius =
+				(std::abs(plane.x) * box.extents.x + std::abs(plane.y) * box.extents.y) + std::abs(plane.z) * box.extents.z;
+
+			if (distance + radius < 0.0f)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// @brief 경계 구가 절두체와 겹치거나 안에 있는지 (보수적 판정)
+	inline bool IntersectsFrustum(const Frustum& frustum, const BoundingSphere& sphere) noexcept
+	{
+		for (const Vector4& plane : frustum.planes)
+		{
+			const Core::float32 distance =
+				((plane.x * sphere.center.x + plane.y * sphere.center.y) + plane.z * sphere.center.z) + plane.w;
+
+			if (distance + sphere.radius < 0.0f)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+} // namespace Math
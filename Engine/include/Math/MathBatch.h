@@ -0,0 +1,166 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Math/MathTypes.h"
+#include "Math/BoundingVolumes.h"
+
+namespace Math
+{
+	//=============================================================================
+	// 배치 행렬 커널
+	//
+	// 여러 Transform을 한 번에 처리하는 SoA 커널입니다.
+	// 실행 시점에 CPU가 지원하는 가장 넓은 SIMD 경로(AVX2 > SSE2 > 스칼라)를 선택하며,
+	// 모든 경로는 같은 순서로 같은 연산을 수행하므로 결과가 비트 단위로 동일합니다.
+	// 각 커널은 Matrix4x4와 아핀 압축 행렬 Matrix3x4 버전을 모두 제공합니다.
+	//=============================================================================
+
+	/**
+	 * @brief 배치 커널 SIMD 경로
+	 */
+	enum class SimdLevel : Core::uint8
+	{
+		Scalar = 0,     // 스칼라 폴백
+		SSE2,           // 4-wide (x86/x64 기본)
+		AVX2,           // 8-wide (실행 시점 CPUID 검사)
+	};
+
+	/// @brief CPU가 지원하는 가장 넓은 SIMD 경로
+	SimdLevel GetSupportedSimdLevel() noexcept;
+
+	/// @brief 현재 배치 커널이 사용하는 SIMD 경로
+	SimdLevel GetSimdLevel() noexcept;
+
+	/**
+	 * @brief 배치 커널 SIMD 경로 강제 (벤치마크/검증용)
+	 * @param level 원하는 경로 (지원 범위를 넘으면 GetSupportedSimdLevel()로 제한)
+	 * @note 커널 실행 중인 다른 스레드가 없을 때만 호출
+	 */
+	void SetSimdLevel(SimdLevel level) noexcept;
+
+	/// @brief SIMD 경로 이름 ("Scalar", "SSE2", "AVX2")
+	const char* GetSimdLevelName(SimdLevel level) noexcept;
+
+	/**
+	 * @brief Scale * Rotation * Translation 행렬을 일괄 생성
+	 *
+	 * MatrixScaling(s) * MatrixRotationQuaternion(r) * MatrixTranslation(p)와 같은 결과를
+	 * 중간 행렬 없이 계산합니다.
+	 *
+	 * @param positions 위치 배열
+	 * @param rotations 회전 배열 (단위 쿼터니언)
+	 * @param scales 스케일 배열
+	 * @param outMatrices 결과 행렬 배열 (입력과 겹치면 안 됨)
+	 * @param count 원소 수
+	 */
+	void ComposeTRSBatch(
+		const Vector3* positions,
+		const Quaternion* rotations,
+		const Vector3* scales,
+		Matrix4x4* outMatrices,
+		Core::uint32 count
+	) noexcept;
+
+	/**
+	 * @brief outMatrices[i] = lhs[i] * rhs[i]
+	 * @note 원소 단위로 결과를 다 계산한 뒤 저장하므로 outMatrices가 lhs 또는 rhs와 같아도 됨
+	 */
+	void MultiplyMatrixBatch(
+		const Matrix4x4* lhs,
+		const Matrix4x4* rhs,
+		Matrix4x4* outMatrices,
+		Core::uint32 count
+	) noexcept;
+
+	/**
+	 * @brief outMatrices[i] = lhs[i] * rhs[rhsIndices[i]]
+	 *
+	 * i 오름차순으로 하나씩 계산하므로, rhs가 outMatrices와 같은 배열이어도
+	 * rhsIndices[i] < i 인 원소(부모가 자식보다 앞에 있는 계층 배열)는 이번 호출에서 갱신된 값을 읽습니다.
+	 */
+	void MultiplyMatrixBatchIndexed(
+		const Matrix4x4* lhs,
+		const Matrix4x4* rhs,
+		const Core::uint32* rhsIndices,
+		Matrix4x4* outMatrices,
+		Core::uint32 count
+	) noexcept;
+
+	/**
+	 * @brief outMatrices[i] = Transpose(Inverse(matrices[i]))
+	 * @note 특이 행렬(행렬식 0)의 결과는 MatrixInverse와 마찬가지로 정의되지 않음
+	 */
+	void InverseTransposeBatch(
+		const Matrix4x4* matrices,
+		Matrix4x4* outMatrices,
+		Core::uint32 count
+	) noexcept;
+
+	//=============================================================================
+	// 아핀 압축 행렬 (Matrix3x4) 버전
+	//
+	// 마지막 열 (0, 0, 0, 1)을 저장하지도 계산하지도 않으므로 메모리와 곱셈 수가 약 25% 줄어듭니다.
+	// 합성 결과는 Matrix4x4 버전과 비트 단위로 같습니다.
+	//=============================================================================
+
+	/// @brief ComposeTRSBatch의 Matrix3x4 버전
+	void ComposeTRSBatch(
+		const Vector3* positions,
+		const Quaternion* rotations,
+		const Vector3* scales,
+		Matrix3x4* outMatrices,
+		Core::uint32 count
+	) noexcept;
+
+	/// @brief MultiplyMatrixBatch의 Matrix3x4 버전 (아핀 행렬끼리의 곱)
+	void MultiplyMatrixBatch(
+		const Matrix3x4* lhs,
+		const Matrix3x4* rhs,
+		Matrix3x4* outMatrices,
+		Core::uint32 count
+	) noexcept;
+
+	/// @brief MultiplyMatrixBatchIndexed의 Matrix3x4 버전 (rhs 별칭 규칙도 같음)
+	void MultiplyMatrixBatchIndexed(
+		const Matrix3x4* lhs,
+		const Matrix3x4* rhs,
+		const Core::uint32* rhsIndices,
+		Matrix3x4* outMatrices,
+		Core::uint32 count
+	) noexcept;
+
+	/**
+	 * @brief 노멀 변환 행렬 (회전/스케일 3x3 부분의 역전치, 이동은 0)
+	 *
+	 * 노멀(w = 0)에는 이동이 적용되지 않으므로 3x3 부분만 계산합니다.
+	 * 결과의 3x3 부분은 Matrix4x4 버전 InverseTransposeBatch 결과의 3x3 부분과 (오차 범위 내에서) 같습니다.
+	 */
+	void InverseTransposeBatch(
+		const Matrix3x4* matrices,
+		Matrix3x4* outMatrices,
+		Core::uint32 count
+	) noexcept;
+
+	//=============================================================================
+	// 절두체 컬링
+	//=============================================================================
+
+	/**
+	 * @brief AABB 배열의 절두체 판정을 일괄 수행
+	 *
+	 * outVisible[i] = IntersectsFrustum(frustum, boxes[i]) ? 1 : 0 과 같은 결과를
+	 * 상자 여러 개를 레인에 나누어 담아 평면 6개와 동시에 비교합니다.
+	 *
+	 * @param frustum 판정할 절두체 (ExtractFrustum 결과)
+	 * @param boxes 월드 공간 AABB 배열
+	 * @param outVisible 결과 배열 (보이면 1, 아니면 0)
+	 * @param count 원소 수
+	 * @return 보이는 상자 수
+	 */
+	Core::uint32 FrustumCullBatch(
+		const Frustum& frustum,
+		const AABB* boxes,
+		Core::uint8* outVisible,
+		Core::uint32 count
+	) noexcept;
+
+} // namespace Math
@@ -13,6 +13,7 @@ namespace Math
 	struct Vector3;
 	struct Vector4;
 	struct Matrix4x4;
+	struct Matrix3x4;
 	struct Quaternion;
 
 	// SIMD 계산용 타입 (16 bytes aligned, 연산 최적화)
@@ -677,6 +678,52 @@ namespace Math
 		return Vector3(pitch, yaw, roll);
 	}
 
+	//=============================================================================
+	// Matrix3x4
+	//=============================================================================
+
+	/**
+	 * @brief 아핀 변환 전용 압축 행렬 (12 floats)
+	 *
+	 * Matrix4x4(행 벡터 규약)의 마지막 열은 아핀 변환에서 항상 (0, 0, 0, 1)이므로 생략하고,
+	 * 나머지 세 열을 행으로 저장합니다. 즉 m[r][c] = Matrix4x4::m[c][r] 이며 이동은 m[r][3]에 있습니다.
+	 * 이 배치는 HLSL float3x4(전치된 행 세 개)와 같아 GPU 업로드 시 그대로 복사할 수 있습니다.
+	 *
+	 * @note Matrix4x4로의 변환은 MathUtils의 AffineToMatrix() 사용
+	 */
+	struct Matrix3x4
+	{
+		Core::float32 m[3][4] = {
+			{1.0f, 0.0f, 0.0f, 0.0f},
+			{0.0f, 1.0f, 0.0f, 0.0f},
+			{0.0f, 0.0f, 1.0f, 0.0f}
+		};
+
+		// 정적 생성자
+		static Matrix3x4 Identity() { return Matrix3x4(); }
+
+		// Translation 추출/설정
+		Vector3 GetTranslation() const noexcept { return Vector3(m[0][3], m[1][3], m[2][3]); }
+		void SetTranslation(const Vector3& v) noexcept { m[0][3] = v.x; m[1][3] = v.y; m[2][3] = v.z; }
+
+		// 비교 연산자
+		bool operator==(const Matrix3x4& other) const noexcept
+		{
+			for (int i = 0; i < 3; ++i)
+			{
+				for (int j = 0; j < 4; ++j)
+				{
+					if (std::abs(m[i][j] - other.m[i][j]) >= EPSILON)
+					{
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+		bool operator!=(const Matrix3x4& other) const noexcept { return !(*this == other); }
+	};
+
 	//=============================================================================
 	// Matrix3x3 (using alias 유지 - 사용 빈도 낮음)
 	//=============================================================================
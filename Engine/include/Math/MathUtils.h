@@ -212,6 +212,35 @@ namespace Math
 		return Matrix4x4::Identity();
 	}
 
+	/// @brief 아핀 행렬을 Matrix4x4로 확장 (마지막 열 = (0, 0, 0, 1))
+	inline Matrix4x4 AffineToMatrix(const Matrix3x4& a) noexcept
+	{
+		return Matrix4x4(
+			a.m[0][0], a.m[1][0], a.m[2][0], 0.0f,
+			a.m[0][1], a.m[1][1], a.m[2][1], 0.0f,
+			a.m[0][2], a.m[1][2], a.m[2][2], 0.0f,
+			a.m[0][3], a.m[1][3], a.m[2][3], 1.0f
+		);
+	}
+
+	/// @brief Matrix4x4의 아핀 부분만 추출 (마지막 열은 버림)
+	inline Matrix3x4 MatrixToAffine(const Matrix4x4& m) noexcept
+	{
+		Matrix3x4 result;
+		for (int row = 0; row < 3; ++row)
+		{
+			for (int col = 0; col < 4; ++col)
+			{
+				result.m[row][col] = m.m[col][row];
+			}
+		}
+		return result;
+	}
+
+	/// @brief 행렬 저장 형식과 무관한 Matrix4x4 변환 (Matrix4x4는 그대로 반환)
+	inline Matrix4x4 ToMatrix4x4(const Matrix3x4& a) noexcept { return AffineToMatrix(a); }
+	inline const Matrix4x4& ToMatrix4x4(const Matrix4x4& m) noexcept { return m; }
+
 	/// @brief 역행렬 계산과 함께 행렬식 반환
 	inline Matrix4x4 MatrixInverseWithDeterminant(const Matrix4x4& m, Core::float32& outDeterminant) noexcept
 	{
@@ -0,0 +1,209 @@
+﻿#include "pch.h"
+#include "Core/Jobs/JobSystem.h"
+#include "Core/Logging/LogMacros.h"
+
+namespace Core::Jobs
+{
+	namespace
+	{
+		// 현재 스레드의 JobSystem 인덱스
+		thread_local uint32 tThreadIndex = JobSystem::INVALID_THREAD_INDEX;
+
+		// 훔칠 대상 선택용 xorshift 상태
+		thread_local uint32 tRandomState = 0x9E3779B9u;
+
+		uint32 NextRandom()
+		{
+			uint32 x = tRandomState;
+			x ^= x << 13;
+			x ^= x >> 17;
+			x ^= x << 5;
+			tRandomState = x;
+			return x;
+		}
+
+		// Job을 찾지 못했을 때 잠들기 전 재시도 횟수
+		constexpr uint32 IDLE_SPIN_COUNT = 64;
+	}
+
+	JobSystem::JobSystem(uint32 workerCount)
+	{
+		if (workerCount == 0)
+		{
+			const uint32 hardwareThreads = std::thread::hardware_concurrency();
+			workerCount = (hardwareThreads > 1) ? hardwareThreads - 1 : 1;
+		}
+
+		mContexts.reserve(static_cast<size_t>(workerCount) + 1);
+		for (uint32 i = 0; i <= workerCount; ++i)
+		{
+			mContexts.push_back(std::make_unique<ThreadContext>());
+		}
+
+		// 생성한 스레드를 메인 스레드(0)로 등록
+		tThreadIndex = 0;
+
+		mWorkers.reserve(workerCount);
+		for (uint32 i = 1; i <= workerCount; ++i)
+		{
+			mWorkers.emplace_back(&JobSystem::WorkerLoop, this, i);
+		}
+
+		LOG_INFO("[JobSystem] Created with %u worker threads", workerCount);
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mWakeMutex);
+			mShutdown.store(true);
+		}
+		mWakeCondition.notify_all();
+
+		for (std::thread& worker : mWorkers)
+		{
+			worker.join();
+		}
+
+		tThreadIndex = INVALID_THREAD_INDEX;
+		LOG_INFO("[JobSystem] Destroyed");
+	}
+
+	void JobSystem::Wait(JobCounter& counter)
+	{
+		const uint32 threadIndex = GetCurrentThreadIndex();
+		CORE_ASSERT(threadIndex != INVALID_THREAD_INDEX, "JobSystem::Wait called from an unregistered thread");
+
+		while (!counter.IsDone())
+		{
+			if (Job* job = FindJob(threadIndex))
+			{
+				Execute(job, threadIndex);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	uint64 JobSystem::GetExecutedJobCount(uint32 threadIndex) const
+	{
+		CORE_ASSERT(threadIndex < mContexts.size(), "Invalid thread index");
+		return mContexts[threadIndex]->executedJobCount.load(std::memory_order_relaxed);
+	}
+
+	uint32 JobSystem::GetCurrentThreadIndex()
+	{
+		return tThreadIndex;
+	}
+
+	Job* JobSystem::AllocateJob()
+	{
+		const uint32 threadIndex = GetCurrentThreadIndex();
+		CORE_ASSERT(threadIndex != INVALID_THREAD_INDEX, "Jobs can only be submitted from JobSystem threads");
+
+		ThreadContext& context = *mContexts[threadIndex];
+		Job* job = &context.jobPool[context.nextJobIndex & (MAX_JOBS_PER_THREAD - 1)];
+		++context.nextJobIndex;
+		return job;
+	}
+
+	void JobSystem::Submit(Job* job)
+	{
+		const uint32 threadIndex = GetCurrentThreadIndex();
+
+		// 잠든 워커가 대기 Job 수를 놓치지 않도록 Push 전에 증가
+		mQueuedJobs.fetch_add(1);
+
+		if (!mContexts[threadIndex]->queue.Push(job))
+		{
+			// 큐가 가득 차면 즉시 실행
+			mQueuedJobs.fetch_sub(1);
+			Execute(job, threadIndex);
+			return;
+		}
+
+		if (mSleepingWorkers.load() > 0)
+		{
+			{
+				std::lock_guard<std::mutex> lock(mWakeMutex);
+			}
+			mWakeCondition.notify_one();
+		}
+	}
+
+	Job* JobSystem::FindJob(uint32 threadIndex)
+	{
+		// 1. 자기 큐 (LIFO, 캐시 친화적)
+		Job* job = mContexts[threadIndex]->queue.Pop();
+
+		// 2. 다른 스레드 큐에서 훔치기 (무작위 시작점부터 한 바퀴)
+		if (!job)
+		{
+			const uint32 threadCount = GetThreadCount();
+			const uint32 start = NextRandom() % threadCount;
+			for (uint32 i = 0; i < threadCount && !job; ++i)
+			{
+				const uint32 victim = (start + i) % threadCount;
+				if (victim != threadIndex)
+				{
+					job = mContexts[victim]->queue.Steal();
+				}
+			}
+		}
+
+		if (job)
+		{
+			mQueuedJobs.fetch_sub(1);
+		}
+
+		return job;
+	}
+
+	void JobSystem::Execute(Job* job, uint32 threadIndex)
+	{
+		JobCounter* counter = job->counter;
+		job->function(*job);
+
+		mContexts[threadIndex]->executedJobCount.fetch_add(1, std::memory_order_relaxed);
+		counter->mPending.fetch_sub(1, std::memory_order_release);
+	}
+
+	void JobSystem::WorkerLoop(uint32 threadIndex)
+	{
+		tThreadIndex = threadIndex;
+		tRandomState ^= threadIndex * 0x85EBCA6Bu;
+
+		while (!mShutdown.load(std::memory_order_acquire))
+		{
+			Job* job = nullptr;
+			for (uint32 spin = 0; spin < IDLE_SPIN_COUNT && !job; ++spin)
+			{
+				job = FindJob(threadIndex);
+				if (!job)
+				{
+					std::this_thread::yield();
+				}
+			}
+
+			if (job)
+			{
+				Execute(job, threadIndex);
+				continue;
+			}
+
+			// 대기 Job이 생길 때까지 잠듦
+			std::unique_lock<std::mutex> lock(mWakeMutex);
+			mSleepingWorkers.fetch_add(1);
+			mWakeCondition.wait(lock, [this]()
+				{
+					return mQueuedJobs.load() > 0 || mShutdown.load();
+				});
+			mSleepingWorkers.fetch_sub(1);
+		}
+
+		tThreadIndex = INVALID_THREAD_INDEX;
+	}
+
+} // namespace Core::Jobs
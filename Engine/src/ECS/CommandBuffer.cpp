@@ -0,0 +1,133 @@
+﻿#include "pch.h"
+#include "ECS/CommandBuffer.h"
+
+namespace ECS
+{
+	CommandBuffer::~CommandBuffer()
+	{
+		DestroyPayloads();
+	}
+
+	Entity CommandBuffer::CreateEntity()
+	{
+		return Entity{ mPendingCount++, PENDING_ENTITY_VERSION };
+	}
+
+	void CommandBuffer::DestroyEntity(Entity entity)
+	{
+		mCommands.push_back({ CommandType::DestroyEntity, 0, entity, nullptr, nullptr });
+	}
+
+	void CommandBuffer::Playback(Registry& registry)
+	{
+		// 1. 예약된 Entity 일괄 생성
+		mCreatedEntities.resize(mPendingCount);
+		if (mPendingCount > 0)
+		{
+			registry.CreateEntities(mPendingCount, mCreatedEntities);
+		}
+
+		// 2. 단계 -> Component 타입 순으로 정렬 (같은 키는 기록 순서 유지)
+		std::stable_sort(mCommands.begin(), mCommands.end(),
+			[](const Command& lhs, const Command& rhs)
+			{
+				const bool lhsDestroy = lhs.type == CommandType::DestroyEntity;
+				const bool rhsDestroy = rhs.type == CommandType::DestroyEntity;
+				if (lhsDestroy != rhsDestroy)
+				{
+					return rhsDestroy;
+				}
+
+				return lhs.componentId < rhs.componentId;
+			});
+
+		// 3. 적용 (이미 무효화된 Entity는 건너뜀)
+		for (const Command& command : mCommands)
+		{
+			const Entity entity = Resolve(command.entity);
+			if (!registry.IsEntityValid(entity))
+			{
+				continue;
+			}
+
+			switch (command.type)
+			{
+			case CommandType::AddComponent:
+				command.ops->add(registry, entity, command.payload);
+				break;
+
+			case CommandType::RemoveComponent:
+				command.ops->remove(registry, entity);
+				break;
+
+			case CommandType::DestroyEntity:
+				registry.DestroyEntity(entity);
+				break;
+			}
+		}
+
+		Clear();
+	}
+
+	void CommandBuffer::Clear()
+	{
+		DestroyPayloads();
+
+		mCommands.clear();
+		mCreatedEntities.clear();
+		mPendingCount = 0;
+
+		// 아레나 블록은 해제하지 않고 되감기만 함
+		mCurrentBlock = 0;
+		mBlockOffset = 0;
+	}
+
+	void* CommandBuffer::Allocate(size_t size, size_t alignment)
+	{
+		while (mCurrentBlock < mBlocks.size())
+		{
+			ArenaBlock& block = mBlocks[mCurrentBlock];
+			const size_t offset = (mBlockOffset + alignment - 1) & ~(alignment - 1);
+			if (offset + size <= block.size)
+			{
+				mBlockOffset = offset + size;
+				return block.memory.get() + offset;
+			}
+
+			// 현재 블록이 부족하면 다음 블록으로
+			++mCurrentBlock;
+			mBlockOffset = 0;
+		}
+
+		// 새 블록 할당 (큰 Component는 전용 크기로)
+		const size_t blockSize = std::max(ARENA_BLOCK_SIZE, size);
+		mBlocks.push_back({ std::unique_ptr<std::byte[]>(new std::byte[blockSize]), blockSize });
+		mCurrentBlock = mBlocks.size() - 1;
+		mBlockOffset = size;
+
+		return mBlocks.back().memory.get();
+	}
+
+	Entity CommandBuffer::Resolve(Entity entity) const
+	{
+		if (!IsPendingEntity(entity))
+		{
+			return entity;
+		}
+
+		CORE_ASSERT(entity.id < mCreatedEntities.size(), "Pending entity belongs to another command buffer");
+		return mCreatedEntities[entity.id];
+	}
+
+	void CommandBuffer::DestroyPayloads()
+	{
+		for (const Command& command : mCommands)
+		{
+			if (command.type == CommandType::AddComponent && command.ops->destroy)
+			{
+				command.ops->destroy(command.payload);
+			}
+		}
+	}
+
+} // namespace ECS
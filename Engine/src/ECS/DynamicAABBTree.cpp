@@ -0,0 +1,680 @@
+﻿#include "pch.h"
+#include "ECS/DynamicAABBTree.h"
+#include <cfloat>
+
+namespace ECS
+{
+	DynamicAABBTree::DynamicAABBTree(Core::float32 fatMargin)
+		: mFatMargin(fatMargin)
+	{
+		CORE_ASSERT(fatMargin >= 0.0f, "Fat margin must not be negative");
+	}
+
+	//=========================================================================
+	// 프록시 관리
+	//=========================================================================
+
+	Core::uint32 DynamicAABBTree::CreateProxy(const Math::AABB& bounds, Core::uint32 userData)
+	{
+		const Core::uint32 proxyId = AllocateNode();
+		Node& node = mNodes[proxyId];
+		node.bounds = bounds;
+		node.fatBounds = FattenBounds(bounds);
+		node.userData = userData;
+		node.height = 0;
+
+		InsertLeaf(proxyId);
+		++mProxyCount;
+		return proxyId;
+	}
+
+	void DynamicAABBTree::DestroyProxy(Core::uint32 proxyId)
+	{
+		CORE_ASSERT(proxyId < mNodes.size() && mNodes[proxyId].height == 0, "Invalid proxy id: %u", proxyId);
+
+		RemoveLeaf(proxyId);
+		FreeNode(proxyId);
+		--mProxyCount;
+	}
+
+	bool DynamicAABBTree::MoveProxy(Core::uint32 proxyId, const Math::AABB& bounds)
+	{
+		CORE_ASSERT(proxyId < mNodes.size() && mNodes[proxyId].height == 0, "Invalid proxy id: %u", proxyId);
+
+		Node& node = mNodes[proxyId];
+		node.bounds = bounds;
+
+		// 여유 경계 안에서 움직였고, 여유 경계가 지나치게 크지 않으면 트리 유지
+		if (Math::Contains(node.fatBounds, bounds))
+		{
+			Math::AABB looseBounds = bounds;
+			looseBounds.extents += Math::Vector3(mFatMargin, mFatMargin, mFatMargin) * LOOSE_MARGIN_FACTOR;
+			if (Math::Contains(looseBounds, node.fatBounds))
+			{
+				return false;
+			}
+		}
+
+		RemoveLeaf(proxyId);
+		mNodes[proxyId].fatBounds = FattenBounds(bounds);
+		InsertLeaf(proxyId);
+		return true;
+	}
+
+	void DynamicAABBTree::Rebuild()
+	{
+		if (mProxyCount < 2)
+		{
+			return;
+		}
+
+		// 리프만 남기고 내부 노드 반환
+		std::vector<Core::uint32> leaves;
+		leaves.reserve(mProxyCount);
+		for (Core::uint32 i = 0; i < static_cast<Core::uint32>(mNodes.size()); ++i)
+		{
+			Node& node = mNodes[i];
+			if (node.height < 0)
+			{
+				continue;
+			}
+
+			if (node.IsLeaf())
+			{
+				node.parent = NULL_NODE;
+				leaves.push_back(i);
+			}
+			else
+			{
+				FreeNode(i);
+			}
+		}
+
+		// 분할 판정용 중심점 (리프 인덱스 순서와 무관하게 노드 인덱스로 조회)
+		std::vector<Math::Vector3> centers(mNodes.size());
+		for (Core::uint32 leaf : leaves)
+		{
+			centers[leaf] = mNodes[leaf].fatBounds.center;
+		}
+
+		// 구간 [begin, end)를 parent의 자식으로 만드는 작업 (재귀 대신 명시적 스택)
+		struct BuildTask
+		{
+			Core::uint32 begin;
+			Core::uint32 end;
+			Core::uint32 parent;
+			bool isChild1;
+		};
+
+		std::vector<BuildTask> tasks;
+		std::vector<Core::uint32> internalNodes;    // 생성 순서 (부모가 자식보다 앞)
+		internalNodes.reserve(leaves.size());
+		tasks.push_back({ 0, static_cast<Core::uint32>(leaves.size()), NULL_NODE, true });
+		mRoot = NULL_NODE;
+
+		while (!tasks.empty())
+		{
+			const BuildTask task = tasks.back();
+			tasks.pop_back();
+
+			Core::uint32 nodeIndex;
+			Core::uint32 split = 0;
+			const Core::uint32 count = task.end - task.begin;
+
+			if (count == 1)
+			{
+				nodeIndex = leaves[task.begin];
+			}
+			else
+			{
+				// 중심점 범위가 가장 긴 축으로 분할
+				Math::Vector3 centerMin = centers[leaves[task.begin]];
+				Math::Vector3 centerMax = centerMin;
+				for (Core::uint32 i = task.begin + 1; i < task.end; ++i)
+				{
+					const Math::Vector3& c = centers[leaves[i]];
+					centerMin = Math::Vector3(std::min(centerMin.x, c.x), std::min(centerMin.y, c.y), std::min(centerMin.z, c.z));
+					centerMax = Math::Vector3(std::max(centerMax.x, c.x), std::max(centerMax.y, c.y), std::max(centerMax.z, c.z));
+				}
+
+				const Math::Vector3 centerExtent = centerMax - centerMin;
+				int axis = 0;
+				if (centerExtent.y > centerExtent.x)
+				{
+					axis = 1;
+				}
+				if (centerExtent.z > (axis == 0 ? centerExtent.x : centerExtent.y))
+				{
+					axis = 2;
+				}
+
+				auto axisValue = [axis](const Math::Vector3& v)
+					{
+						return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+					};
+
+				const Core::float32 axisMin = axisValue(centerMin);
+				const Core::float32 axisExtent = axisValue(centerExtent);
+
+				if (axisExtent > 0.0f)
+				{
+					// 구간별 개수/경계 누적
+					struct Bin
+					{
+						Math::AABB bounds;
+						Core::uint32 count = 0;
+					};
+					Bin bins[SAH_BIN_COUNT];
+
+					const Core::float32 binScale = static_cast<Core::float32>(SAH_BIN_COUNT) / axisExtent;
+					auto binIndex = [&](Core::uint32 leaf)
+						{
+							const Core::uint32 index = static_cast<Core::uint32>((axisValue(centers[leaf]) - axisMin) * binScale);
+							return std::min(index, SAH_BIN_COUNT - 1);
+						};
+
+					for (Core::uint32 i = task.begin; i < task.end; ++i)
+					{
+						Bin& bin = bins[binIndex(leaves[i])];
+						bin.bounds = (bin.count == 0) ? mNodes[leaves[i]].fatBounds : Math::Merge(bin.bounds, mNodes[leaves[i]].fatBounds);
+						++bin.count;
+					}
+
+					// 오른쪽부터 누적한 표면적 x 개수
+					Core::float32 rightCost[SAH_BIN_COUNT] = {};
+					Math::AABB accumulated;
+					Core::uint32 accumulatedCount = 0;
+					for (Core::uint32 b = SAH_BIN_COUNT - 1; b > 0; --b)
+					{
+						if (bins[b].count > 0)
+						{
+							accumulated = (accumulatedCount == 0) ? bins[b].bounds : Math::Merge(accumulated, bins[b].bounds);
+							accumulatedCount += bins[b].count;
+						}
+						rightCost[b] = (accumulatedCount > 0) ? accumulated.GetSurfaceArea() * accumulatedCount : 0.0f;
+					}
+
+					// 왼쪽부터 누적하며 분할 비용 최소 지점 선택 (bins[0, b) | bins[b, N))
+					Core::float32 bestCost = FLT_MAX;
+					Core::uint32 bestBin = 0;
+					accumulatedCount = 0;
+					for (Core::uint32 b = 1; b < SAH_BIN_COUNT; ++b)
+					{
+						if (bins[b - 1].count > 0)
+						{
+							accumulated = (accumulatedCount == 0) ? bins[b - 1].bounds : Math::Merge(accumulated, bins[b - 1].bounds);
+							accumulatedCount += bins[b - 1].count;
+						}
+
+						const Core::uint32 rightCount = count - accumulatedCount;
+						if (accumulatedCount == 0 || rightCount == 0)
+						{
+							continue;
+						}
+
+						const Core::float32 cost = accumulated.GetSurfaceArea() * accumulatedCount + rightCost[b];
+						if (cost < bestCost)
+						{
+							bestCost = cost;
+							bestBin = b;
+						}
+					}
+
+					if (bestBin > 0)
+					{
+						auto middle = std::partition(leaves.begin() + task.begin, leaves.begin() + task.end,
+							[&](Core::uint32 leaf) { return binIndex(leaf) < bestBin; });
+						split = static_cast<Core::uint32>(middle - leaves.begin());
+					}
+				}
+
+				// 중심점이 모두 겹치는 등 분할하지 못하면 중앙값으로 분할
+				if (split <= task.begin || split >= task.end)
+				{
+					split = task.begin + count / 2;
+					std::nth_element(leaves.begin() + task.begin, leaves.begin() + split, leaves.begin() + task.end,
+						[&](Core::uint32 a, Core::uint32 b) { return axisValue(centers[a]) < axisValue(centers[b]); });
+				}
+
+				nodeIndex = AllocateNode();
+				mNodes[nodeIndex].height = 1;
+				internalNodes.push_back(nodeIndex);
+			}
+
+			// 부모에 연결
+			mNodes[nodeIndex].parent = task.parent;
+			if (task.parent == NULL_NODE)
+			{
+				mRoot = nodeIndex;
+			}
+			else if (task.isChild1)
+			{
+				mNodes[task.parent].child1 = nodeIndex;
+			}
+			else
+			{
+				mNodes[task.parent].child2 = nodeIndex;
+			}
+
+			if (count > 1)
+			{
+				tasks.push_back({ split, task.end, nodeIndex, false });
+				tasks.push_back({ task.begin, split, nodeIndex, true });
+			}
+		}
+
+		// 자식이 모두 만들어진 뒤 역순으로 경계/높이 계산
+		for (auto it = internalNodes.rbegin(); it != internalNodes.rend(); ++it)
+		{
+			Node& node = mNodes[*it];
+			const Node& child1 = mNodes[node.child1];
+			const Node& child2 = mNodes[node.child2];
+			node.fatBounds = Math::Merge(child1.fatBounds, child2.fatBounds);
+			node.height = 1 + std::max(child1.height, child2.height);
+		}
+	}
+
+	void DynamicAABBTree::Clear()
+	{
+		mNodes.clear();
+		mRoot = NULL_NODE;
+		mFreeList = NULL_NODE;
+		mNodeCount = 0;
+		mProxyCount = 0;
+	}
+
+	//=========================================================================
+	// 조회
+	//=========================================================================
+
+	Core::uint32 DynamicAABBTree::GetUserData(Core::uint32 proxyId) const
+	{
+		CORE_ASSERT(proxyId < mNodes.size() && mNodes[proxyId].height == 0, "Invalid proxy id: %u", proxyId);
+		return mNodes[proxyId].userData;
+	}
+
+	const Math::AABB& DynamicAABBTree::GetBounds(Core::uint32 proxyId) const
+	{
+		CORE_ASSERT(proxyId < mNodes.size() && mNodes[proxyId].height == 0, "Invalid proxy id: %u", proxyId);
+		return mNodes[proxyId].bounds;
+	}
+
+	const Math::AABB& DynamicAABBTree::GetFatBounds(Core::uint32 proxyId) const
+	{
+		CORE_ASSERT(proxyId < mNodes.size() && mNodes[proxyId].height == 0, "Invalid proxy id: %u", proxyId);
+		return mNodes[proxyId].fatBounds;
+	}
+
+	Core::uint32 DynamicAABBTree::GetHeight() const
+	{
+		return (mRoot == NULL_NODE) ? 0 : static_cast<Core::uint32>(mNodes[mRoot].height);
+	}
+
+	Core::float32 DynamicAABBTree::GetAreaRatio() const
+	{
+		if (mRoot == NULL_NODE)
+		{
+			return 0.0f;
+		}
+
+		const Core::float32 rootArea = mNodes[mRoot].fatBounds.GetSurfaceArea();
+		if (rootArea <= 0.0f)
+		{
+			return 0.0f;
+		}
+
+		Core::float32 totalArea = 0.0f;
+		for (const Node& node : mNodes)
+		{
+			if (node.height > 0)
+			{
+				totalArea += node.fatBounds.GetSurfaceArea();
+			}
+		}
+		return totalArea / rootArea;
+	}
+
+	void DynamicAABBTree::Validate() const
+	{
+		if (mRoot == NULL_NODE)
+		{
+			CORE_ASSERT(mProxyCount == 0, "Empty tree has proxies");
+			return;
+		}
+
+		CORE_ASSERT(mNodes[mRoot].parent == NULL_NODE, "Root has a parent");
+
+		// 중심/반경 표현의 합치기는 반올림 오차가 있으므로 좌표 크기에 비례한 허용 오차로 포함 판정
+		auto containsApprox = [](const Math::AABB& outer, const Math::AABB& inner)
+			{
+				const Core::float32 scale = 1.0f
+					+ std::max({ std::abs(outer.center.x), std::abs(outer.center.y), std::abs(outer.center.z) })
+					+ std::max({ outer.extents.x, outer.extents.y, outer.extents.z });
+				Math::AABB tolerant = outer;
+				tolerant.extents += Math::Vector3(1.0f, 1.0f, 1.0f) * (scale * 1.0e-5f);
+				return Math::Contains(tolerant, inner);
+			};
+
+		Core::uint32 visitedNodes = 0;
+		Core::uint32 visitedLeaves = 0;
+		std::vector<Core::uint32> stack{ mRoot };
+		while (!stack.empty())
+		{
+			const Core::uint32 index = stack.back();
+			stack.pop_back();
+			const Node& node = mNodes[index];
+			++visitedNodes;
+
+			if (node.IsLeaf())
+			{
+				CORE_ASSERT(node.height == 0, "Leaf height must be 0");
+				CORE_ASSERT(containsApprox(node.fatBounds, node.bounds), "Leaf fat bounds do not contain bounds");
+				++visitedLeaves;
+				continue;
+			}
+
+			const Node& child1 = mNodes[node.child1];
+			const Node& child2 = mNodes[node.child2];
+			CORE_ASSERT(child1.parent == index && child2.parent == index, "Broken parent link at node %u", index);
+			CORE_ASSERT(node.height == 1 + std::max(child1.height, child2.height), "Wrong height at node %u", index);
+			CORE_ASSERT(containsApprox(node.fatBounds, child1.fatBounds) && containsApprox(node.fatBounds, child2.fatBounds),
+				"Node %u does not contain its children", index);
+
+			stack.push_back(node.child1);
+			stack.push_back(node.child2);
+		}
+
+		CORE_ASSERT(visitedNodes == mNodeCount, "Node count mismatch: %u != %u", visitedNodes, mNodeCount);
+		CORE_ASSERT(visitedLeaves == mProxyCount, "Proxy count mismatch: %u != %u", visitedLeaves, mProxyCount);
+	}
+
+	//=========================================================================
+	// 내부 구현
+	//=========================================================================
+
+	Core::uint32 DynamicAABBTree::AllocateNode()
+	{
+		Core::uint32 nodeIndex;
+		if (mFreeList != NULL_NODE)
+		{
+			nodeIndex = mFreeList;
+			mFreeList = mNodes[nodeIndex].parent;
+		}
+		else
+		{
+			nodeIndex = static_cast<Core::uint32>(mNodes.size());
+			mNodes.emplace_back();
+		}
+
+		Node& node = mNodes[nodeIndex];
+		node.parent = NULL_NODE;
+		node.child1 = NULL_NODE;
+		node.child2 = NULL_NODE;
+		node.height = 0;
+		++mNodeCount;
+		return nodeIndex;
+	}
+
+	void DynamicAABBTree::FreeNode(Core::uint32 nodeIndex)
+	{
+		Node& node = mNodes[nodeIndex];
+		node.parent = mFreeList;
+		node.child1 = NULL_NODE;
+		node.child2 = NULL_NODE;
+		node.height = -1;
+		mFreeList = nodeIndex;
+		--mNodeCount;
+	}
+
+	void DynamicAABBTree::InsertLeaf(Core::uint32 leaf)
+	{
+		if (mRoot == NULL_NODE)
+		{
+			mRoot = leaf;
+			mNodes[leaf].parent = NULL_NODE;
+			return;
+		}
+
+		// 표면적 증가량이 가장 작은 형제 탐색 (분기 비용 + 조상 확장 비용)
+		const Math::AABB leafBounds = mNodes[leaf].fatBounds;
+		Core::uint32 index = mRoot;
+		while (!mNodes[index].IsLeaf())
+		{
+			const Node& node = mNodes[index];
+			const Core::float32 area = node.fatBounds.GetSurfaceArea();
+			const Core::float32 combinedArea = Math::Merge(node.fatBounds, leafBounds).GetSurfaceArea();
+
+			// 여기서 새 부모를 만드는 비용
+			const Core::float32 cost = 2.0f * combinedArea;
+
+			// 더 내려갈 때 이 노드가 커지는 비용
+			const Core::float32 inheritanceCost = 2.0f * (combinedArea - area);
+
+			auto descendCost = [&](Core::uint32 childIndex)
+				{
+					const Node& child = mNodes[childIndex];
+					const Core::float32 mergedArea = Math::Merge(leafBounds, child.fatBounds).GetSurfaceArea();
+					if (child.IsLeaf())
+					{
+						return mergedArea + inheritanceCost;
+					}
+					return (mergedArea - child.fatBounds.GetSurfaceArea()) + inheritanceCost;
+				};
+
+			const Core::float32 cost1 = descendCost(node.child1);
+			const Core::float32 cost2 = descendCost(node.child2);
+
+			if (cost < cost1 && cost < cost2)
+			{
+				break;
+			}
+			index = (cost1 < cost2) ? node.child1 : node.child2;
+		}
+
+		// 형제와 새 리프를 묶는 부모 생성
+		const Core::uint32 sibling = index;
+		const Core::uint32 oldParent = mNodes[sibling].parent;
+		const Core::uint32 newParent = AllocateNode();
+		{
+			Node& parentNode = mNodes[newParent];
+			parentNode.parent = oldParent;
+			parentNode.fatBounds = Math::Merge(leafBounds, mNodes[sibling].fatBounds);
+			parentNode.height = mNodes[sibling].height + 1;
+			parentNode.child1 = sibling;
+			parentNode.child2 = leaf;
+		}
+
+		if (oldParent != NULL_NODE)
+		{
+			Node& oldParentNode = mNodes[oldParent];
+			if (oldParentNode.child1 == sibling)
+			{
+				oldParentNode.child1 = newParent;
+			}
+			else
+			{
+				oldParentNode.child2 = newParent;
+			}
+		}
+		else
+		{
+			mRoot = newParent;
+		}
+		mNodes[sibling].parent = newParent;
+		mNodes[leaf].parent = newParent;
+
+		RefitAncestors(mNodes[leaf].parent);
+	}
+
+	void DynamicAABBTree::RemoveLeaf(Core::uint32 leaf)
+	{
+		if (leaf == mRoot)
+		{
+			mRoot = NULL_NODE;
+			return;
+		}
+
+		const Core::uint32 parent = mNodes[leaf].parent;
+		const Core::uint32 grandParent = mNodes[parent].parent;
+		const Core::uint32 sibling = (mNodes[parent].child1 == leaf) ? mNodes[parent].child2 : mNodes[parent].child1;
+
+		// 부모를 없애고 형제를 조부모에 직접 연결
+		if (grandParent != NULL_NODE)
+		{
+			Node& grandParentNode = mNodes[grandParent];
+			if (grandParentNode.child1 == parent)
+			{
+				grandParentNode.child1 = sibling;
+			}
+			else
+			{
+				grandParentNode.child2 = sibling;
+			}
+			mNodes[sibling].parent = grandParent;
+			FreeNode(parent);
+
+			RefitAncestors(grandParent);
+		}
+		else
+		{
+			mRoot = sibling;
+			mNodes[sibling].parent = NULL_NODE;
+			FreeNode(parent);
+		}
+		mNodes[leaf].parent = NULL_NODE;
+	}
+
+	void DynamicAABBTree::RefitAncestors(Core::uint32 nodeIndex)
+	{
+		while (nodeIndex != NULL_NODE)
+		{
+			nodeIndex = Balance(nodeIndex);
+
+			Node& node = mNodes[nodeIndex];
+			const Node& child1 = mNodes[node.child1];
+			const Node& child2 = mNodes[node.child2];
+			node.height = 1 + std::max(child1.height, child2.height);
+			node.fatBounds = Math::Merge(child1.fatBounds, child2.fatBounds);
+
+			nodeIndex = node.parent;
+		}
+	}
+
+	Core::uint32 DynamicAABBTree::Balance(Core::uint32 nodeA)
+	{
+		Node& a = mNodes[nodeA];
+		if (a.IsLeaf() || a.height < 2)
+		{
+			return nodeA;
+		}
+
+		const Core::uint32 nodeB = a.child1;
+		const Core::uint32 nodeC = a.child2;
+		Node& b = mNodes[nodeB];
+		Node& c = mNodes[nodeC];
+
+		const Core::int32 balance = c.height - b.height;
+
+		// A의 부모가 가리키던 자식을 newTop으로 교체
+		auto replaceInParent = [&](Core::uint32 newTop)
+			{
+				Node& top = mNodes[newTop];
+				top.parent = a.parent;
+				a.parent = newTop;
+				if (top.parent != NULL_NODE)
+				{
+					Node& parentNode = mNodes[top.parent];
+					if (parentNode.child1 == nodeA)
+					{
+						parentNode.child1 = newTop;
+					}
+					else
+					{
+						parentNode.child2 = newTop;
+					}
+				}
+				else
+				{
+					mRoot = newTop;
+				}
+			};
+
+		// C를 위로 회전
+		if (balance > 1)
+		{
+			const Core::uint32 nodeF = c.child1;
+			const Core::uint32 nodeG = c.child2;
+			Node& f = mNodes[nodeF];
+			Node& g = mNodes[nodeG];
+
+			c.child1 = nodeA;
+			replaceInParent(nodeC);
+
+			if (f.height > g.height)
+			{
+				c.child2 = nodeF;
+				a.child2 = nodeG;
+				g.parent = nodeA;
+				a.fatBounds = Math::Merge(b.fatBounds, g.fatBounds);
+				c.fatBounds = Math::Merge(a.fatBounds, f.fatBounds);
+				a.height = 1 + std::max(b.height, g.height);
+				c.height = 1 + std::max(a.height, f.height);
+			}
+			else
+			{
+				c.child2 = nodeG;
+				a.child2 = nodeF;
+				f.parent = nodeA;
+				a.fatBounds = Math::Merge(b.fatBounds, f.fatBounds);
+				c.fatBounds = Math::Merge(a.fatBounds, g.fatBounds);
+				a.height = 1 + std::max(b.height, f.height);
+				c.height = 1 + std::max(a.height, g.height);
+			}
+			return nodeC;
+		}
+
+		// B를 위로 회전
+		if (balance < -1)
+		{
+			const Core::uint32 nodeD = b.child1;
+			const Core::uint32 nodeE = b.child2;
+			Node& d = mNodes[nodeD];
+			Node& e = mNodes[nodeE];
+
+			b.child1 = nodeA;
+			replaceInParent(nodeB);
+
+			if (d.height > e.height)
+			{
+				b.child2 = nodeD;
+				a.child1 = nodeE;
+				e.parent = nodeA;
+				a.fatBounds = Math::Merge(c.fatBounds, e.fatBounds);
+				b.fatBounds = Math::Merge(a.fatBounds, d.fatBounds);
+				a.height = 1 + std::max(c.height, e.height);
+				b.height = 1 + std::max(a.height, d.height);
+			}
+			else
+			{
+				b.child2 = nodeE;
+				a.child1 = nodeD;
+				d.parent = nodeA;
+				a.fatBounds = Math::Merge(c.fatBounds, d.fatBounds);
+				b.fatBounds = Math::Merge(a.fatBounds, e.fatBounds);
+				a.height = 1 + std::max(c.height, d.height);
+				b.height = 1 + std::max(a.height, e.height);
+			}
+			return nodeB;
+		}
+
+		return nodeA;
+	}
+
+	Math::AABB DynamicAABBTree::FattenBounds(const Math::AABB& bounds) const
+	{
+		Math::AABB fatBounds = bounds;
+		fatBounds.extents += Math::Vector3(mFatMargin, mFatMargin, mFatMargin);
+		return fatBounds;
+	}
+
+} // namespace ECS
@@ -11,14 +11,15 @@ namespace ECS
 	{
 		Entity entity;
 
-		// 재활용 가능한 ID가 있으면 사용
-		if (!mFreeIds.empty())
+		// 재활용 가능한 ID가 있으면 free list 머리에서 꺼냄
+		if (mFreeListHead != INVALID_ENTITY_ID)
 		{
-			entity.id = mFreeIds.front();
-			mFreeIds.pop();
+			entity.id = mFreeListHead;
+			mFreeListHead = mEntitySlots[entity.id];
+			--mFreeCount;
 
-			// 버전 증가 (Entity 재활용 감지용)
-			entity.version = ++mVersions[entity.id];
+			// 버전은 삭제 시점에 이미 증가됨
+			entity.version = mVersions[entity.id];
 		}
 		else
 		{
@@ -26,10 +27,13 @@ namespace ECS
 			entity.id = mNextEntityId++;
 			entity.version = 0;
 
-			// 버전 테이블 확장
+			// Entity 테이블 확장
 			mVersions.push_back(0);
+			mEntitySlots.push_back(0);
+			mSignatures.emplace_back();
 		}
 
+		mEntitySlots[entity.id] = static_cast<Core::uint32>(mEntities.size());
 		mEntities.push_back(entity);
 		return entity;
 	}
@@ -38,24 +42,69 @@ namespace ECS
 	{
 		CORE_ASSERT(IsEntityValid(entity), "Invalid entity");
 
-		// 모든 컴포넌트 제거
-		for (auto& [typeIndex, storage] : mComponentStorages)
+		// 시그니처에 설정된 저장소만 방문하여 Component 제거
+		ComponentMask& signature = mSignatures[entity.id];
+		for (Core::uint32 componentId = 0; componentId < MAX_COMPONENT_TYPES && signature.any(); ++componentId)
 		{
-			if (storage->HasComponent(entity.id))
+			if (!signature.test(componentId))
 			{
-				storage->RemoveComponent(entity.id);
+				continue;
 			}
+
+			IComponentStorage& storage = *mComponentStorages[componentId];
+			if (storage.HasRemoveHook())
+			{
+				storage.InvokeRemoveHook(entity);
+			}
+
+			if (storage.HasListeners())
+			{
+				OnComponentRemoving(storage, entity.id);
+			}
+
+			storage.RemoveComponent(entity.id);
+			storage.NoteStructuralChange(GetChangeTick());
+			signature.reset(componentId);
 		}
 
-		// Entity 목록에서 제거
-		auto it = std::find(mEntities.begin(), mEntities.end(), entity);
-		if (it != mEntities.end())
+		// Entity 목록에서 swap-and-pop으로 제거
+		const Core::uint32 index = mEntitySlots[entity.id];
+		const Entity last = mEntities.back();
+		mEntities[index] = last;
+		mEntitySlots[last.id] = index;
+		mEntities.pop_back();
+
+		// 버전 증가로 기존 핸들 무효화 후 ID를 free list에 연결
+		++mVersions[entity.id];
+		mEntitySlots[entity.id] = mFreeListHead;
+		mFreeListHead = entity.id;
+		++mFreeCount;
+	}
+
+	void Registry::CreateEntities(Core::uint32 count, std::span<Entity> outEntities)
+	{
+		CORE_ASSERT(outEntities.size() >= count, "Output buffer is too small");
+
+		// 재활용 ID로 채우지 못하는 만큼만 테이블 확장
+		const Core::uint32 newIdCount = (count > mFreeCount) ? (count - mFreeCount) : 0;
+		mEntities.reserve(mEntities.size() + count);
+		mVersions.reserve(mVersions.size() + newIdCount);
+		mEntitySlots.reserve(mEntitySlots.size() + newIdCount);
+		mSignatures.reserve(mSignatures.size() + newIdCount);
+
+		for (Core::uint32 i = 0; i < count; ++i)
 		{
-			mEntities.erase(it);
+			outEntities[i] = CreateEntity();
 		}
+	}
 
-		// ID를 재활용 풀에 추가
-		mFreeIds.push(entity.id);
+	void Registry::DestroyEntities(std::span<const Entity> entities)
+	{
+		// 개별 삭제가 O(사용 중인 Component 수)이므로 순서대로 처리
+		for (const Entity& entity : entities)
+		{
+			DestroyEntity(entity);
+		}
 	}
 
 	bool Registry::IsEntityValid(Entity entity) const
@@ -74,4 +123,206 @@ namespace ECS
 		return mVersions[entity.id] == entity.version;
 	}
 
+	//=========================================================================
+	// 그룹/쿼리 갱신
+	//=========================================================================
+
+	void Registry::OnComponentAdded(IComponentStorage& storage, Core::uint32 entityId)
+	{
+		if (ArchetypeGroupData* group = storage.GetOwningGroup())
+		{
+			AddToGroup(*group, entityId);
+		}
+
+		for (QueryData* query : storage.GetQueries())
+		{
+			AddToQuery(*query, entityId);
+		}
+	}
+
+	void Registry::OnComponentRemoving(IComponentStorage& storage, Core::uint32 entityId)
+	{
+		if (ArchetypeGroupData* group = storage.GetOwningGroup())
+		{
+			RemoveFromGroup(*group, entityId);
+		}
+
+		for (QueryData* query : storage.GetQueries())
+		{
+			RemoveFromQuery(*query, entityId);
+		}
+	}
+
+	void Registry::OnComponentsAdded(IComponentStorage& storage, std::span<const Entity> entities)
+	{
+		if (ArchetypeGroupData* group = storage.GetOwningGroup())
+		{
+			for (const Entity& entity : entities)
+			{
+				AddToGroup(*group, entity.id);
+			}
+		}
+
+		if (storage.GetQueries().empty())
+		{
+			return;
+		}
+
+		// 위치 테이블을 한 번만 확장
+		Core::uint32 maxEntityId = 0;
+		for (const Entity& entity : entities)
+		{
+			maxEntityId = std::max(maxEntityId, entity.id);
+		}
+
+		for (QueryData* query : storage.GetQueries())
+		{
+			if (maxEntityId >= query->positions.size())
+			{
+				query->positions.resize(static_cast<size_t>(maxEntityId) + 1, IComponentStorage::INVALID_INDEX);
+			}
+			query->entityIds.reserve(query->entityIds.size() + entities.size());
+
+			for (const Entity& entity : entities)
+			{
+				AddToQuery(*query, entity.id);
+			}
+		}
+	}
+
+	//=========================================================================
+	// Archetype 그룹
+	//=========================================================================
+
+	void Registry::AddToGroup(ArchetypeGroupData& group, Core::uint32 entityId)
+	{
+		// 이미 패킹 영역에 있으면 무시
+		const Core::uint32 leadIndex = group.storages[0]->GetDenseIndex(entityId);
+		if (leadIndex != IComponentStorage::INVALID_INDEX && leadIndex < group.size)
+		{
+			return;
+		}
+
+		// 그룹의 모든 Component를 가져야 편입
+		if ((mSignatures[entityId] & group.mask) != group.mask)
+		{
+			return;
+		}
+
+		// 각 저장소에서 패킹 영역 바로 뒤 슬롯과 교환
+		for (IComponentStorage* storage : group.storages)
+		{
+			storage->SwapDense(storage->GetDenseIndex(entityId), group.size);
+		}
+
+		++group.size;
+	}
+
+	void Registry::RemoveFromGroup(ArchetypeGroupData& group, Core::uint32 entityId)
+	{
+		const Core::uint32 leadIndex = group.storages[0]->GetDenseIndex(entityId);
+		if (leadIndex == IComponentStorage::INVALID_INDEX || leadIndex >= group.size)
+		{
+			return;
+		}
+
+		// 패킹 영역의 마지막 슬롯과 교환 후 영역 축소
+		--group.size;
+		for (IComponentStorage* storage : group.storages)
+		{
+			storage->SwapDense(storage->GetDenseIndex(entityId), group.size);
+		}
+	}
+
+	void Registry::InitializeGroup(ArchetypeGroupData& group)
+	{
+		IComponentStorage* smallest = group.storages[0];
+		for (IComponentStorage* storage : group.storages)
+		{
+			CORE_ASSERT(storage->GetOwningGroup() == nullptr, "Component storage is already owned by another archetype group");
+			storage->SetOwningGroup(&group);
+
+			if (storage->Size() < smallest->Size())
+			{
+				smallest = storage;
+			}
+		}
+
+		// 가장 작은 저장소 기준으로 기존 Entity 편입 (교환 중 순서가 바뀌므로 복사본 사용)
+		const std::vector<Core::uint32> candidates = smallest->GetEntityIds();
+		for (Core::uint32 entityId : candidates)
+		{
+			AddToGroup(group, entityId);
+		}
+	}
+
+	//=========================================================================
+	// 캐시된 View 쿼리
+	//=========================================================================
+
+	void Registry::AddToQuery(QueryData& query, Core::uint32 entityId)
+	{
+		// 이미 매칭 목록에 있으면 무시
+		if (entityId < query.positions.size() && query.positions[entityId] != IComponentStorage::INVALID_INDEX)
+		{
+			return;
+		}
+
+		if ((mSignatures[entityId] & query.mask) != query.mask)
+		{
+			return;
+		}
+
+		if (entityId >= query.positions.size())
+		{
+			query.positions.resize(static_cast<size_t>(entityId) + 1, IComponentStorage::INVALID_INDEX);
+		}
+
+		query.positions[entityId] = static_cast<Core::uint32>(query.entityIds.size());
+		query.entityIds.push_back(entityId);
+	}
+
+	void Registry::RemoveFromQuery(QueryData& query, Core::uint32 entityId)
+	{
+		if (entityId >= query.positions.size())
+		{
+			return;
+		}
+
+		const Core::uint32 position = query.positions[entityId];
+		if (position == IComponentStorage::INVALID_INDEX)
+		{
+			return;
+		}
+
+		// swap-and-pop
+		const Core::uint32 lastEntityId = query.entityIds.back();
+		query.entityIds[position] = lastEntityId;
+		query.positions[lastEntityId] = position;
+
+		query.entityIds.pop_back();
+		query.positions[entityId] = IComponentStorage::INVALID_INDEX;
+	}
+
+	void Registry::InitializeQuery(QueryData& query)
+	{
+		IComponentStorage* smallest = query.storages[0];
+		for (IComponentStorage* storage : query.storages)
+		{
+			storage->AddQuery(&query);
+
+			if (storage->Size() < smallest->Size())
+			{
+				smallest = storage;
+			}
+		}
+
+		// 가장 작은 저장소만 훑어 기존 매칭 Entity 수집
+		query.entityIds.reserve(smallest->Size());
+		for (Core::uint32 entityId : smallest->GetEntityIds())
+		{
+			AddToQuery(query, entityId);
+		}
+	}
+
 } // namespace ECS
@@ -1,6 +1,7 @@
 ﻿#include "pch.h"
 #include "ECS/SystemManager.h"
 #include "ECS/Registry.h"
+#include "Core/Jobs/JobSystem.h"
 
 namespace ECS
 {
@@ -18,11 +19,165 @@ namespace ECS
 
 	void SystemManager::UpdateSystems(Core::float32 deltaTime)
 	{
-		for (auto& system : mSystems)
+		if (mScheduleDirty)
 		{
-			if (system->IsActive())
+			BuildSchedule();
+		}
+
+		const Core::uint32 systemCount = static_cast<Core::uint32>(mSystems.size());
+		const bool canRunParallel = mParallelUpdate
+			&& systemCount > 1
+			&& Core::Jobs::JobSystem::IsValid()
+			&& Core::Jobs::JobSystem::GetCurrentThreadIndex() != Core::Jobs::JobSystem::INVALID_THREAD_INDEX;
+
+		if (!canRunParallel)
+		{
+			// 등록 순서는 항상 유효한 위상 정렬 순서
+			for (Core::uint32 i = 0; i < systemCount; ++i)
+			{
+				RunSystem(i, deltaTime);
+			}
+		}
+		else
+		{
+			for (Core::uint32 i = 0; i < systemCount; ++i)
+			{
+				mPendingDependencies[i].store(static_cast<Core::uint32>(mNodes[i].dependencies.size()), std::memory_order_relaxed);
+			}
+
+			// 선행 System이 없는 노드부터 제출, 나머지는 선행 System 완료 시 연쇄 제출
+			Core::Jobs::JobCounter counter;
+			for (Core::uint32 i = 0; i < systemCount; ++i)
+			{
+				if (mNodes[i].dependencies.empty())
+				{
+					ScheduleSystem(i, counter, deltaTime);
+				}
+			}
+
+			Core::Jobs::JobSystem::GetInstance().Wait(counter);
+		}
+
+		// 재생 및 프레임 사이 변경이 모든 System의 실행 틱보다 뒤에 기록되도록 증가
+		mRegistry->AdvanceChangeTick();
+
+		PlaybackCommandBuffers();
+	}
+
+	void SystemManager::BuildSchedule()
+	{
+		const Core::uint32 systemCount = static_cast<Core::uint32>(mNodes.size());
+
+		for (SystemNode& node : mNodes)
+		{
+			node.dependencies.clear();
+			node.dependents.clear();
+			node.level = 0;
+		}
+
+		// 먼저 등록된 System과 충돌하면 간선 추가 (등록 순서 = 충돌 시 실행 순서)
+		for (Core::uint32 later = 0; later < systemCount; ++later)
+		{
+			SystemNode& laterNode = mNodes[later];
+			for (Core::uint32 earlier = 0; earlier < later; ++earlier)
+			{
+				SystemNode& earlierNode = mNodes[earlier];
+				if (earlierNode.access.ConflictsWith(laterNode.access))
+				{
+					laterNode.dependencies.push_back(earlier);
+					earlierNode.dependents.push_back(later);
+					laterNode.level = std::max(laterNode.level, earlierNode.level + 1);
+				}
+			}
+		}
+
+		mPendingDependencies = std::make_unique<std::atomic<Core::uint32>[]>(systemCount);
+		mScheduleDirty = false;
+
+		LOG_INFO("[SystemManager] Schedule built\n%s", DumpSchedule().c_str());
+	}
+
+	void SystemManager::RunSystem(Core::uint32 index, Core::float32 deltaTime)
+	{
+		ISystem& system = *mSystems[index];
+		if (!system.IsActive())
+		{
+			mNodes[index].lastUpdateMs = 0.0;
+			return;
+		}
+
+		// System마다 새 틱에서 실행 (이전 System의 변경과 구분)
+		mRegistry->AdvanceChangeTick();
+
+		const auto start = std::chrono::high_resolution_clock::now();
+		system.Update(deltaTime);
+		const auto end = std::chrono::high_resolution_clock::now();
+
+		// 실행이 끝난 시점의 틱을 기록
+		// 병렬 실행 중 다른 System이 틱을 올리면 이 System의 쓰기가 시작 틱보다 큰 틱으로 기록되므로,
+		// 시작 틱을 기록하면 다음 실행에서 자기 출력을 Changed로 다시 처리하게 됨.
+		// 동시에 실행되는 System은 이 System이 읽는 Component를 쓰지 않으므로(DAG) 놓치는 변경은 없음
+		system.mLastRunTick = mRegistry->GetChangeTick();
+
+		mNodes[index].lastUpdateMs = std::chrono::duration<Core::float64, std::milli>(end - start).count();
+	}
+
+	void SystemManager::ScheduleSystem(Core::uint32 index, Core::Jobs::JobCounter& counter, Core::float32 deltaTime)
+	{
+		Core::Jobs::JobSystem::GetInstance().Run(counter, [this, index, &counter, deltaTime]()
+			{
+				RunSystem(index, deltaTime);
+
+				// 마지막 선행 System이 끝낸 쪽에서 후속 System 제출
+				for (Core::uint32 dependent : mNodes[index].dependents)
+				{
+					if (mPendingDependencies[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+					{
+						ScheduleSystem(dependent, counter, deltaTime);
+					}
+				}
+			});
+	}
+
+	std::string SystemManager::DumpSchedule() const
+	{
+		std::ostringstream stream;
+		stream << "System schedule (" << mNodes.size() << " systems, parallel: "
+			<< (mParallelUpdate ? "on" : "off") << ")\n";
+
+		for (const SystemNode& node : mNodes)
+		{
+			stream << "  [L" << node.level << "] "
+				<< std::left << std::setw(24) << node.name << std::right
+				<< std::fixed << std::setprecision(3) << std::setw(8) << node.lastUpdateMs << " ms";
+
+			if (node.access.IsExclusive())
+			{
+				stream << "  (exclusive)";
+			}
+
+			if (!node.dependencies.empty())
+			{
+				stream << "  after:";
+				for (Core::uint32 dependency : node.dependencies)
+				{
+					stream << ' ' << mNodes[dependency].name;
+				}
+			}
+
+			stream << '\n';
+		}
+
+		return stream.str();
+	}
+
+	void SystemManager::PlaybackCommandBuffers()
+	{
+		for (auto& commandBuffer : mCommandBuffers)
+		{
+			if (!commandBuffer->IsEmpty())
 			{
-				system->Update(deltaTime);
+				commandBuffer->Playback(*mRegistry);
 			}
 		}
 	}
@@ -35,8 +190,13 @@ namespace ECS
 			(*it)->Shutdown();
 		}
 
+		// 종료 중 기록된 명령은 적용하지 않고 폐기
 		mSystems.clear();
-		mSystemMap.clear();
+		mCommandBuffers.clear();
+		mSystemLookup.clear();
+		mNodes.clear();
+		mPendingDependencies.reset();
+		mScheduleDirty = true;
 
 		LOG_INFO("[SystemManager] All systems shutdown");
 	}
@@ -31,9 +31,21 @@ namespace ECS
 
 	void CameraSystem::Update(Core::float32 deltaTime)
 	{
+		// 지난 실행 이후 Transform이 바뀐 카메라만 View 재계산 대상으로 표시
+		auto view = CameraArchetype::CreateView(*GetRegistry());
+		view.Each<Changed<TransformComponent>>(GetLastRunTick(), [](Entity, TransformComponent&, CameraComponent& camera)
+			{
+				camera.viewDirty = true;
+			});
+
 		UpdateAllCameras(*GetRegistry());
 	}
 
+	void CameraSystem::DeclareAccess(SystemAccess& access) const
+	{
+		access.Read<TransformComponent>().Write<CameraComponent>();
+	}
+
 	void CameraSystem::Shutdown()
 	{
 		LOG_INFO("[CameraSystem] Shutdown");
@@ -56,10 +68,9 @@ namespace ECS
 	{
 		auto view = CameraOnlyArchetype::CreateView(registry);
 
-		for (Entity entity : view)
+		for (auto [entity, camera] : view.Each())
 		{
-			auto* camera = registry.GetComponent<CameraComponent>(entity);
-			if (camera && camera->isMainCamera)
+			if (camera.isMainCamera)
 			{
 				return entity;
 			}
@@ -79,14 +90,10 @@ namespace ECS
 
 		// 기존 Main Camera 해제
 		auto view = CameraOnlyArchetype::CreateView(*GetRegistry());
-		for (Entity e : view)
-		{
-			auto* camera = GetRegistry()->GetComponent<CameraComponent>(e);
-			if (camera)
+		view.Each([](Entity, CameraComponent& camera)
 			{
-				camera->isMainCamera = false;
-			}
-		}
+				camera.isMainCamera = false;
+			});
 
 		targetCamera->isMainCamera = true;
 		LOG_INFO("[CameraSystem] Main camera set to Entity (ID: %u)", entity.id);
@@ -170,6 +177,7 @@ namespace ECS
 		}
 
 		SetLookAt(*transform, *camera, position, target, up);
+		GetRegistry()->MarkChanged<CameraComponent>(entity);
 		return true;
 	}
 
@@ -232,17 +240,17 @@ namespace ECS
 	{
 		auto view = CameraArchetype::CreateView(registry);
 
-		for (Entity entity : view)
-		{
-			auto* transform = registry.GetComponent<TransformComponent>(entity);
-			auto* camera = registry.GetComponent<CameraComponent>(entity);
-
-			if (transform && camera)
+		view.Each([&registry](Entity entity, TransformComponent& transform, CameraComponent& camera)
 			{
-				UpdateViewMatrix(*transform, *camera);
-				UpdateProjectionMatrix(*camera);
-			}
-		}
+				if (!camera.viewDirty && !camera.projectionDirty)
+				{
+					return;
+				}
+
+				UpdateViewMatrix(transform, camera);
+				UpdateProjectionMatrix(camera);
+				registry.MarkChanged<CameraComponent>(entity);
+			});
 	}
 
 	void CameraSystem::SetFovYDegrees(CameraComponent& camera, Core::float32 degrees)
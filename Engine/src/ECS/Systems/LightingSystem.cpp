@@ -25,9 +25,21 @@ namespace ECS
 
 	void LightingSystem::Update(Core::float32 deltaTime)
 	{
+		// 지난 실행 이후 바뀐 Directional Light만 방향 정규화 (Inspector 등에서 직접 수정된 값 보정)
+		auto view = DirectionalLightArchetype::CreateView(*GetRegistry());
+		view.Each<Changed<DirectionalLightComponent>>(GetLastRunTick(), [](Entity, DirectionalLightComponent& light)
+			{
+				light.direction.Normalize();
+			});
+
 		// 조명 애니메이션, 그림자 업데이트 등 향후 확장 예정
 	}
 
+	void LightingSystem::DeclareAccess(SystemAccess& access) const
+	{
+		access.Read<TransformComponent>().Write<DirectionalLightComponent, PointLightComponent>();
+	}
+
 	void LightingSystem::Shutdown()
 	{
 		LOG_INFO("[LightingSystem] Shutdown");
@@ -43,7 +55,7 @@ namespace ECS
 		if (!light) return false;
 
 		light->direction = direction.Normalized();
-		light->isDirty = true;
+		GetRegistry()->MarkChanged<DirectionalLightComponent>(entity);
 		return true;
 	}
 
@@ -52,13 +64,14 @@ namespace ECS
 		if (auto* dirLight = GetRegistry()->GetComponent<DirectionalLightComponent>(entity))
 		{
 			dirLight->color = color;
-			dirLight->isDirty = true;
+			GetRegistry()->MarkChanged<DirectionalLightComponent>(entity);
 			return true;
 		}
 
 		if (auto* pointLight = GetRegistry()->GetComponent<PointLightComponent>(entity))
 		{
 			pointLight->color = color;
+			GetRegistry()->MarkChanged<PointLightComponent>(entity);
 			return true;
 		}
 
@@ -70,13 +83,14 @@ namespace ECS
 		if (auto* dirLight = GetRegistry()->GetComponent<DirectionalLightComponent>(entity))
 		{
 			dirLight->intensity = intensity;
-			dirLight->isDirty = true;
+			GetRegistry()->MarkChanged<DirectionalLightComponent>(entity);
 			return true;
 		}
 
 		if (auto* pointLight = GetRegistry()->GetComponent<PointLightComponent>(entity))
 		{
 			pointLight->intensity = intensity;
+			GetRegistry()->MarkChanged<PointLightComponent>(entity);
 			return true;
 		}
 
@@ -89,6 +103,7 @@ namespace ECS
 		if (!light) return false;
 
 		light->range = range;
+		GetRegistry()->MarkChanged<PointLightComponent>(entity);
 		return true;
 	}
 
@@ -104,6 +119,7 @@ namespace ECS
 		light->constant = constant;
 		light->linear = linear;
 		light->quadratic = quadratic;
+		GetRegistry()->MarkChanged<PointLightComponent>(entity);
 		return true;
 	}
 
@@ -120,7 +136,7 @@ namespace ECS
 		auto view = DirectionalLightArchetype::CreateView(registry);
 
 		Core::uint32 count = 0;
-		for (Entity entity : view)
+		for (auto [entity, light] : view.Each())
 		{
 			if (count >= MAX_DIRECTIONAL_LIGHTS)
 			{
@@ -128,13 +144,10 @@ namespace ECS
 				break;
 			}
 
-			auto* light = registry.GetComponent<DirectionalLightComponent>(entity);
-			if (!light) continue;
-
 			Graphics::DirectionalLightData data;
-			data.direction = light->direction.ToDirection();
-			data.color = light->color;
-			data.intensity = light->intensity;
+			data.direction = light.direction.ToDirection();
+			data.color = light.color;
+			data.intensity = light.intensity;
 
 			outLights.push_back(data);
 			++count;
@@ -150,7 +163,7 @@ namespace ECS
 		auto view = PointLightArchetype::CreateView(registry);
 
 		Core::uint32 count = 0;
-		for (Entity entity : view)
+		for (auto [entity, transform, light] : view.Each())
 		{
 			if (count >= MAX_POINT_LIGHTS)
 			{
@@ -158,20 +171,16 @@ namespace ECS
 				break;
 			}
 
-			auto* transform = registry.GetComponent<TransformComponent>(entity);
-			auto* light = registry.GetComponent<PointLightComponent>(entity);
-			if (!transform || !light) continue;
-
 			Graphics::PointLightData data;
-			data.position = transform->position.ToPoint();
-			data.rangeAndColor.x = light->range;
-			data.rangeAndColor.y = light->color.x;
-			data.rangeAndColor.z = light->color.y;
-			data.rangeAndColor.w = light->color.z;
-			data.intensityAndAttenuation.x = light->intensity;
-			data.intensityAndAttenuation.y = light->constant;
-			data.intensityAndAttenuation.z = light->linear;
-			data.intensityAndAttenuation.w = light->quadratic;
+			data.position = transform.position.ToPoint();
+			data.rangeAndColor.x = light.range;
+			data.rangeAndColor.y = light.color.x;
+			data.rangeAndColor.z = light.color.y;
+			data.rangeAndColor.w = light.color.z;
+			data.intensityAndAttenuation.x = light.intensity;
+			data.intensityAndAttenuation.y = light.constant;
+			data.intensityAndAttenuation.z = light.linear;
+			data.intensityAndAttenuation.w = light.quadratic;
 
 			outLights.push_back(data);
 			++count;
@@ -195,9 +204,6 @@ namespace ECS
 		{
 			if (count >= MAX_DIRECTIONAL_LIGHTS) break;
 
-			auto* light = registry.GetComponent<DirectionalLightComponent>(entity);
-			if (!light) continue;
-
 			outEntities.push_back(entity);
 			++count;
 		}
@@ -241,7 +247,6 @@ namespace ECS
 	void LightingSystem::NormalizeDirection(DirectionalLightComponent& light)
 	{
 		light.direction.Normalize();
-		light.isDirty = true;
 	}
 
 } // namespace ECS
@@ -2,10 +2,13 @@
 #include "pch.h"
 #include "ECS/Systems/RenderSystem.h"
 #include "ECS/Archetype.h"
+#include "ECS/ArchetypeGroup.h"
 #include "ECS/Entity.h"
 #include "ECS/Registry.h"
 #include "ECS/RegistryView.h"
+#include "ECS/Components/BoundsComponent.h"
 #include "ECS/Components/CameraComponent.h"
+#include "ECS/Components/LightComponents.h"
 #include "ECS/Components/MaterialComponent.h"
 #include "ECS/Components/MeshComponent.h"
 #include "ECS/Components/TransformComponent.h"
@@ -13,12 +16,19 @@
 #include "ECS/Systems/LightingSystem.h"
 #include "ECS/Systems/TransformSystem.h"
 #include "Core/Assert.h"
+#include "Core/Jobs/JobSystem.h"
 #include "Core/Logging/LogMacros.h"
 #include "Framework/Resources/ResourceManager.h"
 #include "Graphics/Material.h"
 #include "Graphics/Mesh.h"
+#include "Graphics/RenderQueue.h"
+#include "Math/BoundingVolumes.h"
+#include "Math/MathBatch.h"
 #include "Math/MathUtils.h"
 
+#include <algorithm>
+#include <atomic>
+
 namespace ECS
 {
 	RenderSystem::RenderSystem(Registry& registry, Framework::ResourceManager* resourceManager)
@@ -34,6 +44,13 @@ namespace ECS
 
 	void RenderSystem::Initialize()
 	{
+		// 그룹/캐시 쿼리를 미리 생성 (생성 시 저장소 재배치가 병렬 Update 중에 일어나지 않도록)
+		RenderableArchetype::GetGroup(*GetRegistry());
+		BoundedArchetype::CreateView(*GetRegistry());
+		CameraOnlyArchetype::CreateView(*GetRegistry());
+		DirectionalLightArchetype::CreateView(*GetRegistry());
+		PointLightArchetype::CreateView(*GetRegistry());
+
 		LOG_INFO("[RenderSystem] Initialized");
 	}
 
@@ -64,52 +81,224 @@ namespace ECS
 
 		Math::Matrix4x4 viewProj = mFrameData.viewMatrix * mFrameData.projectionMatrix;
 
-		// 조명 데이터 수집
-		LightingSystem::CollectDirectionalLights(*GetRegistry(), mFrameData.directionalLights);
-		LightingSystem::CollectPointLights(*GetRegistry(), mFrameData.pointLights);
+		Registry& registry = *GetRegistry();
 
-		// Debug Entity 수집
-		LightingSystem::CollectDirectionalLightEntities(*GetRegistry(), mFrameData.debug.directionalLightEntities);
-		LightingSystem::CollectPointLightEntities(*GetRegistry(), mFrameData.debug.pointLightEntities);
+		// 조명은 바뀐 경우에만 다시 수집 (정적인 조명은 캐시 복사만)
+		// 수집은 렌더 아이템 수집과 독립적이므로 별도 Job으로 동시에 실행
+		// (사용하는 View는 Initialize에서 미리 생성됨)
+		auto collectLights = [this, &registry]()
+			{
+				if (AreLightsChanged(registry))
+				{
+					CollectLights(registry);
+				}
+
+				mFrameData.directionalLights = mLightCache.directionalLights;
+				mFrameData.pointLights = mLightCache.pointLights;
+				mFrameData.debug.directionalLightEntities = mLightCache.directionalLightEntities;
+				mFrameData.debug.pointLightEntities = mLightCache.pointLightEntities;
+			};
 
-		// Renderable Entity 순회
-		auto view = RenderableArchetype::CreateView(*GetRegistry());
+		const bool useJobs = Core::Jobs::JobSystem::IsValid()
+			&& Core::Jobs::JobSystem::GetCurrentThreadIndex() != Core::Jobs::JobSystem::INVALID_THREAD_INDEX;
 
-		for (Entity entity : view)
+		Core::Jobs::JobCounter lightingCounter;
+		if (useJobs)
 		{
-			auto* transform = GetRegistry()->GetComponent<TransformComponent>(entity);
-			auto* meshComp = GetRegistry()->GetComponent<MeshComponent>(entity);
-			auto* materialComp = GetRegistry()->GetComponent<MaterialComponent>(entity);
+			Core::Jobs::JobSystem::GetInstance().Run(lightingCounter, collectLights);
+		}
+		else
+		{
+			collectLights();
+		}
+
+		// Renderable Entity 컬링 + 수집 (그룹 패킹 인덱스 = 출력 인덱스, 구간 단위 병렬 처리)
+		auto group = RenderableArchetype::GetGroup(registry);
+		const Core::uint32 renderableCount = static_cast<Core::uint32>(group.size());
+		mFrameData.opaqueItems.resize(renderableCount);
 
-			Math::Matrix4x4 worldMatrix = TransformSystem::GetWorldMatrix(*transform);
+		const Math::Frustum frustum = Math::ExtractFrustum(viewProj);
+		const bool cullingEnabled = mFrustumCullingEnabled;
+		std::atomic<Core::uint32> culledCount{ 0 };
 
-			Graphics::Mesh* mesh = mResourceManager->GetMesh(meshComp->meshId);
-			if (!mesh)
+		auto buildRenderItem = [&](Core::uint32 index)
 			{
-				LOG_WARN("[RenderSystem] Mesh not found for entity %u", entity.id);
-				continue;
-			}
+				Graphics::RenderItem& renderItem = mFrameData.opaqueItems[index];
+
+				const TransformComponent& transform = group.Get<TransformComponent>(index);
+				const MeshComponent& meshComp = group.Get<MeshComponent>(index);
+				const MaterialComponent& materialComp = group.Get<MaterialComponent>(index);
+
+				Graphics::Mesh* mesh = mResourceManager->GetMesh(meshComp.meshId);
+				if (!mesh)
+				{
+					LOG_WARN("[RenderSystem] Mesh not found for entity %u", group.GetEntity(index).id);
+					renderItem.mesh = nullptr;
+					return;
+				}
+
+				Graphics::Material* material = mResourceManager->GetMaterial(materialComp.materialId);
+				if (!material)
+				{
+					LOG_WARN("[RenderSystem] Material not found for entity %u", group.GetEntity(index).id);
+					renderItem.mesh = nullptr;
+					return;
+				}
 
-			Graphics::Material* material = mResourceManager->GetMaterial(materialComp->materialId);
-			if (!material)
+				// GPU 업로드 경계: 캐시 형식(압축 가능)을 Matrix4x4로 변환
+				const Math::Matrix4x4 worldMatrix = Math::ToMatrix4x4(TransformSystem::GetWorldMatrix(transform));
+
+				renderItem.mesh = mesh;
+				renderItem.material = material;
+				renderItem.worldMatrix = worldMatrix;
+				renderItem.normalMatrix = Math::ToMatrix4x4(TransformSystem::GetWorldInvTranspose(transform));
+				renderItem.mvpMatrix = Math::MatrixTranspose(worldMatrix * viewProj);
+
+				// 정렬 키 (뷰 공간 깊이 = 월드 위치 · View 행렬 3번째 열, 행 벡터 규약)
+				const Math::Matrix4x4& view = mFrameData.viewMatrix;
+				const Core::float32 viewDepth = worldMatrix.m[3][0] * view.m[0][2]
+					+ worldMatrix.m[3][1] * view.m[1][2]
+					+ worldMatrix.m[3][2] * view.m[2][2]
+					+ view.m[3][2];
+
+				renderItem.sortKey = material->IsTransparent()
+					? Graphics::MakeTransparentSortKey(Graphics::RenderLayer::Transparent,
+						material->GetHash(), materialComp.materialId.id, meshComp.meshId.id, viewDepth)
+					: Graphics::MakeOpaqueSortKey(Graphics::RenderLayer::Opaque,
+						material->GetHash(), materialComp.materialId.id, meshComp.meshId.id, viewDepth);
+			};
+
+		const Core::uint32 chunkCount = (renderableCount + CULL_CHUNK_SIZE - 1) / CULL_CHUNK_SIZE;
+		Core::Jobs::ParallelFor(chunkCount, 1, [&](Core::uint32 chunkIndex)
 			{
-				LOG_WARN("[RenderSystem] Material not found for entity %u", entity.id);
-				continue;
-			}
+				const Core::uint32 begin = chunkIndex * CULL_CHUNK_SIZE;
+				const Core::uint32 end = std::min(begin + CULL_CHUNK_SIZE, renderableCount);
+
+				// 1. 경계가 있는 Entity의 월드 AABB 수집 (없으면 항상 보임)
+				Core::uint8 visible[CULL_CHUNK_SIZE];
+				Math::AABB boxes[CULL_CHUNK_SIZE];
+				Core::uint32 boxSlots[CULL_CHUNK_SIZE];
+				Core::uint32 boxCount = 0;
+
+				for (Core::uint32 index = begin; index < end; ++index)
+				{
+					visible[index - begin] = 1;
+					if (!cullingEnabled)
+					{
+						continue;
+					}
 
-			Graphics::RenderItem renderItem;
-			renderItem.mesh = mesh;
-			renderItem.material = material;
-			renderItem.worldMatrix = worldMatrix;
-			renderItem.mvpMatrix = Math::MatrixTranspose(worldMatrix * viewProj);
+					const BoundsComponent* bounds = registry.GetComponent<BoundsComponent>(group.GetEntity(index));
+					if (bounds)
+					{
+						boxes[boxCount] = bounds->worldBounds;
+						boxSlots[boxCount] = index - begin;
+						++boxCount;
+					}
+				}
 
-			mFrameData.opaqueItems.push_back(renderItem);
+				// 2. 절두체 판정 (SIMD 배치 커널)
+				if (boxCount > 0)
+				{
+					Core::uint8 boxVisible[CULL_CHUNK_SIZE];
+					const Core::uint32 visibleBoxes = Math::FrustumCullBatch(frustum, boxes, boxVisible, boxCount);
+					for (Core::uint32 slot = 0; slot < boxCount; ++slot)
+					{
+						visible[boxSlots[slot]] = boxVisible[slot];
+					}
+					culledCount.fetch_add(boxCount - visibleBoxes, std::memory_order_relaxed);
+				}
+
+				// 3. 보이는 Entity만 렌더 아이템 생성
+				for (Core::uint32 index = begin; index < end; ++index)
+				{
+					if (!visible[index - begin])
+					{
+						mFrameData.opaqueItems[index].mesh = nullptr;
+						continue;
+					}
+
+					buildRenderItem(index);
+				}
+			});
+
+		// 컬링되었거나 리소스를 찾지 못한 항목 제거
+		std::erase_if(mFrameData.opaqueItems, [](const Graphics::RenderItem& item)
+			{
+				return item.mesh == nullptr;
+			});
+
+		// 정렬 키 순서로 정렬한 뒤 투명 레이어 분리 (레이어가 키 최상위 비트이므로 불투명이 앞)
+		mRenderQueueSorter.Sort(mFrameData.opaqueItems);
+		auto firstTransparent = std::find_if(mFrameData.opaqueItems.begin(), mFrameData.opaqueItems.end(),
+			[](const Graphics::RenderItem& item)
+			{
+				return Graphics::GetSortKeyLayer(item.sortKey) != Graphics::RenderLayer::Opaque;
+			});
+		mFrameData.transparentItems.assign(firstTransparent, mFrameData.opaqueItems.end());
+		mFrameData.opaqueItems.erase(firstTransparent, mFrameData.opaqueItems.end());
+
+		mFrameData.stats.renderableCount = renderableCount;
+		mFrameData.stats.visibleCount = static_cast<Core::uint32>(mFrameData.opaqueItems.size() + mFrameData.transparentItems.size());
+		mFrameData.stats.culledCount = culledCount.load(std::memory_order_relaxed);
+
+		if (useJobs)
+		{
+			Core::Jobs::JobSystem::GetInstance().Wait(lightingCounter);
+		}
+	}
+
+	void RenderSystem::DeclareAccess(SystemAccess& access) const
+	{
+		access.Read<TransformComponent, MeshComponent, MaterialComponent, CameraComponent, BoundsComponent>()
+			.Read<DirectionalLightComponent, PointLightComponent>();
+	}
+
+	bool RenderSystem::AreLightsChanged(Registry& registry) const
+	{
+		if (mLightCacheTick == 0)
+		{
+			return true;
+		}
+
+		// 조명 Component 추가/변경/제거, 또는 Transform 구조 변경 (Point Light 편입/제외 가능)
+		if (registry.HasChangesSince<DirectionalLightComponent>(mLightCacheTick)
+			|| registry.HasChangesSince<PointLightComponent>(mLightCacheTick)
+			|| registry.HasStructuralChangesSince<TransformComponent>(mLightCacheTick))
+		{
+			return true;
 		}
+
+		// Point Light 위치 변경 (Transform 저장소에 쓰기가 없으면 순회 없이 false)
+		bool moved = false;
+		PointLightArchetype::CreateView(registry).Each<Changed<TransformComponent>>(mLightCacheTick,
+			[&moved](Entity, TransformComponent&, PointLightComponent&)
+			{
+				moved = true;
+			});
+
+		return moved;
+	}
+
+	void RenderSystem::CollectLights(Registry& registry)
+	{
+		// 조명 데이터 수집
+		LightingSystem::CollectDirectionalLights(registry, mLightCache.directionalLights);
+		LightingSystem::CollectPointLights(registry, mLightCache.pointLights);
+
+		// Debug Entity 수집
+		LightingSystem::CollectDirectionalLightEntities(registry, mLightCache.directionalLightEntities);
+		LightingSystem::CollectPointLightEntities(registry, mLightCache.pointLightEntities);
+
+		// 조명을 쓰는 System은 이 System보다 먼저 끝나므로 (의존 그래프) 이후 변경은 더 큰 틱을 가짐
+		mLightCacheTick = registry.GetChangeTick();
 	}
 
 	void RenderSystem::Shutdown()
 	{
 		mFrameData.Clear();
+		mLightCache = LightCache{};
+		mLightCacheTick = 0;
 		LOG_INFO("[RenderSystem] Shutdown");
 	}
 
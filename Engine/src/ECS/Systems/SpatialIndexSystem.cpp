@@ -0,0 +1,214 @@
+﻿#include "pch.h"
+#include "ECS/Systems/SpatialIndexSystem.h"
+#include "ECS/Archetype.h"
+#include "ECS/Registry.h"
+#include "ECS/RegistryView.h"
+#include "ECS/Components/BoundsComponent.h"
+#include "ECS/Components/TransformComponent.h"
+#include "Core/Logging/LogMacros.h"
+
+namespace ECS
+{
+	SpatialIndexSystem::SpatialIndexSystem(Registry& registry)
+		: ISystem(registry)
+	{
+	}
+
+	//=========================================================================
+	// ISystem 인터페이스
+	//=========================================================================
+
+	void SpatialIndexSystem::Initialize()
+	{
+		// Entity 삭제 등으로 BoundsComponent가 사라질 때 트리에서 제거
+		GetRegistry()->SetRemoveHook<BoundsComponent>(&SpatialIndexSystem::BoundsRemoveHook, this);
+
+		BoundedArchetype::CreateView(*GetRegistry());
+
+		LOG_INFO("[SpatialIndexSystem] Initialized");
+	}
+
+	void SpatialIndexSystem::Update(Core::float32 deltaTime)
+	{
+		(void)deltaTime;
+
+		// TransformComponent만 제거되면 BoundsComponent 제거 훅이 불리지 않으므로,
+		// Transform 추가/제거가 있었던 실행에서만 쿼리에서 빠진 Entity의 리프를 정리
+		if (GetRegistry()->HasStructuralChangesSince<TransformComponent>(GetLastRunTick()))
+		{
+			PruneUntransformed();
+		}
+
+		// 지난 실행 이후 월드 경계가 바뀐(추가 포함) Entity만 트리에 반영
+		auto view = BoundedArchetype::CreateView(*GetRegistry());
+		view.Each<Changed<BoundsComponent>>(GetLastRunTick(), [this](Entity entity, TransformComponent&, BoundsComponent& bounds)
+			{
+				if (entity.id >= mProxyByEntity.size())
+				{
+					mProxyByEntity.resize(entity.id + 1, DynamicAABBTree::INVALID_PROXY);
+				}
+
+				Core::uint32& proxyId = mProxyByEntity[entity.id];
+				if (proxyId == DynamicAABBTree::INVALID_PROXY)
+				{
+					proxyId = mTree.CreateProxy(bounds.worldBounds, entity.id);
+				}
+				else
+				{
+					mTree.MoveProxy(proxyId, bounds.worldBounds);
+				}
+			});
+
+		// 증분 삽입으로 품질이 떨어졌으면 SAH로 재구성 (처음 채워진 뒤에도 한 번 재구성)
+		if (mTree.GetProxyCount() >= 2)
+		{
+			const Core::float32 areaRatio = mTree.GetAreaRatio();
+			if (mRebuiltAreaRatio == 0.0f || areaRatio > mRebuiltAreaRatio * REBUILD_QUALITY_FACTOR)
+			{
+				mTree.Rebuild();
+				mRebuiltAreaRatio = mTree.GetAreaRatio();
+				++mRebuildCount;
+			}
+		}
+	}
+
+	void SpatialIndexSystem::DeclareAccess(SystemAccess& access) const
+	{
+		access.Read<TransformComponent, BoundsComponent>();
+	}
+
+	void SpatialIndexSystem::Shutdown()
+	{
+		GetRegistry()->SetRemoveHook<BoundsComponent>(nullptr, nullptr);
+
+		mTree.Clear();
+		mProxyByEntity.clear();
+		mRebuiltAreaRatio = 0.0f;
+
+		LOG_INFO("[SpatialIndexSystem] Shutdown");
+	}
+
+	//=========================================================================
+	// 쿼리
+	//=========================================================================
+
+	void SpatialIndexSystem::QueryFrustum(const Math::Frustum& frustum, std::vector<Entity>& outEntities) const
+	{
+		const Registry* registry = GetRegistry();
+		mTree.QueryFrustum(frustum, [&](Core::uint32 entityId)
+			{
+				outEntities.push_back(registry->GetEntityById(entityId));
+			});
+	}
+
+	void SpatialIndexSystem::QuerySphere(const Math::BoundingSphere& sphere, std::vector<Entity>& outEntities) const
+	{
+		const Registry* registry = GetRegistry();
+		mTree.QuerySphere(sphere, [&](Core::uint32 entityId)
+			{
+				outEntities.push_back(registry->GetEntityById(entityId));
+			});
+	}
+
+	void SpatialIndexSystem::QueryBox(const Math::AABB& box, std::vector<Entity>& outEntities) const
+	{
+		const Registry* registry = GetRegistry();
+		mTree.QueryAABB(box, [&](Core::uint32 entityId)
+			{
+				outEntities.push_back(registry->GetEntityById(entityId));
+			});
+	}
+
+	void SpatialIndexSystem::QueryFrustums(
+		const Math::Frustum* frustums,
+		Core::uint32 count,
+		std::vector<Entity>& outEntities,
+		std::vector<Core::uint32>& outMasks
+	) const
+	{
+		const Registry* registry = GetRegistry();
+		mTree.QueryFrustums(frustums, count, [&](Core::uint32 entityId, Core::uint32 mask)
+			{
+				outEntities.push_back(registry->GetEntityById(entityId));
+				outMasks.push_back(mask);
+			});
+	}
+
+	Entity SpatialIndexSystem::RayCast(
+		const Math::Vector3& origin,
+		const Math::Vector3& direction,
+		Core::float32 maxDistance,
+		Core::float32* outDistance
+	) const
+	{
+		Core::uint32 closestId = DynamicAABBTree::INVALID_PROXY;
+		Core::float32 closestDistance = maxDistance;
+
+		// 만날 때마다 최대 거리를 줄여 더 먼 서브트리는 건너뜀
+		mTree.RayCast(origin, direction, maxDistance, [&](Core::uint32 entityId, Core::float32 distance)
+			{
+				if (distance < closestDistance || closestId == DynamicAABBTree::INVALID_PROXY)
+				{
+					closestId = entityId;
+					closestDistance = distance;
+				}
+				return closestDistance;
+			});
+
+		if (closestId == DynamicAABBTree::INVALID_PROXY)
+		{
+			return Entity::Invalid();
+		}
+
+		if (outDistance)
+		{
+			*outDistance = closestDistance;
+		}
+		return GetRegistry()->GetEntityById(closestId);
+	}
+
+	//=========================================================================
+	// 내부 구현
+	//=========================================================================
+
+	void SpatialIndexSystem::PruneUntransformed()
+	{
+		const Registry* registry = GetRegistry();
+		const Core::uint32 entityCount = static_cast<Core::uint32>(mProxyByEntity.size());
+		for (Core::uint32 entityId = 0; entityId < entityCount; ++entityId)
+		{
+			Core::uint32& proxyId = mProxyByEntity[entityId];
+			if (proxyId == DynamicAABBTree::INVALID_PROXY)
+			{
+				continue;
+			}
+
+			if (!registry->HasComponent<TransformComponent>(registry->GetEntityById(entityId)))
+			{
+				mTree.DestroyProxy(proxyId);
+				proxyId = DynamicAABBTree::INVALID_PROXY;
+			}
+		}
+	}
+
+	void SpatialIndexSystem::OnBoundsRemoved(Entity entity)
+	{
+		if (entity.id >= mProxyByEntity.size())
+		{
+			return;
+		}
+
+		Core::uint32& proxyId = mProxyByEntity[entity.id];
+		if (proxyId != DynamicAABBTree::INVALID_PROXY)
+		{
+			mTree.DestroyProxy(proxyId);
+			proxyId = DynamicAABBTree::INVALID_PROXY;
+		}
+	}
+
+	void SpatialIndexSystem::BoundsRemoveHook(void* context, Entity entity)
+	{
+		static_cast<SpatialIndexSystem*>(context)->OnBoundsRemoved(entity);
+	}
+
+} // namespace ECS
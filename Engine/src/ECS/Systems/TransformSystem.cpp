@@ -6,9 +6,11 @@
 #include "ECS/RegistryView.h"
 
 // Core
+#include "Core/Jobs/JobSystem.h"
 #include "Core/Logging/LogMacros.h"
 
 // Math
+#include "Math/MathBatch.h"
 #include "Math/MathUtils.h"
 #include "Math/MathTypes.h"
 
@@ -17,12 +19,6 @@
 
 namespace ECS
 {
-	//=============================================================================
-	// 정적 멤버 초기화
-	//=============================================================================
-
-	const std::vector<Entity> TransformSystem::sEmptyChildren;
-
 	//=============================================================================
 	// 생성자
 	//=============================================================================
@@ -38,6 +34,12 @@ namespace ECS
 
 	void TransformSystem::Initialize()
 	{
+		// Entity 삭제 등으로 HierarchyComponent가 사라질 때 형제/부모 링크를 정리
+		GetRegistry()->SetRemoveHook<HierarchyComponent>(&TransformSystem::HierarchyRemoveHook, this);
+
+		// 경계 쿼리를 미리 생성 (생성 시 저장소 재배치가 병렬 Update 중에 일어나지 않도록)
+		BoundedArchetype::CreateView(*GetRegistry());
+
 		LOG_INFO("[TransformSystem] Initialized");
 	}
 
@@ -45,24 +47,63 @@ namespace ECS
 	{
 		(void)deltaTime;
 
-		// 1. Root Entity부터 DFS 순회하며 계층 구조 업데이트
-		for (Entity root : mRootEntities)
+		Registry* registry = GetRegistry();
+
+		// 1. 계층 구조가 바뀌었을 때만 평탄화 배열 재구성
+		//    (SetParent 호출, 또는 Entity 삭제 등으로 HierarchyComponent가 추가/제거된 경우)
+		if (mHierarchyDirty || registry->HasStructuralChangesSince<HierarchyComponent>(mHierarchyBuildTick))
 		{
-			if (!GetRegistry()->IsEntityValid(root))
-			{
-				continue;
-			}
+			RebuildFlatHierarchy();
+		}
+		else if (mFlatWorldStale)
+		{
+			SyncFlatWorldMatrices();
+		}
+
+		// 2. HierarchyComponent 없는 Entity들 단독 처리 (계층과 겹치지 않으므로 동시에 실행)
+		const bool useJobs = Core::Jobs::JobSystem::IsValid()
+			&& Core::Jobs::JobSystem::GetCurrentThreadIndex() != Core::Jobs::JobSystem::INVALID_THREAD_INDEX;
+
+		Core::Jobs::JobCounter standaloneCounter;
+		if (useJobs)
+		{
+			Core::Jobs::JobSystem::GetInstance().Run(standaloneCounter, [this]()
+				{
+					UpdateStandaloneEntities();
+				});
+		}
+
+		// 3. 평탄화 배열을 순회하며 계층 구조 업데이트
+		UpdateFlatHierarchy();
 
-			UpdateHierarchy(root, Math::Matrix4x4::Identity());
+		if (useJobs)
+		{
+			Core::Jobs::JobSystem::GetInstance().Wait(standaloneCounter);
 		}
+		else
+		{
+			UpdateStandaloneEntities();
+		}
+
+		// 4. 경계 볼륨 (World Matrix가 모두 확정된 뒤)
+		UpdateBoundedEntities();
+	}
 
-		// 2. HierarchyComponent 없는 Entity들 단독 처리
-		UpdateStandaloneEntities();
+	void TransformSystem::DeclareAccess(SystemAccess& access) const
+	{
+		access.Read<HierarchyComponent>().Write<TransformComponent, BoundsComponent>();
 	}
 
 	void TransformSystem::Shutdown()
 	{
-		mRootEntities.clear();
+		GetRegistry()->SetRemoveHook<HierarchyComponent>(nullptr, nullptr);
+
+		mFirstRoot = Entity::Invalid();
+		mLastRoot = Entity::Invalid();
+		mRootCount = 0;
+		mFlatHierarchy = FlatHierarchy{};
+		mHierarchyDirty = true;
+		mBoundsTick = 0;
 		LOG_INFO("[TransformSystem] Shutdown");
 	}
 
@@ -89,82 +130,71 @@ namespace ECS
 			return false;
 		}
 
-		// 기존 부모에서 제거
-		Entity oldParent = childHierarchy->parent;
-		if (oldParent.IsValid())
-		{
-			auto* oldParentHierarchy = registry->GetComponent<HierarchyComponent>(oldParent);
-			if (oldParentHierarchy)
-			{
-				auto& children = oldParentHierarchy->children;
-				children.erase(
-					std::remove(children.begin(), children.end(), child),
-					children.end()
-				);
-			}
-		}
-		else
-		{
-			// 기존에 Root였으면 Root 목록에서 제거
-			RemoveRootEntity(child);
-		}
+		// 이후 경로는 모두 부모-자식 관계를 바꾸므로 평탄화 배열 재구성 예약
+		mHierarchyDirty = true;
 
-		// 새 부모 설정
-		if (parent.IsValid())
+		// 기존 부모(또는 Root 목록)에서 분리
+		UnlinkEntity(child, *childHierarchy);
+
+		// child의 worldDirty 설정
+		auto* childTransform = registry->GetComponent<TransformComponent>(child);
+		if (childTransform)
 		{
-			// parent 유효성 검사
-			if (!registry->IsEntityValid(parent))
-			{
-				LOG_WARN("[TransformSystem] SetParent: Invalid parent entity");
-				childHierarchy->parent = Entity::Invalid();
-				AddRootEntity(child);
-				return false;
-			}
+			childTransform->worldDirty = true;
+		}
 
-			// parent에 HierarchyComponent 필요
-			auto* parentHierarchy = registry->GetComponent<HierarchyComponent>(parent);
-			if (!parentHierarchy)
+		// 실패 시 Root로 설정
+		auto setRoot = [&]()
 			{
-				LOG_WARN("[TransformSystem] SetParent: Parent entity %u has no HierarchyComponent", parent.id);
-				childHierarchy->parent = Entity::Invalid();
-				AddRootEntity(child);
-				return false;
-			}
+				LinkEntity(child, *childHierarchy, Entity::Invalid());
+				UpdateSubtreeDepth(child, *childHierarchy, 0);
+			};
 
-			// 순환 참조 방지 (parent가 child의 자손인지 확인)
-			Entity ancestor = parent;
-			while (ancestor.IsValid())
-			{
-				if (ancestor == child)
-				{
-					LOG_WARN("[TransformSystem] SetParent: Circular hierarchy detected");
-					childHierarchy->parent = Entity::Invalid();
-					AddRootEntity(child);
-					return false;
-				}
+		if (!parent.IsValid())
+		{
+			// parent가 Invalid면 Root로 설정
+			setRoot();
+			return true;
+		}
 
-				auto* ancestorHierarchy = registry->GetComponent<HierarchyComponent>(ancestor);
-				ancestor = ancestorHierarchy ? ancestorHierarchy->parent : Entity::Invalid();
-			}
+		// parent 유효성 검사
+		if (!registry->IsEntityValid(parent))
+		{
+			LOG_WARN("[TransformSystem] SetParent: Invalid parent entity");
+			setRoot();
+			return false;
+		}
 
-			// 새 부모의 children에 추가
-			parentHierarchy->children.push_back(child);
-			childHierarchy->parent = parent;
+		// parent에 HierarchyComponent 필요
+		auto* parentHierarchy = registry->GetComponent<HierarchyComponent>(parent);
+		if (!parentHierarchy)
+		{
+			LOG_WARN("[TransformSystem] SetParent: Parent entity %u has no HierarchyComponent", parent.id);
+			setRoot();
+			return false;
 		}
-		else
+
+		// 순환 참조 방지 (parent가 child의 자손인지 확인)
+		// child의 서브트리 depth는 서로 일관되므로, parent에서 child와 같은 depth까지만 올라가 보면 됨
+		Entity ancestor = parent;
+		const HierarchyComponent* ancestorHierarchy = parentHierarchy;
+		while (ancestorHierarchy->depth > childHierarchy->depth)
 		{
-			// parent가 Invalid면 Root로 설정
-			childHierarchy->parent = Entity::Invalid();
-			AddRootEntity(child);
+			CORE_ASSERT(ancestorHierarchy->parent.IsValid(), "Hierarchy depth is inconsistent");
+			ancestor = ancestorHierarchy->parent;
+			ancestorHierarchy = registry->GetComponent<HierarchyComponent>(ancestor);
 		}
 
-		// child의 worldDirty 설정
-		auto* childTransform = registry->GetComponent<TransformComponent>(child);
-		if (childTransform)
+		if (ancestor == child)
 		{
-			childTransform->worldDirty = true;
+			LOG_WARN("[TransformSystem] SetParent: Circular hierarchy detected");
+			setRoot();
+			return false;
 		}
 
+		// 새 부모의 자식 목록 끝에 연결
+		LinkEntity(child, *childHierarchy, parent);
+		UpdateSubtreeDepth(child, *childHierarchy, parentHierarchy->depth + 1);
 		return true;
 	}
 
@@ -174,10 +204,46 @@ namespace ECS
 		return hierarchy ? hierarchy->parent : Entity::Invalid();
 	}
 
-	const std::vector<Entity>& TransformSystem::GetChildren(Entity entity) const
+	Entity TransformSystem::GetFirstChild(Entity entity) const
 	{
 		const auto* hierarchy = GetRegistry()->GetComponent<HierarchyComponent>(entity);
-		return hierarchy ? hierarchy->children : sEmptyChildren;
+		return hierarchy ? hierarchy->firstChild : Entity::Invalid();
+	}
+
+	Entity TransformSystem::GetNextSibling(Entity entity) const
+	{
+		const auto* hierarchy = GetRegistry()->GetComponent<HierarchyComponent>(entity);
+		return hierarchy ? hierarchy->nextSibling : Entity::Invalid();
+	}
+
+	Core::uint32 TransformSystem::GetChildCount(Entity entity) const
+	{
+		const auto* hierarchy = GetRegistry()->GetComponent<HierarchyComponent>(entity);
+		return hierarchy ? hierarchy->childCount : 0;
+	}
+
+	Core::uint32 TransformSystem::GetDepth(Entity entity) const
+	{
+		const auto* hierarchy = GetRegistry()->GetComponent<HierarchyComponent>(entity);
+		return hierarchy ? hierarchy->depth : 0;
+	}
+
+	void TransformSystem::GetChildren(Entity entity, std::vector<Entity>& outChildren) const
+	{
+		const Registry* registry = GetRegistry();
+
+		outChildren.clear();
+		const auto* hierarchy = registry->GetComponent<HierarchyComponent>(entity);
+		if (!hierarchy)
+		{
+			return;
+		}
+
+		outChildren.reserve(hierarchy->childCount);
+		for (Entity child = hierarchy->firstChild; child.IsValid(); child = registry->GetComponent<HierarchyComponent>(child)->nextSibling)
+		{
+			outChildren.push_back(child);
+		}
 	}
 
 	bool TransformSystem::IsRoot(Entity entity) const
@@ -186,6 +252,18 @@ namespace ECS
 		return hierarchy && !hierarchy->parent.IsValid();
 	}
 
+	void TransformSystem::GetRootEntities(std::vector<Entity>& outRoots) const
+	{
+		const Registry* registry = GetRegistry();
+
+		outRoots.clear();
+		outRoots.reserve(mRootCount);
+		for (Entity root = mFirstRoot; root.IsValid(); root = registry->GetComponent<HierarchyComponent>(root)->nextSibling)
+		{
+			outRoots.push_back(root);
+		}
+	}
+
 	//=============================================================================
 	// 고수준 API (Entity 기반)
 	//=============================================================================
@@ -318,7 +396,7 @@ namespace ECS
 			return false;
 		}
 
-		outMatrix = transform->worldMatrix;
+		outMatrix = Math::ToMatrix4x4(transform->worldMatrix);
 		return true;
 	}
 
@@ -330,7 +408,7 @@ namespace ECS
 			return false;
 		}
 
-		outMatrix = transform->localMatrix;
+		outMatrix = Math::ToMatrix4x4(transform->localMatrix);
 		return true;
 	}
 
@@ -342,7 +420,7 @@ namespace ECS
 			return false;
 		}
 
-		outMatrix = GetWorldInvTranspose(*transform);
+		outMatrix = Math::ToMatrix4x4(GetWorldInvTranspose(*transform));
 		return true;
 	}
 
@@ -397,7 +475,7 @@ namespace ECS
 			const auto* parentTransform = registry->GetComponent<TransformComponent>(hierarchy->parent);
 			if (parentTransform)
 			{
-				transform->worldMatrix = transform->localMatrix * parentTransform->worldMatrix;
+				Math::MultiplyMatrixBatch(&transform->localMatrix, &parentTransform->worldMatrix, &transform->worldMatrix, 1);
 			}
 			else
 			{
@@ -410,7 +488,24 @@ namespace ECS
 			transform->worldMatrix = transform->localMatrix;
 		}
 
+		// 자신과 모든 조상이 균등 스케일인지 확인
+		bool uniformWorldScale = Math::IsUniformScale(transform->scale);
+		Entity ancestor = hierarchy ? hierarchy->parent : Entity::Invalid();
+		while (uniformWorldScale && ancestor.IsValid())
+		{
+			const auto* ancestorTransform = registry->GetComponent<TransformComponent>(ancestor);
+			uniformWorldScale = !ancestorTransform || Math::IsUniformScale(ancestorTransform->scale);
+
+			const auto* ancestorHierarchy = registry->GetComponent<HierarchyComponent>(ancestor);
+			ancestor = ancestorHierarchy ? ancestorHierarchy->parent : Entity::Invalid();
+		}
+		UpdateWorldInvTranspose(*transform, uniformWorldScale);
+
 		transform->worldDirty = false;
+		registry->MarkChanged<TransformComponent>(entity);
+
+		// 평탄화 배열의 World 캐시가 Component와 달라졌으므로 다음 Update에서 동기화
+		mFlatWorldStale = true;
 	}
 
 	//=============================================================================
@@ -449,40 +544,27 @@ namespace ECS
 		transform.rotation = (transform.rotation * delta).Normalized();
 	}
 
-	Math::Matrix4x4 TransformSystem::CalculateLocalMatrix(const TransformComponent& transform)
+	TransformMatrix TransformSystem::CalculateLocalMatrix(const TransformComponent& transform)
 	{
-		Math::Matrix4x4 scaleMatrix = Math::MatrixScaling(transform.scale);
-		Math::Matrix4x4 rotationMatrix = Math::MatrixRotationQuaternion(transform.rotation);
-		Math::Matrix4x4 translationMatrix = Math::MatrixTranslation(transform.position);
-
-		return scaleMatrix * rotationMatrix * translationMatrix;
+		// Scale * Rotation * Translation (계층 업데이트와 같은 배치 커널을 사용해 결과를 일치시킴)
+		TransformMatrix result;
+		Math::ComposeTRSBatch(&transform.position, &transform.rotation, &transform.scale, &result, 1);
+		return result;
 	}
 
-	const Math::Matrix4x4& TransformSystem::GetLocalMatrix(const TransformComponent& transform)
+	const TransformMatrix& TransformSystem::GetLocalMatrix(const TransformComponent& transform)
 	{
 		return transform.localMatrix;
 	}
 
-	const Math::Matrix4x4& TransformSystem::GetWorldMatrix(const TransformComponent& transform)
+	const TransformMatrix& TransformSystem::GetWorldMatrix(const TransformComponent& transform)
 	{
 		return transform.worldMatrix;
 	}
 
-	Math::Matrix4x4 TransformSystem::GetWorldInvTranspose(const TransformComponent& transform)
+	const TransformMatrix& TransformSystem::GetWorldInvTranspose(const TransformComponent& transform)
 	{
-		// 균등 스케일 체크
-		bool isUniform =
-			std::abs(transform.scale.x - transform.scale.y) < Math::EPSILON &&
-			std::abs(transform.scale.y - transform.scale.z) < Math::EPSILON;
-
-		if (isUniform)
-		{
-			// 균등 스케일: 역전치 불필요
-			return transform.worldMatrix;
-		}
-
-		// 비균등 스케일: 역전치 계산
-		return Math::MatrixTranspose(Math::MatrixInverse(transform.worldMatrix));
+		return transform.worldInvTranspose;
 	}
 
 	Math::Vector3 TransformSystem::GetForward(const TransformComponent& transform)
@@ -504,22 +586,159 @@ namespace ECS
 	// 내부 헬퍼 함수
 	//=============================================================================
 
-	void TransformSystem::AddRootEntity(Entity entity)
+	void TransformSystem::LinkEntity(Entity entity, HierarchyComponent& hierarchy, Entity parent)
 	{
-		// 이미 있는지 확인
-		auto it = std::find(mRootEntities.begin(), mRootEntities.end(), entity);
-		if (it == mRootEntities.end())
+		CORE_ASSERT(!hierarchy.prevSibling.IsValid() && !hierarchy.nextSibling.IsValid() && entity != mFirstRoot,
+			"Entity is already linked");
+
+		Registry* registry = GetRegistry();
+
+		// 부모의 자식 목록 또는 Root 목록
+		Entity* first = &mFirstRoot;
+		Entity* last = &mLastRoot;
+		Core::uint32* count = &mRootCount;
+		if (parent.IsValid())
+		{
+			auto* parentHierarchy = registry->GetComponent<HierarchyComponent>(parent);
+			first = &parentHierarchy->firstChild;
+			last = &parentHierarchy->lastChild;
+			count = &parentHierarchy->childCount;
+		}
+
+		hierarchy.parent = parent;
+		hierarchy.prevSibling = *last;
+		if (last->IsValid())
+		{
+			registry->GetComponent<HierarchyComponent>(*last)->nextSibling = entity;
+		}
+		else
 		{
-			mRootEntities.push_back(entity);
+			*first = entity;
 		}
+		*last = entity;
+		++(*count);
 	}
 
-	void TransformSystem::RemoveRootEntity(Entity entity)
+	void TransformSystem::UnlinkEntity(Entity entity, HierarchyComponent& hierarchy)
 	{
-		mRootEntities.erase(
-			std::remove(mRootEntities.begin(), mRootEntities.end(), entity),
-			mRootEntities.end()
-		);
+		Registry* registry = GetRegistry();
+
+		Entity* first = &mFirstRoot;
+		Entity* last = &mLastRoot;
+		Core::uint32* count = &mRootCount;
+		if (hierarchy.parent.IsValid())
+		{
+			auto* parentHierarchy = registry->GetComponent<HierarchyComponent>(hierarchy.parent);
+			CORE_ASSERT(parentHierarchy, "Parent lost its HierarchyComponent without unlinking children");
+			first = &parentHierarchy->firstChild;
+			last = &parentHierarchy->lastChild;
+			count = &parentHierarchy->childCount;
+		}
+		else if (!hierarchy.prevSibling.IsValid() && mFirstRoot != entity)
+		{
+			// SetParent가 한 번도 호출되지 않은 Entity (어느 목록에도 없음)
+			return;
+		}
+
+		if (hierarchy.prevSibling.IsValid())
+		{
+			registry->GetComponent<HierarchyComponent>(hierarchy.prevSibling)->nextSibling = hierarchy.nextSibling;
+		}
+		else
+		{
+			*first = hierarchy.nextSibling;
+		}
+
+		if (hierarchy.nextSibling.IsValid())
+		{
+			registry->GetComponent<HierarchyComponent>(hierarchy.nextSibling)->prevSibling = hierarchy.prevSibling;
+		}
+		else
+		{
+			*last = hierarchy.prevSibling;
+		}
+
+		--(*count);
+		hierarchy.parent = Entity::Invalid();
+		hierarchy.prevSibling = Entity::Invalid();
+		hierarchy.nextSibling = Entity::Invalid();
+	}
+
+	void TransformSystem::UpdateSubtreeDepth(Entity entity, HierarchyComponent& hierarchy, Core::uint32 depth)
+	{
+		Registry* registry = GetRegistry();
+
+		hierarchy.depth = depth;
+
+		// 링크를 따라 전위 순회 (스택 없이 부모로 되돌아감)
+		Entity current = hierarchy.firstChild;
+		while (current.IsValid())
+		{
+			auto* currentHierarchy = registry->GetComponent<HierarchyComponent>(current);
+			currentHierarchy->depth = registry->GetComponent<HierarchyComponent>(currentHierarchy->parent)->depth + 1;
+
+			if (currentHierarchy->firstChild.IsValid())
+			{
+				current = currentHierarchy->firstChild;
+				continue;
+			}
+
+			// 다음 형제가 있는 조상까지 올라감 (entity에 도달하면 종료)
+			while (current != entity)
+			{
+				const auto* node = registry->GetComponent<HierarchyComponent>(current);
+				if (node->nextSibling.IsValid())
+				{
+					current = node->nextSibling;
+					break;
+				}
+				current = node->parent;
+			}
+
+			if (current == entity)
+			{
+				break;
+			}
+		}
+	}
+
+	void TransformSystem::OnHierarchyRemoved(Entity entity)
+	{
+		Registry* registry = GetRegistry();
+		auto* hierarchy = registry->GetComponent<HierarchyComponent>(entity);
+
+		// 자식들은 Root로 승격 (World 행렬은 다음 Update에서 Local 기준으로 다시 계산)
+		Entity child = hierarchy->firstChild;
+		while (child.IsValid())
+		{
+			auto* childHierarchy = registry->GetComponent<HierarchyComponent>(child);
+			const Entity next = childHierarchy->nextSibling;
+
+			childHierarchy->parent = Entity::Invalid();
+			childHierarchy->prevSibling = Entity::Invalid();
+			childHierarchy->nextSibling = Entity::Invalid();
+			LinkEntity(child, *childHierarchy, Entity::Invalid());
+			UpdateSubtreeDepth(child, *childHierarchy, 0);
+
+			if (auto* childTransform = registry->GetComponent<TransformComponent>(child))
+			{
+				childTransform->worldDirty = true;
+			}
+
+			child = next;
+		}
+
+		hierarchy->firstChild = Entity::Invalid();
+		hierarchy->lastChild = Entity::Invalid();
+		hierarchy->childCount = 0;
+
+		UnlinkEntity(entity, *hierarchy);
+		mHierarchyDirty = true;
+	}
+
+	void TransformSystem::HierarchyRemoveHook(void* context, Entity entity)
+	{
+		static_cast<TransformSystem*>(context)->OnHierarchyRemoved(entity);
 	}
 
 	void TransformSystem::UpdateLocalMatrix(TransformComponent& transform)
@@ -532,116 +751,361 @@ namespace ECS
 		}
 	}
 
-	void TransformSystem::UpdateHierarchy(Entity entity, const Math::Matrix4x4& parentWorldMatrix)
+	void TransformSystem::UpdateWorldInvTranspose(TransformComponent& transform, bool uniformWorldScale)
 	{
-		Registry* registry = GetRegistry();
-
-		auto* transform = registry->GetComponent<TransformComponent>(entity);
-		if (!transform)
+		if (uniformWorldScale)
 		{
+			// 균등 스케일: 회전 부분만으로 충분하므로 역전치 불필요 (셰이더에서 정규화)
+			transform.worldInvTranspose = transform.worldMatrix;
 			return;
 		}
 
-		// dirty 아닌 서브트리는 스킵
-		if (!transform->localDirty && !transform->worldDirty)
+		// 비균등 스케일: 역전치 계산
+		Math::InverseTransposeBatch(&transform.worldMatrix, &transform.worldInvTranspose, 1);
+	}
+
+	void TransformSystem::RebuildFlatHierarchy()
+	{
+		Registry* registry = GetRegistry();
+		FlatHierarchy& flat = mFlatHierarchy;
+
+		flat.entities.clear();
+		flat.parentIndices.clear();
+		flat.batches.clear();
+		flat.levels.clear();
+
+		std::vector<FlatRange> subtreeLevels;
+		Core::uint32 batchBegin = 0;
+
+		Entity root = mFirstRoot;
+		while (root.IsValid())
 		{
-			// 자식들도 dirty 아니면 전체 스킵
-			const auto* hierarchy = registry->GetComponent<HierarchyComponent>(entity);
-			if (hierarchy)
+			// Root 서브트리 하나를 연속 구간에 BFS로 배치 (배열 끝부분이 BFS 큐)
+			const Core::uint32 subtreeBegin = static_cast<Core::uint32>(flat.entities.size());
+			flat.entities.push_back(root);
+			flat.parentIndices.push_back(INVALID_FLAT_INDEX);
+
+			subtreeLevels.clear();
+			Core::uint32 levelBegin = subtreeBegin;
+			Core::uint32 levelDepth = 0;
+
+			for (Core::uint32 index = subtreeBegin; index < static_cast<Core::uint32>(flat.entities.size()); ++index)
 			{
-				bool anyChildDirty = false;
-				for (Entity child : hierarchy->children)
+				const auto* hierarchy = registry->GetComponent<HierarchyComponent>(flat.entities[index]);
+
+				// BFS 순서에서 depth가 바뀌는 지점이 레벨 경계
+				if (hierarchy->depth != levelDepth)
 				{
-					auto* childTransform = registry->GetComponent<TransformComponent>(child);
-					if (childTransform && (childTransform->localDirty || childTransform->worldDirty))
-					{
-						anyChildDirty = true;
-						break;
-					}
+					CORE_ASSERT(hierarchy->depth == levelDepth + 1, "Hierarchy depth is inconsistent");
+					subtreeLevels.push_back({ levelBegin, index });
+					levelBegin = index;
+					levelDepth = hierarchy->depth;
 				}
 
-				if (!anyChildDirty)
+				for (Entity child = hierarchy->firstChild; child.IsValid(); child = registry->GetComponent<HierarchyComponent>(child)->nextSibling)
 				{
-					return;  // 이 서브트리 전체 스킵
+					flat.entities.push_back(child);
+					flat.parentIndices.push_back(index);
 				}
 			}
-			else
+			subtreeLevels.push_back({ levelBegin, static_cast<Core::uint32>(flat.entities.size()) });
+			root = registry->GetComponent<HierarchyComponent>(root)->nextSibling;
+
+			// 작업 분할: 큰 서브트리는 레벨 단위, 작은 서브트리는 묶음 단위
+			const Core::uint32 subtreeEnd = static_cast<Core::uint32>(flat.entities.size());
+			if (subtreeEnd - subtreeBegin >= LARGE_SUBTREE_SIZE)
 			{
-				return;  // 자식 없고 dirty 아니면 스킵
+				if (batchBegin < subtreeBegin)
+				{
+					flat.batches.push_back({ batchBegin, subtreeBegin });
+				}
+				flat.levels.insert(flat.levels.end(), subtreeLevels.begin(), subtreeLevels.end());
+				batchBegin = subtreeEnd;
+			}
+			else if (subtreeEnd - batchBegin >= HIERARCHY_BATCH_SIZE)
+			{
+				flat.batches.push_back({ batchBegin, subtreeEnd });
+				batchBegin = subtreeEnd;
 			}
 		}
 
-		// Local 업데이트
-		UpdateLocalMatrix(*transform);
-
-		// World 업데이트
-		if (transform->worldDirty)
+		const Core::uint32 count = static_cast<Core::uint32>(flat.entities.size());
+		if (batchBegin < count)
 		{
-			transform->worldMatrix = transform->localMatrix * parentWorldMatrix;
-			transform->worldDirty = false;
+			flat.batches.push_back({ batchBegin, count });
 		}
 
-		// 자식 처리
-		const auto* hierarchy = registry->GetComponent<HierarchyComponent>(entity);
-		if (hierarchy)
+		flat.localMatrices.resize(count);
+		flat.worldMatrices.resize(count);
+		flat.transforms.resize(count);
+		flat.dirtyFlags.resize(count);
+		flat.uniformFlags.resize(count);
+		flat.inverseTransposes.resize(count);
+		flat.composePositions.resize(count);
+		flat.composeRotations.resize(count);
+		flat.composeScales.resize(count);
+		flat.composedMatrices.resize(count);
+		flat.composeIndices.resize(count);
+
+		SyncFlatWorldMatrices();
+
+		mHierarchyDirty = false;
+		mHierarchyBuildTick = registry->GetChangeTick();
+	}
+
+	void TransformSystem::SyncFlatWorldMatrices()
+	{
+		Registry* registry = GetRegistry();
+		FlatHierarchy& flat = mFlatHierarchy;
+
+		for (size_t index = 0; index < flat.entities.size(); ++index)
 		{
-			for (Entity child : hierarchy->children)
+			const auto* transform = registry->GetComponent<TransformComponent>(flat.entities[index]);
+			flat.worldMatrices[index] = transform ? transform->worldMatrix : TransformMatrix::Identity();
+		}
+
+		mFlatWorldStale = false;
+	}
+
+	void TransformSystem::UpdateFlatHierarchy()
+	{
+		Registry* registry = GetRegistry();
+		const FlatHierarchy& flat = mFlatHierarchy;
+		const Core::uint32 count = static_cast<Core::uint32>(flat.entities.size());
+
+		// 1. 작은 서브트리 묶음 (묶음끼리는 서로 독립적이므로 묶음 하나를 Job 하나로 처리)
+		Core::Jobs::ParallelFor(static_cast<Core::uint32>(flat.batches.size()), 1, [this](Core::uint32 batchIndex)
 			{
-				if (!registry->IsEntityValid(child))
+				const FlatRange& batch = mFlatHierarchy.batches[batchIndex];
+				UpdateFlatRange(batch.begin, batch.end);
+			});
+
+		// 2. 큰 서브트리 (레벨 순서대로, 같은 레벨의 노드는 부모가 모두 이전 레벨에 있으므로 분할 처리)
+		for (const FlatRange& level : flat.levels)
+		{
+			const Core::uint32 chunkCount = (level.end - level.begin + HIERARCHY_GRAIN_SIZE - 1) / HIERARCHY_GRAIN_SIZE;
+			Core::Jobs::ParallelFor(chunkCount, 1, [this, &level](Core::uint32 chunkIndex)
 				{
-					continue;
-				}
+					const Core::uint32 begin = level.begin + chunkIndex * HIERARCHY_GRAIN_SIZE;
+					UpdateFlatRange(begin, std::min(begin + HIERARCHY_GRAIN_SIZE, level.end));
+				});
+		}
 
-				// 자식의 worldDirty 설정 (부모가 업데이트되었으므로)
-				auto* childTransform = registry->GetComponent<TransformComponent>(child);
-				if (childTransform)
+		// 3. 결과를 Component에 기록
+		Core::Jobs::ParallelFor(count, HIERARCHY_GRAIN_SIZE, [this, registry](Core::uint32 index)
+			{
+				const FlatHierarchy& flat = mFlatHierarchy;
+				TransformComponent* transform = flat.transforms[index];
+				if (!flat.dirtyFlags[index] || !transform)
 				{
-					childTransform->worldDirty = true;
+					return;
 				}
 
-				// 재귀 호출
-				UpdateHierarchy(child, transform->worldMatrix);
-			}
-		}
+				transform->worldMatrix = flat.worldMatrices[index];
+				transform->worldInvTranspose = flat.uniformFlags[index]
+					? flat.worldMatrices[index]
+					: flat.inverseTransposes[index];
+				transform->worldDirty = false;
+				registry->MarkChanged<TransformComponent>(flat.entities[index]);
+			});
 	}
 
-	void TransformSystem::UpdateStandaloneEntities()
+	void TransformSystem::UpdateFlatRange(Core::uint32 begin, Core::uint32 end)
 	{
 		Registry* registry = GetRegistry();
+		FlatHierarchy& flat = mFlatHierarchy;
 
-		auto view = TransformOnlyArchetype::CreateView(*registry);
-		for (Entity entity : view)
+		// 1. dirty 전파 + Local 재계산 대상 수집 (부모가 앞에 있으므로 부모의 dirty 여부는 이미 결정됨)
+		Core::uint32 composeCount = 0;
+		for (Core::uint32 index = begin; index < end; ++index)
 		{
-			// HierarchyComponent가 있으면 이미 계층 구조에서 처리됨
-			if (registry->HasComponent<HierarchyComponent>(entity))
+			TransformComponent* transform = registry->GetComponent<TransformComponent>(flat.entities[index]);
+			flat.transforms[index] = transform;
+
+			const Core::uint32 parentIndex = flat.parentIndices[index];
+			const bool hasParent = (parentIndex != INVALID_FLAT_INDEX);
+			const bool parentDirty = hasParent && flat.dirtyFlags[parentIndex];
+			const bool parentUniform = !hasParent || flat.uniformFlags[parentIndex];
+
+			if (!transform)
 			{
+				// Transform 없는 노드는 항등 변환으로 취급 (자식에게 부모 World 행렬을 그대로 전달)
+				flat.localMatrices[index] = TransformMatrix::Identity();
+				flat.dirtyFlags[index] = parentDirty;
+				flat.uniformFlags[index] = parentUniform;
 				continue;
 			}
 
-			auto* transform = registry->GetComponent<TransformComponent>(entity);
-			if (!transform)
+			const bool dirty = transform->localDirty || transform->worldDirty || parentDirty;
+			flat.dirtyFlags[index] = dirty;
+			flat.uniformFlags[index] = parentUniform && Math::IsUniformScale(transform->scale);
+
+			if (transform->localDirty)
+			{
+				const Core::uint32 slot = begin + composeCount++;
+				flat.composePositions[slot] = transform->position;
+				flat.composeRotations[slot] = transform->rotation;
+				flat.composeScales[slot] = transform->scale;
+				flat.composeIndices[slot] = index;
+			}
+			else if (dirty)
+			{
+				flat.localMatrices[index] = transform->localMatrix;
+			}
+		}
+
+		// 2. Local 행렬 일괄 합성 (SIMD 배치 커널)
+		if (composeCount > 0)
+		{
+			Math::ComposeTRSBatch(
+				&flat.composePositions[begin],
+				&flat.composeRotations[begin],
+				&flat.composeScales[begin],
+				&flat.composedMatrices[begin],
+				composeCount
+			);
+
+			for (Core::uint32 slot = begin; slot < begin + composeCount; ++slot)
 			{
+				const Core::uint32 index = flat.composeIndices[slot];
+				TransformComponent* transform = flat.transforms[index];
+				transform->localMatrix = flat.composedMatrices[slot];
+				transform->localDirty = false;
+				flat.localMatrices[index] = flat.composedMatrices[slot];
+			}
+		}
+
+		// 3. World 계산 (연속된 dirty 자식 노드 구간마다 배치 곱셈)
+		const TransformMatrix* localMatrices = flat.localMatrices.data();
+		TransformMatrix* worldMatrices = flat.worldMatrices.data();
+		const Core::uint32* parentIndices = flat.parentIndices.data();
+
+		Core::uint32 index = begin;
+		while (index < end)
+		{
+			if (!flat.dirtyFlags[index])
+			{
+				++index;
 				continue;
 			}
 
-			// dirty 아니면 스킵
-			if (!transform->localDirty && !transform->worldDirty)
+			if (parentIndices[index] == INVALID_FLAT_INDEX)
 			{
+				worldMatrices[index] = localMatrices[index];
+				++index;
 				continue;
 			}
 
-			// Local 업데이트
-			UpdateLocalMatrix(*transform);
+			Core::uint32 runEnd = index + 1;
+			while (runEnd < end && flat.dirtyFlags[runEnd] && parentIndices[runEnd] != INVALID_FLAT_INDEX)
+			{
+				++runEnd;
+			}
+
+			// 부모는 항상 앞쪽 인덱스이므로 같은 호출 안에서 갱신된 부모 World 행렬을 읽음
+			Math::MultiplyMatrixBatchIndexed(
+				&localMatrices[index],
+				worldMatrices,
+				&parentIndices[index],
+				&worldMatrices[index],
+				runEnd - index
+			);
+			index = runEnd;
+		}
 
-			// World = Local (계층 없음)
-			if (transform->worldDirty)
+		// 4. 비균등 스케일 dirty 노드의 World 역전치 (균등 스케일이면 worldMatrix를 그대로 쓰므로 생략)
+		index = begin;
+		while (index < end)
+		{
+			if (!flat.dirtyFlags[index] || flat.uniformFlags[index])
 			{
-				transform->worldMatrix = transform->localMatrix;
-				transform->worldDirty = false;
+				++index;
+				continue;
 			}
+
+			Core::uint32 runEnd = index + 1;
+			while (runEnd < end && flat.dirtyFlags[runEnd] && !flat.uniformFlags[runEnd])
+			{
+				++runEnd;
+			}
+
+			Math::InverseTransposeBatch(&worldMatrices[index], &flat.inverseTransposes[index], runEnd - index);
+			index = runEnd;
 		}
 	}
 
+	void TransformSystem::UpdateStandaloneEntities()
+	{
+		Registry* registry = GetRegistry();
+
+		// Entity마다 독립적이므로 병렬 처리
+		auto view = TransformOnlyArchetype::CreateView(*registry);
+		view.ParallelEach([this, registry](Entity entity, TransformComponent& transform)
+			{
+				// HierarchyComponent가 있으면 이미 계층 구조에서 처리됨
+				if (registry->HasComponent<HierarchyComponent>(entity))
+				{
+					return;
+				}
+
+				// dirty 아니면 스킵
+				if (!transform.localDirty && !transform.worldDirty)
+				{
+					return;
+				}
+
+				// Local 업데이트
+				UpdateLocalMatrix(transform);
+
+				// World = Local (계층 없음)
+				if (transform.worldDirty)
+				{
+					transform.worldMatrix = transform.localMatrix;
+					UpdateWorldInvTranspose(transform, Math::IsUniformScale(transform.scale));
+					transform.worldDirty = false;
+					registry->MarkChanged<TransformComponent>(entity);
+				}
+			});
+	}
+
+	void TransformSystem::UpdateWorldBounds(BoundsComponent& bounds, const TransformComponent& transform)
+	{
+		bounds.worldBounds = Math::TransformAABB(bounds.localBounds, transform.worldMatrix);
+		bounds.worldSphere = Math::TransformSphere(bounds.localSphere, transform.worldMatrix);
+	}
+
+	void TransformSystem::UpdateBoundedEntities()
+	{
+		Registry* registry = GetRegistry();
+		const Core::uint32 sinceTick = mBoundsTick;
+
+		// 이번 갱신 중의 MarkChanged는 이 틱 이하이므로 다음 프레임에 다시 잡히지 않음
+		// (BoundsComponent 쓰기는 이 System만 하므로 의존 그래프상 동시에 쓰는 System이 없음)
+		const bool firstUpdate = (sinceTick == 0);
+		if (!firstUpdate
+			&& !registry->HasChangesSince<TransformComponent>(sinceTick)
+			&& !registry->HasChangesSince<BoundsComponent>(sinceTick))
+		{
+			return;
+		}
+
+		auto view = BoundedArchetype::CreateView(*registry);
+		view.ParallelEach([registry, sinceTick, firstUpdate](Entity entity, TransformComponent& transform, BoundsComponent& bounds)
+			{
+				if (!firstUpdate
+					&& !registry->IsChanged<TransformComponent>(entity, sinceTick)
+					&& !registry->IsChanged<BoundsComponent>(entity, sinceTick))
+				{
+					return;
+				}
+
+				UpdateWorldBounds(bounds, transform);
+				registry->MarkChanged<BoundsComponent>(entity);
+			});
+
+		mBoundsTick = registry->GetChangeTick();
+	}
+
 	void TransformSystem::MarkLocalDirty(TransformComponent& transform)
 	{
 		transform.localDirty = true;
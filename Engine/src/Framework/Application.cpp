@@ -8,6 +8,7 @@
 #include "Framework/DebugUI/DebugVisualizationPanel.h"
 
 // Core
+#include "Core/Jobs/JobSystem.h"
 #include "Core/Logging/LogMacros.h"
 #include "Core/Timing/ScopedTimer.h"
 
@@ -87,6 +88,12 @@ namespace Framework
 
 		LOG_INFO("High-precision timer initialized");
 
+		// 0. Job System (ECS 병렬 순회용)
+		if (!Core::Jobs::JobSystem::IsValid())
+		{
+			Core::Jobs::JobSystem::Create(mDesc.workerThreadCount);
+		}
+
 		// 1. 윈도우 생성
 		Platform::WindowDesc windowDesc;
 		windowDesc.title = mDesc.windowTitle;
@@ -199,6 +206,8 @@ namespace Framework
 		mDevice.reset();
 		mWindow.reset();
 
+		Core::Jobs::JobSystem::Destroy();
+
 		mIsInitialized = false;
 	}
 
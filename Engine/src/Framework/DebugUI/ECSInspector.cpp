@@ -245,11 +245,14 @@ namespace Framework
 			return;
 		}
 
+		bool changed = false;
+
 		// Position
 		float pos[3] = { transform->position.x, transform->position.y, transform->position.z };
 		if (ImGui::DragFloat3("Position", pos, 0.1f))
 		{
 			transform->position = Math::Vector3(pos[0], pos[1], pos[2]);
+			changed = true;
 		}
 
 		// Rotation (Euler)
@@ -268,6 +271,7 @@ namespace Framework
 					Math::DegToRad(rot[2])
 				)
 			);
+			changed = true;
 		}
 
 		// Scale
@@ -275,6 +279,15 @@ namespace Framework
 		if (ImGui::DragFloat3("Scale", scale, 0.01f, 0.01f, 100.0f))
 		{
 			transform->scale = Math::Vector3(scale[0], scale[1], scale[2]);
+			changed = true;
+		}
+
+		// 행렬 재계산 요청 및 변경 틱 기록
+		if (changed)
+		{
+			transform->localDirty = true;
+			transform->worldDirty = true;
+			registry->MarkChanged<ECS::TransformComponent>(entity);
 		}
 	}
 
@@ -347,19 +360,29 @@ namespace Framework
 			return;
 		}
 
+		bool changed = false;
+
 		float dir[3] = { light->direction.x, light->direction.y, light->direction.z };
 		if (ImGui::DragFloat3("Direction", dir, 0.01f, -1.0f, 1.0f))
 		{
 			light->direction = Math::Normalize(Math::Vector3(dir[0], dir[1], dir[2]));
+			changed = true;
 		}
 
 		float color[3] = { light->color.x, light->color.y, light->color.z };
 		if (ImGui::ColorEdit3("Color", color))
 		{
 			light->color = Math::Vector3(color[0], color[1], color[2]);
+			changed = true;
 		}
 
-		ImGui::SliderFloat("Intensity", &light->intensity, 0.0f, 10.0f);
+		changed |= ImGui::SliderFloat("Intensity", &light->intensity, 0.0f, 10.0f);
+
+		// 변경 틱 기록 (RenderSystem 조명 캐시 갱신)
+		if (changed)
+		{
+			registry->MarkChanged<ECS::DirectionalLightComponent>(entity);
+		}
 	}
 
 	void ECSInspector::RenderPointLightComponent(ECS::Registry* registry, ECS::Entity entity)
@@ -386,22 +409,31 @@ namespace Framework
 			return;
 		}
 
+		bool changed = false;
+
 		float color[3] = { light->color.x, light->color.y, light->color.z };
 		if (ImGui::ColorEdit3("Color", color))
 		{
 			light->color = Math::Vector3(color[0], color[1], color[2]);
+			changed = true;
 		}
 
-		ImGui::SliderFloat("Intensity", &light->intensity, 0.0f, 20.0f);
-		ImGui::SliderFloat("Range", &light->range, 0.1f, 100.0f);
+		changed |= ImGui::SliderFloat("Intensity", &light->intensity, 0.0f, 20.0f);
+		changed |= ImGui::SliderFloat("Range", &light->range, 0.1f, 100.0f);
 
 		if (ImGui::TreeNode("Attenuation"))
 		{
-			ImGui::DragFloat("Constant", &light->constant, 0.01f, 0.0f, 2.0f);
-			ImGui::DragFloat("Linear", &light->linear, 0.001f, 0.0f, 1.0f);
-			ImGui::DragFloat("Quadratic", &light->quadratic, 0.0001f, 0.0f, 0.1f);
+			changed |= ImGui::DragFloat("Constant", &light->constant, 0.01f, 0.0f, 2.0f);
+			changed |= ImGui::DragFloat("Linear", &light->linear, 0.001f, 0.0f, 1.0f);
+			changed |= ImGui::DragFloat("Quadratic", &light->quadratic, 0.0001f, 0.0f, 0.1f);
 			ImGui::TreePop();
 		}
+
+		// 변경 틱 기록 (RenderSystem 조명 캐시 갱신)
+		if (changed)
+		{
+			registry->MarkChanged<ECS::PointLightComponent>(entity);
+		}
 	}
 
 	void ECSInspector::RenderMeshComponent(ECS::Registry* registry, ECS::Entity entity)
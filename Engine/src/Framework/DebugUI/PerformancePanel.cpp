@@ -30,6 +30,14 @@ namespace Framework
 		mAverageFrameTime = sum / static_cast<Core::float32>(HISTORY_SIZE);
 	}
 
+	void PerformancePanel::SetRenderStats(Core::uint32 renderableCount, Core::uint32 visibleCount, Core::uint32 culledCount)
+	{
+		mRenderableCount = renderableCount;
+		mVisibleCount = visibleCount;
+		mCulledCount = culledCount;
+		mHasRenderStats = true;
+	}
+
 	void PerformancePanel::Render(ECS::Registry* registry)
 	{
 		if (!mIsVisible)
@@ -90,6 +98,16 @@ namespace Framework
 		{
 			ImGui::TextDisabled("No Registry connected");
 		}
+
+		if (mHasRenderStats)
+		{
+			const Core::float32 culledPercent = (mRenderableCount > 0)
+				? 100.0f * static_cast<Core::float32>(mCulledCount) / static_cast<Core::float32>(mRenderableCount)
+				: 0.0f;
+
+			ImGui::Text("Renderables: %u", mRenderableCount);
+			ImGui::Text("Visible: %u  Culled: %u (%.1f%%)", mVisibleCount, mCulledCount, culledPercent);
+		}
 	}
 
 } // namespace Framework
@@ -98,6 +98,18 @@ namespace Framework
 		const std::wstring& vertexShader,
 		const std::wstring& pixelShader
 	)
+	{
+		Graphics::MaterialDesc desc;
+		desc.vertexShaderPath = vertexShader.c_str();
+		desc.pixelShaderPath = pixelShader.c_str();
+
+		return CreateMaterial(name, desc);
+	}
+
+	ResourceId ResourceManager::CreateMaterial(
+		const std::string& name,
+		const Graphics::MaterialDesc& desc
+	)
 	{
 		// 이름을 64비트 해시로 변환
 		ResourceId id;
@@ -111,11 +123,7 @@ namespace Framework
 			return id;
 		}
 
-		// 새 머티리얼 생성
-		Graphics::MaterialDesc desc;
-		desc.vertexShaderPath = vertexShader.c_str();
-		desc.pixelShaderPath = pixelShader.c_str();
-
+		// 새 머티리얼 생성 (셰이더 경로는 Material이 복사해 보관)
 		auto material = std::make_shared<Graphics::Material>(desc);
 		mMaterials[id] = material;
 		mMaterialNames[id] = name;
@@ -151,6 +159,12 @@ namespace Framework
 		auto it = mMaterials.find(id);
 		if (it != mMaterials.end())
 		{
+			// 렌더러의 Material 상수 슬롯 반환 (주소 기반이므로 제거 전에 호출)
+			if (mRenderer)
+			{
+				mRenderer->ReleaseMaterialConstants(*it->second);
+			}
+
 			mMaterials.erase(it);
 			mMaterialNames.erase(id);
 
@@ -2,6 +2,9 @@
 #include "Framework/Scene/Scene.h"
 #include "Framework/Scene/GameObject.h"
 #include "Core/Logging/LogMacros.h"
+#include "Graphics/Material.h"
+#include "Graphics/RenderQueue.h"
+#include "Math/MathBatch.h"
 #include "Math/MathTypes.h"
 #include "Math/MathUtils.h"
 
@@ -156,16 +159,43 @@ namespace Framework
 			item.worldMatrix = world;
 			item.mvpMatrix = Math::MatrixTranspose(mvp);  // HLSL용 전치
 
-			// TODO: 향후 머티리얼 속성에 따라 분류
-			// if (material->IsTransparent())
-			//     outFrameData.transparentItems.push_back(item);
-			// else
-			outFrameData.opaqueItems.push_back(item);
+			// 노멀 행렬: 균등 스케일이면 World 그대로 (셰이더에서 정규화), 비균등이면 역전치
+			// (GameObject는 부모가 없으므로 자신의 스케일만 확인하면 됨, TransformSystem과 같은 규칙)
+			if (Math::IsUniformScale(gameObject->GetScale()))
+			{
+				item.normalMatrix = world;
+			}
+			else
+			{
+				Math::InverseTransposeBatch(&world, &item.normalMatrix, 1);
+			}
+
+			// 정렬 키 (GameObject 경로는 리소스 ID가 없으므로 주소를 식별자로 사용)
+			const Core::float32 viewDepth = world.m[3][0] * view.m[0][2]
+				+ world.m[3][1] * view.m[1][2]
+				+ world.m[3][2] * view.m[2][2]
+				+ view.m[3][2];
+			const Core::uint64 materialId = reinterpret_cast<Core::uint64>(item.material);
+			const Core::uint64 meshId = reinterpret_cast<Core::uint64>(item.mesh);
+
+			if (material->IsTransparent())
+			{
+				item.sortKey = Graphics::MakeTransparentSortKey(
+					Graphics::RenderLayer::Transparent, material->GetHash(), materialId, meshId, viewDepth);
+				outFrameData.transparentItems.push_back(item);
+			}
+			else
+			{
+				item.sortKey = Graphics::MakeOpaqueSortKey(
+					Graphics::RenderLayer::Opaque, material->GetHash(), materialId, meshId, viewDepth);
+				outFrameData.opaqueItems.push_back(item);
+			}
 		}
 
-		// TODO: 향후 정렬 추가
-		// - 불투명: 앞에서 뒤로 (Early-Z 최적화)
-		// - 투명: 뒤에서 앞으로 (올바른 블렌딩)
+		// 불투명: 상태 순 + 앞에서 뒤로 (Early-Z), 투명: 뒤에서 앞으로 (올바른 블렌딩)
+		Graphics::RenderQueueSorter sorter;
+		sorter.Sort(outFrameData.opaqueItems);
+		sorter.Sort(outFrameData.transparentItems);
 	}
 
 } // namespace Framework
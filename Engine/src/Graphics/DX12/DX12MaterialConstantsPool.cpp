@@ -0,0 +1,128 @@
+﻿#include "pch.h"
+#include "Graphics/DX12/DX12MaterialConstantsPool.h"
+#include "Graphics/DX12/DX12ConstantBuffer.h"
+#include "Graphics/Material.h"
+
+namespace Graphics
+{
+	DX12MaterialConstantsPool::DX12MaterialConstantsPool() = default;
+
+	DX12MaterialConstantsPool::~DX12MaterialConstantsPool()
+	{
+		Shutdown();
+	}
+
+	bool DX12MaterialConstantsPool::Initialize(ID3D12Device* device)
+	{
+		if (!device)
+		{
+			LOG_ERROR("[DX12MaterialConstantsPool] Device is nullptr");
+			return false;
+		}
+
+		mDevice = device;
+
+		LOG_INFO("[DX12MaterialConstantsPool] Initialized (%u slots per page)", SLOTS_PER_PAGE);
+		return true;
+	}
+
+	void DX12MaterialConstantsPool::Shutdown()
+	{
+		mPages.clear();
+		mUploadedVersions.clear();
+		mFreeSlots.clear();
+		mSlots.clear();
+
+		mUploadCount = 0;
+		mDevice = nullptr;
+	}
+
+	D3D12_GPU_VIRTUAL_ADDRESS DX12MaterialConstantsPool::GetGPUAddress(const Material& material, Core::uint32 frameIndex)
+	{
+		CORE_ASSERT(frameIndex < FRAME_BUFFER_COUNT, "Frame index out of range");
+
+		Core::uint32 slot = INVALID_SLOT;
+
+		auto it = mSlots.find(&material);
+		if (it != mSlots.end())
+		{
+			slot = it->second;
+		}
+		else
+		{
+			slot = AcquireSlot();
+			if (slot == INVALID_SLOT)
+			{
+				return 0;
+			}
+
+			mSlots.emplace(&material, slot);
+		}
+
+		DX12ConstantBuffer* page = mPages[slot / SLOTS_PER_PAGE].get();
+		const Core::uint32 pageSlot = slot % SLOTS_PER_PAGE;
+
+		// 이 프레임 복사본에 올린 뒤로 Material 상수가 바뀐 경우만 업로드
+		Core::uint64& uploadedVersion = mUploadedVersions[slot][frameIndex];
+		if (uploadedVersion != material.GetConstantsVersion())
+		{
+			const MaterialConstants constants = material.GetConstants();
+			page->UpdateAtOffset(frameIndex, pageSlot, &constants, sizeof(MaterialConstants), SLOT_SIZE);
+
+			uploadedVersion = material.GetConstantsVersion();
+			++mUploadCount;
+		}
+
+		return page->GetGPUAddress(frameIndex) + static_cast<D3D12_GPU_VIRTUAL_ADDRESS>(SLOT_SIZE) * pageSlot;
+	}
+
+	void DX12MaterialConstantsPool::Release(const Material& material)
+	{
+		auto it = mSlots.find(&material);
+		if (it == mSlots.end())
+		{
+			return;
+		}
+
+		// 프레임 복사본은 해당 프레임 Fence 대기 후에만 기록되므로 바로 재사용 가능
+		mUploadedVersions[it->second].fill(0);
+		mFreeSlots.push_back(it->second);
+		mSlots.erase(it);
+	}
+
+	Core::uint32 DX12MaterialConstantsPool::AcquireSlot()
+	{
+		if (!mFreeSlots.empty())
+		{
+			const Core::uint32 slot = mFreeSlots.back();
+			mFreeSlots.pop_back();
+			return slot;
+		}
+
+		if (!mDevice)
+		{
+			CORE_ASSERT(false, "DX12MaterialConstantsPool is not initialized");
+			return INVALID_SLOT;
+		}
+
+		// 새 페이지 생성 후 첫 슬롯을 제외한 나머지를 Free 목록에 추가
+		auto page = std::make_unique<DX12ConstantBuffer>();
+		if (!page->Initialize(mDevice, static_cast<size_t>(SLOT_SIZE) * SLOTS_PER_PAGE, FRAME_BUFFER_COUNT))
+		{
+			LOG_ERROR("[DX12MaterialConstantsPool] Failed to create page");
+			return INVALID_SLOT;
+		}
+
+		const Core::uint32 firstSlot = static_cast<Core::uint32>(mPages.size()) * SLOTS_PER_PAGE;
+		mPages.push_back(std::move(page));
+		mUploadedVersions.resize(static_cast<size_t>(firstSlot) + SLOTS_PER_PAGE, {});
+
+		for (Core::uint32 i = SLOTS_PER_PAGE - 1; i > 0; --i)
+		{
+			mFreeSlots.push_back(firstSlot + i);
+		}
+
+		return firstSlot;
+	}
+
+} // namespace Graphics
@@ -0,0 +1,75 @@
+﻿#include "pch.h"
+#include "Graphics/DX12/DX12RenderBackend.h"
+#include "Graphics/Mesh.h"
+
+namespace Graphics
+{
+	void DX12RenderBackend::Execute(ID3D12GraphicsCommandList* commandList, const RenderCommandStream& stream)
+	{
+		CORE_ASSERT(commandList, "Command list is nullptr");
+
+		for (const RenderCommand& command : stream.GetCommands())
+		{
+			const UINT rootIndex = static_cast<UINT>(command.slot);
+
+			switch (command.type)
+			{
+			case RenderCommandType::SetPipelineState:
+				commandList->SetPipelineState(
+					static_cast<ID3D12PipelineState*>(const_cast<void*>(command.pipelineState))
+				);
+				break;
+
+			case RenderCommandType::SetConstantBuffer:
+				commandList->SetGraphicsRootConstantBufferView(rootIndex, command.gpuAddress);
+				break;
+
+			case RenderCommandType::SetShaderResource:
+				commandList->SetGraphicsRootShaderResourceView(rootIndex, command.gpuAddress);
+				break;
+
+			case RenderCommandType::SetDescriptorTable:
+			{
+				D3D12_GPU_DESCRIPTOR_HANDLE handle = {};
+				handle.ptr = command.descriptorHandle;
+				commandList->SetGraphicsRootDescriptorTable(rootIndex, handle);
+				break;
+			}
+
+			case RenderCommandType::SetMesh:
+				command.setMesh.mesh->Bind(commandList);
+				break;
+
+			case RenderCommandType::DrawIndexed:
+			{
+				const DrawIndexedArgs& args = command.drawIndexed;
+				commandList->DrawIndexedInstanced(
+					args.indexCount,
+					args.instanceCount,
+					args.startIndex,
+					args.baseVertex,
+					args.startInstance
+				);
+				break;
+			}
+
+			case RenderCommandType::DrawInstanced:
+			{
+				const DrawInstancedArgs& args = command.drawInstanced;
+				commandList->DrawInstanced(
+					args.vertexCount,
+					args.instanceCount,
+					args.startVertex,
+					args.startInstance
+				);
+				break;
+			}
+
+			default:
+				CORE_ASSERT(false, "Unknown render command type");
+				break;
+			}
+		}
+	}
+
+} // namespace Graphics
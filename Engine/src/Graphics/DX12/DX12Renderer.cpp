@@ -6,10 +6,13 @@
 #include "Graphics/DX12/DX12DepthStencilBuffer.h"
 #include "Graphics/DX12/DX12DescriptorHeap.h"
 #include "Graphics/DX12/DX12Device.h"
+#include "Graphics/DX12/DX12MaterialConstantsPool.h"
 #include "Graphics/DX12/DX12PipelineStateCache.h"
+#include "Graphics/DX12/DX12RenderBackend.h"
 #include "Graphics/DX12/DX12RootSignature.h"
 #include "Graphics/DX12/DX12ShaderCompiler.h"
 #include "Graphics/DX12/DX12SwapChain.h"
+#include "Graphics/DX12/DX12UploadAllocator.h"
 #include "Graphics/DebugDraw/DebugRenderer.h"
 #include "Graphics/Material.h"
 #include "Graphics/Mesh.h"
@@ -25,6 +28,83 @@ namespace Graphics
 	//	Math::Matrix4x4 MVP;
 	//};
 
+	/**
+	 * @brief 병렬 기록 청크 하나의 리소스 제공자
+	 *
+	 * 업로드 메모리는 청크 전용 할당자에서 잠금 없이 할당하고,
+	 * 상태를 바꾸는 PSO 캐시/Material 상수 풀 조회만 Renderer의 mEncodeMutex로 직렬화합니다.
+	 * (배치당 한 번 호출되므로 경합이 적음)
+	 */
+	class DX12Renderer::EncodeContext : public IRenderResourceProvider
+	{
+	public:
+		explicit EncodeContext(DX12Renderer& renderer)
+			: mRenderer(renderer)
+		{
+		}
+
+		bool Initialize(ID3D12Device* device)
+		{
+			return mUploadAllocator.Initialize(device);
+		}
+
+		DX12UploadAllocator& GetUploadAllocator() { return mUploadAllocator; }
+
+		const void* GetPipelineState(const Material& material, const Mesh& mesh) override
+		{
+			std::lock_guard<std::mutex> lock(mRenderer.mEncodeMutex);
+			return mRenderer.mPipelineStateCache->GetOrCreatePipelineState(
+				material,
+				mRenderer.mRootSignature->GetRootSignature(),
+				mesh.GetInputLayout()
+			);
+		}
+
+		bool SupportsInstancing(const Material& material) override
+		{
+			return material.SupportsInstancing();
+		}
+
+		MeshExtent GetMeshExtent(const Mesh& mesh) override
+		{
+			MeshExtent extent;
+			extent.vertexCount = static_cast<Core::uint32>(mesh.GetVertexCount());
+			extent.indexCount = mesh.HasIndexBuffer() ? static_cast<Core::uint32>(mesh.GetIndexCount()) : 0;
+			return extent;
+		}
+
+		Core::uint64 GetMaterialConstants(const Material& material) override
+		{
+			// Material 상수는 바뀐 경우에만 업로드되고, 나머지는 주소만 반환
+			std::lock_guard<std::mutex> lock(mRenderer.mEncodeMutex);
+			return mRenderer.mMaterialConstantsPool->GetGPUAddress(material, mRenderer.mCurrentFrameIndex);
+		}
+
+		Core::uint64 GetMaterialDescriptorTable(const Material& material) override
+		{
+			if (!material.HasAllocatedDescriptors())
+			{
+				return 0;
+			}
+
+			return material.GetDescriptorTableHandle(mRenderer.mSrvDescriptorHeap.get()).ptr;
+		}
+
+		UploadRegion AllocateUpload(size_t size) override
+		{
+			const DX12UploadAllocator::Allocation allocation = mUploadAllocator.Allocate(size);
+
+			UploadRegion region;
+			region.cpuAddress = allocation.cpuAddress;
+			region.gpuAddress = allocation.gpuAddress;
+			return region;
+		}
+
+	private:
+		DX12Renderer& mRenderer;
+		DX12UploadAllocator mUploadAllocator;
+	};
+
 	DX12Renderer::DX12Renderer()
 	{
 	}
@@ -85,23 +165,16 @@ namespace Graphics
 			return false;
 		}
 
-		// 4-1. MVP Constant Buffer (b0)
-		mObjectConstantBuffer = std::make_unique<DX12ConstantBuffer>();
-		if (!mObjectConstantBuffer->Initialize(
-			device->GetDevice(),
-			sizeof(ObjectConstants) * MAX_OBJECTS_PER_FRAME,
-			FRAME_BUFFER_COUNT
-		))
+		// 4-1. Upload Allocator - Object Constants (b0), Instance Buffer (t0, space1)
+		// 직렬 기록용 첫 번째 청크만 만들고, 나머지는 병렬 기록 시 필요한 만큼 생성
+		if (ReserveEncodeContexts(1) == 0)
 		{
 			return false;
 		}
 
-		mMaterialConstantBuffer = std::make_unique<DX12ConstantBuffer>();
-		if (!mMaterialConstantBuffer->Initialize(
-			device->GetDevice(),
-			sizeof(MaterialConstants),
-			FRAME_BUFFER_COUNT
-		))
+		// 4-2. Material Constants (b1) - Material별 영구 슬롯
+		mMaterialConstantsPool = std::make_unique<DX12MaterialConstantsPool>();
+		if (!mMaterialConstantsPool->Initialize(device->GetDevice()))
 		{
 			return false;
 		}
@@ -178,10 +251,10 @@ namespace Graphics
 
 	bool DX12Renderer::CreateDefaultRootSignature()
 	{
-		// Phase 3.3: 3개의 CBV + SRV Table + Sampler
-		CD3DX12_ROOT_PARAMETER1 rootParameters[4]{};
+		// Phase 3.3: 3개의 CBV + SRV Table + Sampler, 인스턴스 버퍼 SRV
+		CD3DX12_ROOT_PARAMETER1 rootParameters[5]{};
 
-		// CBV (b0) - Object Constants (worldMatrix, mvpMatrix)
+		// CBV (b0) - Object Constants (worldMatrix, mvpMatrix, normalMatrix)
 		rootParameters[0].InitAsConstantBufferView(
 			0,
 			0,
@@ -218,6 +291,15 @@ namespace Graphics
 			D3D12_SHADER_VISIBILITY_PIXEL
 		);
 
+		// SRV (t0, space1) - Instance Buffer (StructuredBuffer<InstanceData>)
+		// 배치마다 시작 원소 주소로 다시 설정하므로 SV_InstanceID가 배치 내 인덱스가 됨
+		rootParameters[4].InitAsShaderResourceView(
+			0,
+			1,
+			D3D12_ROOT_DESCRIPTOR_FLAG_NONE,
+			D3D12_SHADER_VISIBILITY_VERTEX
+		);
+
 		// Sampler
 		CD3DX12_STATIC_SAMPLER_DESC sampler(
 			0,
@@ -230,7 +312,7 @@ namespace Graphics
 		mRootSignature = std::make_unique<DX12RootSignature>();
 		return mRootSignature->Initialize(
 			mDevice->GetDevice(),
-			4,  // 4개의 Root Parameters
+			5,  // 5개의 Root Parameters
 			rootParameters,
 			1,
 			&sampler,
@@ -261,8 +343,9 @@ namespace Graphics
 
 		// Phase 3.3: Constant Buffers 정리
 		mLightingConstantBuffer.reset();
-		mMaterialConstantBuffer.reset();
-		mObjectConstantBuffer.reset();
+		mMaterialConstantsPool.reset();
+		mEncodeProviders.clear();
+		mEncodeContexts.clear();
 
 		mPipelineStateCache.reset();
 		mShaderCompiler.reset();
@@ -309,6 +392,13 @@ namespace Graphics
 		// GPU가 현재 백 버퍼 사용을 완료할 때까지 대기
 		mDevice->GetCommandQueue()->WaitForFenceValue(GetCurrentFrameFenceValue());
 
+		// GPU가 완료한 프레임의 Upload 페이지 회수
+		const Core::uint64 completedFenceValue = mDevice->GetCommandQueue()->GetCompletedFenceValue();
+		for (auto& context : mEncodeContexts)
+		{
+			context->GetUploadAllocator().BeginFrame(completedFenceValue);
+		}
+
 		// Command Context 리셋
 		auto* cmdContext = GetCurrentCommandContext();
 		if (!cmdContext)
@@ -334,15 +424,13 @@ namespace Graphics
 		);
 		cmdList->ResourceBarrier(1, &barrier);
 
-		mCurrentObjectCBIndex = 0;
-
 		return true;
 	}
 
 	void DX12Renderer::RenderScene(const FrameData& frameData)
 	{
 		// 필수 리소스 확인
-		bool cb = !mObjectConstantBuffer || !mMaterialConstantBuffer || !mLightingConstantBuffer;
+		bool cb = mEncodeContexts.empty() || !mMaterialConstantsPool || !mLightingConstantBuffer;
 		if (!mRootSignature || !mPipelineStateCache || cb || !mSrvDescriptorHeap)
 		{
 			LOG_ERROR("DX12Renderer: Required resources not set");
@@ -358,8 +446,9 @@ namespace Graphics
 		// Lighting Constant Buffer 업데이트
 		UpdateLightingBuffer(frameData);
 
-		// 렌더 아이템 그리기
+		// 렌더 아이템 그리기 (정렬 키 순서: 불투명 앞에서 뒤로, 투명 뒤에서 앞으로)
 		DrawRenderItems(frameData.opaqueItems);
+		DrawRenderItems(frameData.transparentItems);
 	}
 
 	void DX12Renderer::EndFrame()
@@ -387,6 +476,12 @@ namespace Graphics
 		ID3D12CommandList* cmdLists[] = { cmdList };
 		Core::uint64 fenceValue = mDevice->GetCommandQueue()->ExecuteCommandLists(1, cmdLists);
 		SetCurrentFrameFenceValue(fenceValue);
+
+		// 이번 프레임 Upload 페이지는 fenceValue 완료 후 재사용
+		for (auto& context : mEncodeContexts)
+		{
+			context->GetUploadAllocator().EndFrame(fenceValue);
+		}
 	}
 
 	void DX12Renderer::Present(bool vsync)
@@ -495,81 +590,49 @@ namespace Graphics
 		ID3D12DescriptorHeap* heaps[] = { mSrvDescriptorHeap->GetHeap() };
 		cmdList->SetDescriptorHeaps(1, heaps);
 
-		// 각 렌더 아이템 그리기
-		for (const auto& item : items)
-		{
-			if (!item.mesh || !item.material)
-			{
-				continue;
-			}
+		// Lighting Constants (b2): UpdateLightingBuffer()에서 갱신되며 모든 아이템이 공유하므로 청크마다 한 번만 설정
+		mCommandPreamble.Clear();
+		mCommandPreamble.SetConstantBuffer(RootSlot::Lighting, mLightingConstantBuffer->GetGPUAddress(mCurrentFrameIndex));
+
+		// 아이템 -> 렌더 명령 (배칭, 인스턴스 데이터 업로드, 중복 바인딩 제거)
+		// 아이템이 많으면 청크로 나눠 워커 스레드에서 동시에 기록
+		const Core::uint32 chunkCount = ReserveEncodeContexts(ParallelCommandEncoder::ComputeChunkCount(items.size()));
+		mCommandEncoder.Encode(
+			items,
+			std::span<IRenderResourceProvider* const>(mEncodeProviders.data(), chunkCount),
+			&mCommandPreamble
+		);
 
-			// 1. Pipeline State Object 설정
-			auto pso = mPipelineStateCache->GetOrCreatePipelineState(
-				*item.material,
-				mRootSignature->GetRootSignature(),
-				item.mesh->GetInputLayout()
-			);
+		// 렌더 명령 -> D3D12 커맨드 리스트 (청크 순서 = 그리기 순서)
+		for (Core::uint32 i = 0; i < mCommandEncoder.GetChunkCount(); ++i)
+		{
+			DX12RenderBackend::Execute(cmdList, mCommandEncoder.GetStream(i));
+		}
+	}
 
-			if (!pso)
+	Core::uint32 DX12Renderer::ReserveEncodeContexts(Core::uint32 chunkCount)
+	{
+		while (mEncodeContexts.size() < chunkCount)
+		{
+			auto context = std::make_unique<EncodeContext>(*this);
+			if (!context->Initialize(mDevice->GetDevice()))
 			{
-				LOG_WARN("Failed to get PSO for material");
-				continue;
+				LOG_ERROR("[DX12Renderer] Failed to create encode context %zu", mEncodeContexts.size());
+				break;
 			}
 
-			cmdList->SetPipelineState(pso);
-
-			ObjectConstants objectData;
-			objectData.worldMatrix = Math::MatrixTranspose(item.worldMatrix);
-			objectData.mvpMatrix = item.mvpMatrix;
-
-			constexpr size_t ALIGNED_OBJECT_SIZE = 256;  // 256바이트 정렬
-
-			mObjectConstantBuffer->UpdateAtOffset(
-				mCurrentFrameIndex,      // 프레임 인덱스
-				mCurrentObjectCBIndex,   // 오브젝트 슬롯 인덱스
-				&objectData,             // 데이터
-				sizeof(ObjectConstants), // 크기
-				ALIGNED_OBJECT_SIZE      // 슬롯 크기
-			);
-
-			// GPU 주소 계산
-			D3D12_GPU_VIRTUAL_ADDRESS baseAddress = mObjectConstantBuffer->GetGPUAddress(mCurrentFrameIndex);
-			D3D12_GPU_VIRTUAL_ADDRESS objectCbvAddress = baseAddress + (ALIGNED_OBJECT_SIZE * mCurrentObjectCBIndex);
-
-			cmdList->SetGraphicsRootConstantBufferView(0, objectCbvAddress);
-
-			MaterialConstants materialData;
-			materialData.baseColor = Math::Vector4(1.0f, 1.0f, 1.0f, 1.0f);  // 기본 흰색
-			materialData.metallic = 0.0f;
-			materialData.roughness = 0.5f;
-			materialData.textureFlags = item.material->GetTextureFlags();
-			materialData.padding = 0.0f;
-
-			mMaterialConstantBuffer->Update(mCurrentFrameIndex, &materialData, sizeof(MaterialConstants));
-
-			D3D12_GPU_VIRTUAL_ADDRESS materialCbvAddress = mMaterialConstantBuffer->GetGPUAddress(mCurrentFrameIndex);
-			cmdList->SetGraphicsRootConstantBufferView(1, materialCbvAddress);
-
-			// 4. Lighting Constants 설정 (b2) - Phase 3.3
-			// UpdateLightingBuffer()에서 이미 업데이트됨
-			D3D12_GPU_VIRTUAL_ADDRESS lightingCbvAddress = mLightingConstantBuffer->GetGPUAddress(mCurrentFrameIndex);
-			cmdList->SetGraphicsRootConstantBufferView(2, lightingCbvAddress);
-
-			// 5. 텍스처 설정 (Root Parameter 3)
-			if (item.material->HasAllocatedDescriptors())
-			{
-				D3D12_GPU_DESCRIPTOR_HANDLE tableHandle = item.material->GetDescriptorTableHandle(mSrvDescriptorHeap.get());
-				cmdList->SetGraphicsRootDescriptorTable(3, tableHandle);
-			}
-			else
-			{
-				LOG_WARN("Material has no allocated descriptors");
-			}
+			mEncodeProviders.push_back(context.get());
+			mEncodeContexts.push_back(std::move(context));
+		}
 
-			// 6. 메시 그리기
-			item.mesh->Draw(cmdList);
+		return std::min(chunkCount, static_cast<Core::uint32>(mEncodeContexts.size()));
+	}
 
-			++mCurrentObjectCBIndex;
+	void DX12Renderer::ReleaseMaterialConstants(const Material& material)
+	{
+		if (mMaterialConstantsPool)
+		{
+			mMaterialConstantsPool->Release(material);
 		}
 	}
 
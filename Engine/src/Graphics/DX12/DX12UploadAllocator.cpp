@@ -0,0 +1,279 @@
+﻿#include "pch.h"
+#include "Graphics/DX12/DX12UploadAllocator.h"
+
+namespace Graphics
+{
+	namespace
+	{
+		constexpr size_t PAGE_GRANULARITY = 64 * 1024;  // 버퍼 리소스 배치 단위
+
+		size_t AlignUp(size_t value, size_t alignment)
+		{
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+	}
+
+	DX12UploadAllocator::~DX12UploadAllocator()
+	{
+		Shutdown();
+	}
+
+	bool DX12UploadAllocator::Initialize(ID3D12Device* device, size_t pageSize)
+	{
+		if (!device)
+		{
+			LOG_ERROR("[DX12UploadAllocator] Device is nullptr");
+			return false;
+		}
+
+		if (pageSize == 0)
+		{
+			LOG_ERROR("[DX12UploadAllocator] Page size cannot be zero");
+			return false;
+		}
+
+		mDevice = device;
+		mPageSize = AlignUp(pageSize, PAGE_GRANULARITY);
+
+		LOG_INFO("[DX12UploadAllocator] Initialized (Page: %zu bytes)", mPageSize);
+		return true;
+	}
+
+	void DX12UploadAllocator::Shutdown()
+	{
+		// 호출자는 GPU 작업 완료를 보장해야 함 (WaitForIdle 후 호출)
+		for (auto& page : mPages)
+		{
+			if (page->resource && page->cpuBase)
+			{
+				page->resource->Unmap(0, nullptr);
+				page->cpuBase = nullptr;
+			}
+		}
+
+		mPages.clear();
+		mAvailablePages.clear();
+		mAvailableLargePages.clear();
+		mRetiredPages.clear();
+		mFramePages.clear();
+
+		mCurrentPage = nullptr;
+		mCurrentOffset = 0;
+		mFrameAllocatedBytes = 0;
+		mDevice = nullptr;
+	}
+
+	void DX12UploadAllocator::BeginFrame(Core::uint64 completedFenceValue)
+	{
+		// Fence 순서로 보류되었으므로 앞에서부터 완료된 페이지만 회수 (크기별 풀로 분리)
+		while (!mRetiredPages.empty() && mRetiredPages.front()->fenceValue <= completedFenceValue)
+		{
+			Page* page = mRetiredPages.front();
+			mRetiredPages.pop_front();
+
+			if (page->size > mPageSize)
+			{
+				mAvailableLargePages.push_back(page);
+			}
+			else
+			{
+				mAvailablePages.push_back(page);
+			}
+		}
+
+		mFrameAllocatedBytes = 0;
+	}
+
+	void DX12UploadAllocator::EndFrame(Core::uint64 fenceValue)
+	{
+		for (Page* page : mFramePages)
+		{
+			page->fenceValue = fenceValue;
+			mRetiredPages.push_back(page);
+		}
+
+		mFramePages.clear();
+		mCurrentPage = nullptr;
+		mCurrentOffset = 0;
+	}
+
+	DX12UploadAllocator::Allocation DX12UploadAllocator::Allocate(size_t size, size_t alignment)
+	{
+		CORE_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+
+		if (size == 0)
+		{
+			return {};
+		}
+
+		size_t offset = AlignUp(mCurrentOffset, alignment);
+
+		// 현재 페이지에 들어가지 않으면 다음 페이지 (남은 공간은 버림)
+		if (!mCurrentPage || offset + size > mCurrentPage->size)
+		{
+			Page* page = AcquirePage(size);
+			if (!page)
+			{
+				return {};
+			}
+
+			mFramePages.push_back(page);
+			offset = 0;
+
+			// 전용 대형 페이지는 현재 페이지를 바꾸지 않음 (기본 페이지 남은 공간 계속 사용)
+			if (page->size > mPageSize && mCurrentPage)
+			{
+				Allocation allocation;
+				allocation.cpuAddress = page->cpuBase;
+				allocation.gpuAddress = page->gpuBase;
+				allocation.size = size;
+
+				mFrameAllocatedBytes += size;
+				return allocation;
+			}
+
+			mCurrentPage = page;
+		}
+
+		Allocation allocation;
+		allocation.cpuAddress = mCurrentPage->cpuBase + offset;
+		allocation.gpuAddress = mCurrentPage->gpuBase + offset;
+		allocation.size = size;
+
+		mCurrentOffset = offset + size;
+		mFrameAllocatedBytes += size;
+		return allocation;
+	}
+
+	D3D12_VERTEX_BUFFER_VIEW DX12UploadAllocator::AllocateVertices(const void* vertices, size_t vertexCount, size_t vertexStride)
+	{
+		D3D12_VERTEX_BUFFER_VIEW view = {};
+
+		const size_t size = vertexCount * vertexStride;
+		Allocation allocation = Allocate(size, 16);
+		if (!allocation.IsValid())
+		{
+			return view;
+		}
+
+		memcpy(allocation.cpuAddress, vertices, size);
+
+		view.BufferLocation = allocation.gpuAddress;
+		view.SizeInBytes = static_cast<UINT>(size);
+		view.StrideInBytes = static_cast<UINT>(vertexStride);
+		return view;
+	}
+
+	D3D12_INDEX_BUFFER_VIEW DX12UploadAllocator::AllocateIndices(const void* indices, size_t indexCount, DXGI_FORMAT format)
+	{
+		CORE_ASSERT(format == DXGI_FORMAT_R16_UINT || format == DXGI_FORMAT_R32_UINT, "Index format must be R16_UINT or R32_UINT");
+
+		D3D12_INDEX_BUFFER_VIEW view = {};
+
+		const size_t size = indexCount * (format == DXGI_FORMAT_R16_UINT ? sizeof(Core::uint16) : sizeof(Core::uint32));
+		Allocation allocation = Allocate(size, 16);
+		if (!allocation.IsValid())
+		{
+			return view;
+		}
+
+		memcpy(allocation.cpuAddress, indices, size);
+
+		view.BufferLocation = allocation.gpuAddress;
+		view.SizeInBytes = static_cast<UINT>(size);
+		view.Format = format;
+		return view;
+	}
+
+	DX12UploadAllocator::Page* DX12UploadAllocator::AcquirePage(size_t minSize)
+	{
+		// 기본 크기 요청은 기본 페이지만 사용
+		// (대형 페이지를 주면 현재 페이지가 되지 못해 한 번 쓰고 버려지며, 대형 요청은 새 페이지를 만들게 됨)
+		if (minSize <= mPageSize)
+		{
+			if (!mAvailablePages.empty())
+			{
+				Page* page = mAvailablePages.back();
+				mAvailablePages.pop_back();
+				return page;
+			}
+
+			return CreatePage(mPageSize);
+		}
+
+		const size_t pageSize = AlignUp(minSize, PAGE_GRANULARITY);
+
+		// 대형 풀에서 크기가 맞는 페이지 중 가장 작은 것 재사용
+		size_t bestIndex = mAvailableLargePages.size();
+		for (size_t i = 0; i < mAvailableLargePages.size(); ++i)
+		{
+			const size_t size = mAvailableLargePages[i]->size;
+			if (size >= pageSize && (bestIndex == mAvailableLargePages.size() || size < mAvailableLargePages[bestIndex]->size))
+			{
+				bestIndex = i;
+				if (size == pageSize)
+				{
+					break;
+				}
+			}
+		}
+
+		if (bestIndex != mAvailableLargePages.size())
+		{
+			Page* page = mAvailableLargePages[bestIndex];
+			mAvailableLargePages[bestIndex] = mAvailableLargePages.back();
+			mAvailableLargePages.pop_back();
+			return page;
+		}
+
+		return CreatePage(pageSize);
+	}
+
+	DX12UploadAllocator::Page* DX12UploadAllocator::CreatePage(size_t size)
+	{
+		if (!mDevice)
+		{
+			CORE_ASSERT(false, "DX12UploadAllocator is not initialized");
+			LOG_ERROR("[DX12UploadAllocator] Not initialized");
+			return nullptr;
+		}
+
+		auto page = std::make_unique<Page>();
+		page->size = size;
+
+		D3D12_HEAP_PROPERTIES heapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
+		D3D12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(static_cast<UINT64>(size));
+
+		HRESULT hr = mDevice->CreateCommittedResource(
+			&heapProps,
+			D3D12_HEAP_FLAG_NONE,
+			&bufferDesc,
+			D3D12_RESOURCE_STATE_GENERIC_READ,  // Upload Heap의 초기 상태
+			nullptr,
+			IID_PPV_ARGS(&page->resource)
+		);
+
+		if (FAILED(hr))
+		{
+			LOG_ERROR("[DX12UploadAllocator] Failed to create page (%zu bytes, HRESULT: 0x%08X)", size, hr);
+			return nullptr;
+		}
+
+		// 지속적으로 Map (CPU에서 읽지 않음)
+		CD3DX12_RANGE readRange(0, 0);
+		hr = page->resource->Map(0, &readRange, reinterpret_cast<void**>(&page->cpuBase));
+		if (FAILED(hr))
+		{
+			LOG_ERROR("[DX12UploadAllocator] Failed to map page (HRESULT: 0x%08X)", hr);
+			return nullptr;
+		}
+
+		page->gpuBase = page->resource->GetGPUVirtualAddress();
+
+		LOG_DEBUG("[DX12UploadAllocator] Created page #%zu (%zu bytes)", mPages.size(), size);
+
+		mPages.push_back(std::move(page));
+		return mPages.back().get();
+	}
+
+} // namespace Graphics
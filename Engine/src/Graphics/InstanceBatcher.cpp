@@ -0,0 +1,98 @@
+﻿#include "pch.h"
+#include "Graphics/InstanceBatcher.h"
+#include "Core/Assert.h"
+
+namespace Graphics
+{
+	void InstanceBatcher::Build(std::span<const RenderItem> items)
+	{
+		mItems = items;
+		mBatches.clear();
+		mInstanceCount = 0;
+
+		const Core::uint32 count = static_cast<Core::uint32>(items.size());
+		for (Core::uint32 i = 0; i < count; ++i)
+		{
+			const RenderItem& item = items[i];
+			if (!item.mesh || !item.material)
+			{
+				continue;
+			}
+
+			// 직전 배치와 같은 쌍이고 아이템이 끊기지 않았으면 이어 붙임
+			if (!mBatches.empty())
+			{
+				InstanceBatch& last = mBatches.back();
+				if (last.mesh == item.mesh
+					&& last.material == item.material
+					&& last.firstItem + last.instanceCount == i)
+				{
+					++last.instanceCount;
+					++mInstanceCount;
+					continue;
+				}
+			}
+
+			InstanceBatch batch;
+			batch.mesh = item.mesh;
+			batch.material = item.material;
+			batch.firstItem = i;
+			batch.firstInstance = mInstanceCount;
+			batch.instanceCount = 1;
+			mBatches.push_back(batch);
+
+			++mInstanceCount;
+		}
+	}
+
+	void InstanceBatcher::PackInstances(InstanceData* dest) const
+	{
+		PackInstances(dest, 0, GetBatchCount());
+	}
+
+	void InstanceBatcher::PackInstances(InstanceData* dest, Core::uint32 firstBatch, Core::uint32 batchCount) const
+	{
+		CORE_ASSERT(dest || mInstanceCount == 0, "InstanceBatcher: destination is null");
+		CORE_ASSERT(firstBatch + batchCount <= GetBatchCount(), "InstanceBatcher: batch range out of bounds");
+
+		const RenderItem* items = mItems.data();
+		for (Core::uint32 b = firstBatch; b < firstBatch + batchCount; ++b)
+		{
+			const InstanceBatch& batch = mBatches[b];
+			const RenderItem* source = items + batch.firstItem;
+			InstanceData* target = dest + batch.firstInstance;
+
+			for (Core::uint32 i = 0; i < batch.instanceCount; ++i)
+			{
+				target[i] = MakeInstanceData(source[i]);
+			}
+		}
+	}
+
+	void InstanceBatcher::PackBatch(Core::uint32 batchIndex, void* dest, size_t stride) const
+	{
+		CORE_ASSERT(dest, "InstanceBatcher: destination is null");
+		CORE_ASSERT(batchIndex < GetBatchCount(), "InstanceBatcher: batch index out of bounds");
+		CORE_ASSERT(stride >= sizeof(InstanceData), "InstanceBatcher: stride is smaller than InstanceData");
+
+		const InstanceBatch& batch = mBatches[batchIndex];
+		const RenderItem* source = mItems.data() + batch.firstItem;
+		Core::uint8* target = static_cast<Core::uint8*>(dest);
+
+		for (Core::uint32 i = 0; i < batch.instanceCount; ++i)
+		{
+			*reinterpret_cast<InstanceData*>(target + stride * i) = MakeInstanceData(source[i]);
+		}
+	}
+
+	InstanceData InstanceBatcher::MakeInstanceData(const RenderItem& item)
+	{
+		// mvpMatrix는 수집 단계에서 이미 전치됨
+		InstanceData data;
+		data.worldMatrix = Math::MatrixTranspose(item.worldMatrix);
+		data.mvpMatrix = item.mvpMatrix;
+		data.normalMatrix = Math::MatrixTranspose(item.normalMatrix);
+		return data;
+	}
+
+} // namespace Graphics
@@ -3,11 +3,17 @@
 #include "Graphics/DX12/DX12DescriptorHeap.h"
 #include "Graphics/Texture.h"
 #include "Framework/Resources/ResourceManager.h"
+#include <atomic>
 
 using namespace std;
 
 namespace Graphics
 {
+	namespace
+	{
+		// 모든 Material이 공유하는 상수 버전 카운터 (버전이 Material 간에 겹치지 않도록)
+		std::atomic<Core::uint64> sNextConstantsVersion{ 1 };
+	}
 
 	Material::Material(const MaterialDesc& desc)
 		: mVertexShaderPath(desc.vertexShaderPath)
@@ -20,6 +26,10 @@ namespace Graphics
 		, mSampleCount(desc.sampleCount)
 		, mSampleQuality(desc.sampleQuality)
 		, mSampleMask(desc.sampleMask)
+		, mSupportsInstancing(desc.instancing)
+		, mBaseColor(desc.baseColor)
+		, mMetallic(desc.metallic)
+		, mRoughness(desc.roughness)
 	{
 		mBlendDesc = CreateBlendDesc(desc.blendMode);
 		mDepthStencilDesc = CreateDepthStencilDesc(
@@ -54,6 +64,12 @@ namespace Graphics
 		}
 
 		mDescriptorStartIndex = INVALID_DESCRIPTOR_INDEX;
+
+		MarkConstantsDirty();
+
+		// 렌더 상태는 생성 후 바뀌지 않으므로 해시를 미리 계산
+		// (정렬 키 계산 등 여러 스레드에서 GetHash를 동시에 읽어도 안전하도록)
+		GetHash();
 	}
 
 	Material::Material()
@@ -99,6 +115,10 @@ namespace Graphics
 		}
 		
 		mDescriptorStartIndex = INVALID_DESCRIPTOR_INDEX;
+
+		MarkConstantsDirty();
+
+		GetHash();  // 해시 미리 계산 (위 생성자 참고)
 	}
 
 	bool Material::AllocateDescriptors(
@@ -226,6 +246,9 @@ namespace Graphics
 		size_t index = static_cast<size_t>(type);
 		mTextureIds[index] = textureId;
 
+		// textureFlags가 바뀔 수 있으므로 상수 재업로드
+		MarkConstantsDirty();
+
 		LOG_DEBUG(
 			"[Material] Set texture %s to ID: 0x%llX",
 			TextureTypeToString(type),
@@ -371,6 +394,40 @@ namespace Graphics
 	//	return count;
 	//}
 
+	void Material::SetBaseColor(const Math::Vector4& color)
+	{
+		mBaseColor = color;
+		MarkConstantsDirty();
+	}
+
+	void Material::SetMetallic(Core::float32 metallic)
+	{
+		mMetallic = metallic;
+		MarkConstantsDirty();
+	}
+
+	void Material::SetRoughness(Core::float32 roughness)
+	{
+		mRoughness = roughness;
+		MarkConstantsDirty();
+	}
+
+	MaterialConstants Material::GetConstants() const
+	{
+		MaterialConstants constants;
+		constants.baseColor = mBaseColor;
+		constants.metallic = mMetallic;
+		constants.roughness = mRoughness;
+		constants.textureFlags = GetTextureFlags();
+		constants.padding = 0.0f;
+		return constants;
+	}
+
+	void Material::MarkConstantsDirty()
+	{
+		mConstantsVersion = sNextConstantsVersion.fetch_add(1, std::memory_order_relaxed);
+	}
+
 	Core::uint32 Material::GetTextureFlags() const
 	{
 		Core::uint32 flags = 0;
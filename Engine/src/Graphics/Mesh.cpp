@@ -71,6 +71,7 @@ namespace Graphics
 		}
 
 		mInputLayout = BasicVertex::GetInputLayout();
+		Math::ComputeBounds(vertices, vertexCount, mLocalBounds, mLocalSphere);
 
 		mInitialized = true;
 		LOG_GFX_INFO("Mesh initialized successfully (V:%u, I:%u)", vertexCount, indexCount);
@@ -136,6 +137,7 @@ namespace Graphics
 		}
 
 		mInputLayout = TexturedVertex::GetInputLayout();  // 변경됨
+		Math::ComputeBounds(vertices, vertexCount, mLocalBounds, mLocalSphere);
 
 		mInitialized = true;
 		LOG_GFX_INFO("Mesh initialized successfully (V:%u, I:%u)", vertexCount, indexCount);
@@ -205,6 +207,7 @@ namespace Graphics
 
 		// 핵심 변경점: StandardVertex의 Input Layout 사용
 		mInputLayout = StandardVertex::GetInputLayout();
+		Math::ComputeBounds(vertices, vertexCount, mLocalBounds, mLocalSphere);
 
 		mInitialized = true;
 		LOG_GFX_INFO("Mesh initialized successfully (V:%u, I:%u)", vertexCount, indexCount);
@@ -225,7 +228,7 @@ namespace Graphics
 		LOG_GFX_INFO("[Mesh] Mesh shut down successfully");
 	}
 
-	void Mesh::Draw(ID3D12GraphicsCommandList* commandList) const
+	void Mesh::Draw(ID3D12GraphicsCommandList* commandList, uint32 instanceCount) const
 	{
 		if (!mInitialized)
 		{
@@ -233,16 +236,7 @@ namespace Graphics
 			return;
 		}
 
-		// Vertex Buffer 바인딩
-		D3D12_VERTEX_BUFFER_VIEW vbv = mVertexBuffer.GetVertexBufferView();
-		commandList->IASetVertexBuffers(0, 1, &vbv);
-
-		// Index Buffer 바인딩 (있는 경우)
-		if (mIndexBuffer.IsInitialized())
-		{
-			D3D12_INDEX_BUFFER_VIEW ibv = mIndexBuffer.GetIndexBufferView();
-			commandList->IASetIndexBuffer(&ibv);
-		}
+		Bind(commandList);
 
 		// Index Buffer 사용 여부에 따라 다른 Draw 호출
 		if (mIndexBuffer.IsInitialized())
@@ -250,7 +244,7 @@ namespace Graphics
 			// DrawIndexedInstanced(IndexCount, InstanceCount, StartIndex, BaseVertex, StartInstance)
 			commandList->DrawIndexedInstanced(
 				static_cast<UINT>(mIndexBuffer.GetIndexCount()),
-				1,  // 인스턴스 1개
+				instanceCount,
 				0,  // 첫 번째 인덱스부터
 				0,  // 베이스 버텍스 오프셋 없음
 				0   // 첫 번째 인스턴스
@@ -261,11 +255,31 @@ namespace Graphics
 			// DrawInstanced(VertexCount, InstanceCount, StartVertex, StartInstance)
 			commandList->DrawInstanced(
 				static_cast<UINT>(mVertexBuffer.GetVertexCount()),
-				1,  // 인스턴스 1개
+				instanceCount,
 				0,  // 첫 번째 버텍스부터
 				0   // 첫 번째 인스턴스
 			);
 		}
 	}
 
+	void Mesh::Bind(ID3D12GraphicsCommandList* commandList) const
+	{
+		if (!mInitialized)
+		{
+			LOG_ERROR("Mesh::Bind - Mesh not initialized");
+			return;
+		}
+
+		// Vertex Buffer 바인딩
+		D3D12_VERTEX_BUFFER_VIEW vbv = mVertexBuffer.GetVertexBufferView();
+		commandList->IASetVertexBuffers(0, 1, &vbv);
+
+		// Index Buffer 바인딩 (있는 경우)
+		if (mIndexBuffer.IsInitialized())
+		{
+			D3D12_INDEX_BUFFER_VIEW ibv = mIndexBuffer.GetIndexBufferView();
+			commandList->IASetIndexBuffer(&ibv);
+		}
+	}
+
 } // namespace Graphics
@@ -0,0 +1,148 @@
+﻿#include "pch.h"
+#include "Graphics/NullRenderBackend.h"
+#include "Core/Logging/LogMacros.h"
+
+namespace Graphics
+{
+	namespace
+	{
+		// D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT (D3D12 헤더 없이 검증하기 위해 값으로 둠)
+		constexpr Core::uint64 CONSTANT_BUFFER_ALIGNMENT = 256;
+	}
+
+	bool NullRenderBackend::Submit(const RenderCommandStream& stream)
+	{
+		constexpr Core::uint32 ALL_SLOTS_MASK = (1u << static_cast<Core::uint32>(RootSlot::Count)) - 1;
+
+		const Core::uint64 errorsBefore = mStats.errorCount;
+		mReportedErrors = 0;
+
+		// 새 커맨드 리스트와 같은 빈 바인딩 상태에서 시작
+		const void* pipelineState = nullptr;
+		const SetMeshArgs* mesh = nullptr;
+		Core::uint32 boundSlots = 0;
+
+		const auto& commands = stream.GetCommands();
+		for (size_t i = 0; i < commands.size(); ++i)
+		{
+			const RenderCommand& command = commands[i];
+
+			if (command.type >= RenderCommandType::Count)
+			{
+				ReportError(i, "Unknown command type");
+				continue;
+			}
+
+			++mStats.commandCounts[static_cast<size_t>(command.type)];
+			++mStats.commandCount;
+
+			switch (command.type)
+			{
+			case RenderCommandType::SetPipelineState:
+				if (!command.pipelineState)
+				{
+					ReportError(i, "Null pipeline state");
+				}
+				pipelineState = command.pipelineState;
+				break;
+
+			case RenderCommandType::SetConstantBuffer:
+			case RenderCommandType::SetShaderResource:
+			case RenderCommandType::SetDescriptorTable:
+				if (command.slot >= RootSlot::Count)
+				{
+					ReportError(i, "Root slot out of range");
+					break;
+				}
+				if ((command.type == RenderCommandType::SetDescriptorTable ? command.descriptorHandle : command.gpuAddress) == 0)
+				{
+					ReportError(i, "Null GPU address or descriptor handle");
+					break;
+				}
+				if (command.type == RenderCommandType::SetConstantBuffer
+					&& (command.gpuAddress % CONSTANT_BUFFER_ALIGNMENT) != 0)
+				{
+					ReportError(i, "Constant buffer address is not 256-byte aligned");
+					break;
+				}
+				boundSlots |= 1u << static_cast<Core::uint32>(command.slot);
+				break;
+
+			case RenderCommandType::SetMesh:
+				if (!command.setMesh.mesh)
+				{
+					ReportError(i, "Null mesh");
+				}
+				mesh = command.setMesh.mesh ? &command.setMesh : nullptr;
+				break;
+
+			case RenderCommandType::DrawIndexed:
+			case RenderCommandType::DrawInstanced:
+			{
+				const bool indexed = command.type == RenderCommandType::DrawIndexed;
+				const Core::uint32 instanceCount = indexed ? command.drawIndexed.instanceCount : command.drawInstanced.instanceCount;
+
+				++mStats.drawCount;
+				mStats.instanceCount += instanceCount;
+
+				if (!pipelineState)
+				{
+					ReportError(i, "Draw without pipeline state");
+				}
+				if ((boundSlots & ALL_SLOTS_MASK) != ALL_SLOTS_MASK)
+				{
+					ReportError(i, "Draw with unbound root parameters");
+				}
+				if (instanceCount == 0)
+				{
+					ReportError(i, "Draw with zero instances");
+				}
+				if (!mesh)
+				{
+					ReportError(i, "Draw without mesh");
+					break;
+				}
+
+				if (indexed)
+				{
+					const DrawIndexedArgs& args = command.drawIndexed;
+					if (mesh->extent.indexCount == 0 && args.indexCount > 0)
+					{
+						ReportError(i, "Indexed draw on mesh without index buffer");
+					}
+					else if (static_cast<size_t>(args.startIndex) + args.indexCount > mesh->extent.indexCount)
+					{
+						ReportError(i, "Index range exceeds mesh");
+					}
+				}
+				else
+				{
+					const DrawInstancedArgs& args = command.drawInstanced;
+					if (static_cast<size_t>(args.startVertex) + args.vertexCount > mesh->extent.vertexCount)
+					{
+						ReportError(i, "Vertex range exceeds mesh");
+					}
+				}
+				break;
+			}
+
+			default:
+				break;
+			}
+		}
+
+		return mStats.errorCount == errorsBefore;
+	}
+
+	void NullRenderBackend::ReportError(size_t commandIndex, const char* message)
+	{
+		++mStats.errorCount;
+
+		if (mReportedErrors < MAX_REPORTED_ERRORS)
+		{
+			++mReportedErrors;
+			LOG_WARN("[NullRenderBackend] Command %zu: %s", commandIndex, message);
+		}
+	}
+
+} // namespace Graphics
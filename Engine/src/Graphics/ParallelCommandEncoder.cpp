@@ -0,0 +1,150 @@
+﻿#include "pch.h"
+#include "Graphics/ParallelCommandEncoder.h"
+#include "Core/Assert.h"
+#include "Core/Jobs/JobSystem.h"
+#include <algorithm>
+
+namespace Graphics
+{
+	namespace
+	{
+		bool IsSameBatch(const RenderItem& a, const RenderItem& b)
+		{
+			return a.mesh == b.mesh && a.material == b.material;
+		}
+
+		bool CanUseJobs()
+		{
+			return Core::Jobs::JobSystem::IsValid()
+				&& Core::Jobs::JobSystem::GetCurrentThreadIndex() != Core::Jobs::JobSystem::INVALID_THREAD_INDEX;
+		}
+	}
+
+	Core::uint32 ParallelCommandEncoder::ComputeChunkCount(size_t itemCount, Core::uint32 minItemsPerChunk)
+	{
+		if (!CanUseJobs())
+		{
+			return 1;
+		}
+
+		const size_t threadCount = Core::Jobs::JobSystem::GetInstance().GetThreadCount();
+		const size_t byItems = itemCount / std::max<Core::uint32>(minItemsPerChunk, 1);
+		return static_cast<Core::uint32>(std::clamp<size_t>(byItems, 1, threadCount));
+	}
+
+	bool ParallelCommandEncoder::Encode(
+		std::span<const RenderItem> items,
+		std::span<IRenderResourceProvider* const> providers,
+		const RenderCommandStream* preamble
+	)
+	{
+		CORE_ASSERT(!providers.empty(), "ParallelCommandEncoder: at least one provider is required");
+
+		const Core::uint32 chunkCount = static_cast<Core::uint32>(providers.size());
+		SplitChunks(items, chunkCount);
+
+		// 청크마다 Builder/Stream/Provider가 분리되어 있으므로 동기화 없이 기록
+		// (JobSystem을 사용할 수 없으면 ParallelFor가 순서대로 직렬 실행)
+		Core::Jobs::ParallelFor(chunkCount, 1, [&](Core::uint32 chunkIndex)
+			{
+				EncodeChunk(mChunks[chunkIndex], items, *providers[chunkIndex], preamble);
+			});
+
+		bool succeeded = true;
+		for (Core::uint32 i = 0; i < chunkCount; ++i)
+		{
+			succeeded = succeeded && mChunks[i].succeeded;
+		}
+		return succeeded;
+	}
+
+	const RenderCommandStream& ParallelCommandEncoder::GetStream(Core::uint32 chunkIndex) const
+	{
+		CORE_ASSERT(chunkIndex < mChunkCount, "ParallelCommandEncoder: chunk index out of range");
+		return mChunks[chunkIndex].stream;
+	}
+
+	Core::uint32 ParallelCommandEncoder::GetChunkFirstItem(Core::uint32 chunkIndex) const
+	{
+		CORE_ASSERT(chunkIndex < mChunkCount, "ParallelCommandEncoder: chunk index out of range");
+		return mChunks[chunkIndex].firstItem;
+	}
+
+	Core::uint32 ParallelCommandEncoder::GetChunkItemCount(Core::uint32 chunkIndex) const
+	{
+		CORE_ASSERT(chunkIndex < mChunkCount, "ParallelCommandEncoder: chunk index out of range");
+		return mChunks[chunkIndex].itemCount;
+	}
+
+	size_t ParallelCommandEncoder::GetCommandCount() const
+	{
+		size_t count = 0;
+		for (Core::uint32 i = 0; i < mChunkCount; ++i)
+		{
+			count += mChunks[i].stream.GetCommandCount();
+		}
+		return count;
+	}
+
+	void ParallelCommandEncoder::SplitChunks(std::span<const RenderItem> items, Core::uint32 chunkCount)
+	{
+		if (mChunks.size() < chunkCount)
+		{
+			mChunks.resize(chunkCount);
+		}
+		mChunkCount = chunkCount;
+
+		const Core::uint32 itemCount = static_cast<Core::uint32>(items.size());
+		const Core::uint32 chunkSize = (itemCount + chunkCount - 1) / chunkCount;
+
+		Core::uint32 begin = 0;
+		for (Core::uint32 i = 0; i < chunkCount; ++i)
+		{
+			Core::uint32 end = itemCount;
+			if (i + 1 < chunkCount)
+			{
+				end = std::clamp(static_cast<Core::uint32>(static_cast<Core::uint64>(itemCount) * (i + 1) / chunkCount), begin, itemCount);
+
+				// 같은 배치 중간이면 경계를 뒤로 옮김 (한 배치가 너무 길면 청크 크기의 절반까지만 찾고 그 자리에서 나눔)
+				const Core::uint32 searchEnd = std::min(end + chunkSize / 2, itemCount);
+				Core::uint32 boundary = end;
+				while (boundary > 0 && boundary < searchEnd && IsSameBatch(items[boundary - 1], items[boundary]))
+				{
+					++boundary;
+				}
+				if (boundary < searchEnd || boundary == itemCount)
+				{
+					end = boundary;
+				}
+			}
+
+			mChunks[i].firstItem = begin;
+			mChunks[i].itemCount = end - begin;
+			begin = end;
+		}
+	}
+
+	void ParallelCommandEncoder::EncodeChunk(
+		Chunk& chunk,
+		std::span<const RenderItem> items,
+		IRenderResourceProvider& provider,
+		const RenderCommandStream* preamble
+	)
+	{
+		chunk.stream.Clear();
+		chunk.succeeded = true;
+
+		if (chunk.itemCount == 0)
+		{
+			return;
+		}
+
+		if (preamble)
+		{
+			chunk.stream.Append(*preamble);
+		}
+
+		chunk.succeeded = chunk.builder.Build(items.subspan(chunk.firstItem, chunk.itemCount), provider, chunk.stream);
+	}
+
+} // namespace Graphics
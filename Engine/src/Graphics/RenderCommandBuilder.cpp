@@ -0,0 +1,160 @@
+﻿#include "pch.h"
+#include "Graphics/RenderCommandBuilder.h"
+#include "Core/Logging/LogMacros.h"
+
+namespace Graphics
+{
+	bool RenderCommandBuilder::Build(
+		std::span<const RenderItem> items,
+		IRenderResourceProvider& provider,
+		RenderCommandStream& stream
+	)
+	{
+		if (items.empty())
+		{
+			return true;
+		}
+
+		// 연속한 같은 (Mesh, Material) 아이템을 배치로 묶고 인스턴스 데이터를 업로드 메모리에 직접 기록
+		mBatcher.Build(items);
+
+		const auto& batches = mBatcher.GetBatches();
+		if (batches.empty())
+		{
+			return true;
+		}
+
+		// 인스턴싱 여부는 배치마다 한 번만 조회
+		const Core::uint32 batchCount = static_cast<Core::uint32>(batches.size());
+		mBatchInstancing.resize(batchCount);
+
+		Core::uint32 instancedCount = 0;
+		Core::uint32 objectCount = 0;
+		for (Core::uint32 b = 0; b < batchCount; ++b)
+		{
+			const bool instancing = provider.SupportsInstancing(*batches[b].material);
+			mBatchInstancing[b] = instancing;
+			(instancing ? instancedCount : objectCount) += batches[b].instanceCount;
+		}
+
+		// 한 번의 할당에 아이템마다 한 번만 기록:
+		// [인스턴스 버퍼 (InstanceData 간격)] [Object Constants (CBV 정렬 간격, 인스턴싱 미지원 아이템)]
+		const size_t instanceBytes = AlignObjectConstants(sizeof(InstanceData) * instancedCount);
+		const UploadRegion upload = provider.AllocateUpload(instanceBytes + OBJECT_CONSTANTS_STRIDE * objectCount);
+		if (!upload.cpuAddress)
+		{
+			LOG_ERROR("[RenderCommandBuilder] Failed to allocate instance buffer (%u instances)", mBatcher.GetInstanceCount());
+			return false;
+		}
+
+		Core::uint8* instanceCpu = static_cast<Core::uint8*>(upload.cpuAddress);
+		Core::uint64 instanceGpu = upload.gpuAddress;
+		Core::uint8* objectCpu = instanceCpu + instanceBytes;
+		Core::uint64 objectGpu = upload.gpuAddress + instanceBytes;
+
+		// 모든 Root Parameter가 설정되어 있도록 시작 주소로 초기화 (셰이더 종류와 무관)
+		// 할당은 256바이트 정렬이고 InstanceData와 ObjectConstants는 레이아웃이 같으므로 b0로도 유효
+		stream.SetConstantBuffer(RootSlot::ObjectConstants, upload.gpuAddress);
+		stream.SetShaderResource(RootSlot::InstanceBuffer, upload.gpuAddress);
+
+		// 정렬된 아이템은 같은 PSO/Material/Mesh가 연속되므로 직전과 같으면 다시 설정하지 않음
+		const void* boundPso = nullptr;
+		const Material* boundMaterial = nullptr;
+		const Mesh* boundMesh = nullptr;
+		MeshExtent boundExtent = {};
+
+		for (Core::uint32 b = 0; b < batchCount; ++b)
+		{
+			const InstanceBatch& batch = batches[b];
+
+			// 1. Pipeline State Object
+			const void* pso = provider.GetPipelineState(*batch.material, *batch.mesh);
+			if (!pso)
+			{
+				LOG_WARN("Failed to get PSO for material");
+				continue;
+			}
+
+			if (pso != boundPso)
+			{
+				stream.SetPipelineState(pso);
+				boundPso = pso;
+			}
+
+			// 2. Material 상수와 텍스처 테이블
+			if (batch.material != boundMaterial)
+			{
+				// 상수 슬롯이 없으면(풀 고갈) null CBV를 GPU에 넘기지 않고 배치를 건너뜀
+				const Core::uint64 constants = provider.GetMaterialConstants(*batch.material);
+				if (constants == 0)
+				{
+					LOG_WARN("Failed to get material constants");
+					continue;
+				}
+
+				boundMaterial = batch.material;
+				stream.SetConstantBuffer(RootSlot::MaterialConstants, constants);
+
+				const Core::uint64 table = provider.GetMaterialDescriptorTable(*batch.material);
+				if (table != 0)
+				{
+					stream.SetDescriptorTable(RootSlot::MaterialTextures, table);
+				}
+				else
+				{
+					LOG_WARN("Material has no allocated descriptors");
+				}
+			}
+
+			// 3. Vertex/Index Buffer
+			if (batch.mesh != boundMesh)
+			{
+				boundExtent = provider.GetMeshExtent(*batch.mesh);
+				stream.SetMesh(batch.mesh, boundExtent);
+				boundMesh = batch.mesh;
+			}
+
+			// 4. 인스턴스 Draw: 배치 시작 원소를 가리키도록 Instance Buffer 설정 후 한 번에 그림
+			// (SV_InstanceID는 StartInstanceLocation을 더하지 않으므로 주소로 오프셋)
+			if (mBatchInstancing[b])
+			{
+				mBatcher.PackBatch(b, instanceCpu, sizeof(InstanceData));
+				stream.SetShaderResource(RootSlot::InstanceBuffer, instanceGpu);
+				EmitDraw(stream, boundExtent, batch.instanceCount);
+
+				instanceCpu += sizeof(InstanceData) * batch.instanceCount;
+				instanceGpu += sizeof(InstanceData) * batch.instanceCount;
+				continue;
+			}
+
+			// 5. 인스턴싱을 지원하지 않는 Material: 아이템마다 CBV 정렬 슬롯에 기록 후 그림
+			// b0와 Instance Buffer(t0, space1)를 모두 이 슬롯으로 설정하므로 셰이더가 어느 쪽을 읽어도 올바름
+			mBatcher.PackBatch(b, objectCpu, OBJECT_CONSTANTS_STRIDE);
+			for (Core::uint32 i = 0; i < batch.instanceCount; ++i)
+			{
+				stream.SetConstantBuffer(RootSlot::ObjectConstants, objectGpu);
+				stream.SetShaderResource(RootSlot::InstanceBuffer, objectGpu);
+				EmitDraw(stream, boundExtent, 1);
+
+				objectCpu += OBJECT_CONSTANTS_STRIDE;
+				objectGpu += OBJECT_CONSTANTS_STRIDE;
+			}
+		}
+
+		return true;
+	}
+
+	void RenderCommandBuilder::EmitDraw(RenderCommandStream& stream, const MeshExtent& extent, Core::uint32 instanceCount)
+	{
+		// Index Buffer 사용 여부에 따라 다른 Draw 명령
+		if (extent.indexCount > 0)
+		{
+			stream.DrawIndexed(extent.indexCount, instanceCount);
+		}
+		else
+		{
+			stream.DrawInstanced(extent.vertexCount, instanceCount);
+		}
+	}
+
+} // namespace Graphics
@@ -0,0 +1,145 @@
+﻿#include "pch.h"
+#include "Graphics/RenderQueue.h"
+#include "Graphics/Material.h"
+
+namespace Graphics
+{
+	void RenderQueueSorter::Sort(std::vector<RenderItem>& items)
+	{
+		const Core::uint32 count = static_cast<Core::uint32>(items.size());
+		if (count < 2)
+		{
+			return;
+		}
+
+		mEntries.resize(count);
+		for (Core::uint32 i = 0; i < count; ++i)
+		{
+			mEntries[i] = { items[i].sortKey, i };
+		}
+
+		const SortEntry* sorted = mEntries.data();
+
+		if (count <= SMALL_SORT_THRESHOLD)
+		{
+			// 삽입 정렬 (같은 키는 순서 유지)
+			for (Core::uint32 i = 1; i < count; ++i)
+			{
+				const SortEntry entry = mEntries[i];
+				Core::uint32 j = i;
+				while (j > 0 && mEntries[j - 1].key > entry.key)
+				{
+					mEntries[j] = mEntries[j - 1];
+					--j;
+				}
+				mEntries[j] = entry;
+			}
+		}
+		else
+		{
+			constexpr Core::uint32 DIGIT_COUNT = 8;
+			constexpr Core::uint32 BUCKET_COUNT = 256;
+
+			// 모든 자리의 히스토그램을 한 번에 계산
+			Core::uint32 histograms[DIGIT_COUNT][BUCKET_COUNT] = {};
+			for (const SortEntry& entry : mEntries)
+			{
+				for (Core::uint32 digit = 0; digit < DIGIT_COUNT; ++digit)
+				{
+					++histograms[digit][(entry.key >> (digit * 8)) & 0xFF];
+				}
+			}
+
+			mScratch.resize(count);
+			SortEntry* source = mEntries.data();
+			SortEntry* destination = mScratch.data();
+
+			for (Core::uint32 digit = 0; digit < DIGIT_COUNT; ++digit)
+			{
+				const Core::uint32 shift = digit * 8;
+				Core::uint32* histogram = histograms[digit];
+
+				// 모든 키의 이 자리 값이 같으면 순서가 바뀌지 않으므로 건너뜀
+				if (histogram[(source[0].key >> shift) & 0xFF] == count)
+				{
+					continue;
+				}
+
+				// 누적합 -> 버킷 시작 위치
+				Core::uint32 offset = 0;
+				for (Core::uint32 bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+				{
+					const Core::uint32 bucketCount = histogram[bucket];
+					histogram[bucket] = offset;
+					offset += bucketCount;
+				}
+
+				for (Core::uint32 i = 0; i < count; ++i)
+				{
+					destination[histogram[(source[i].key >> shift) & 0xFF]++] = source[i];
+				}
+
+				std::swap(source, destination);
+			}
+
+			sorted = source;
+		}
+
+		// 이미 정렬되어 있으면 재배치 생략 (정적인 장면에서 흔함)
+		bool isIdentity = true;
+		for (Core::uint32 i = 0; i < count && isIdentity; ++i)
+		{
+			isIdentity = (sorted[i].index == i);
+		}
+		if (isIdentity)
+		{
+			return;
+		}
+
+		mItemScratch.resize(count);
+		for (Core::uint32 i = 0; i < count; ++i)
+		{
+			mItemScratch[i] = items[sorted[i].index];
+		}
+		items.swap(mItemScratch);
+	}
+
+	RenderStateChanges CountStateChanges(const std::vector<RenderItem>& items)
+	{
+		RenderStateChanges changes;
+
+		size_t lastPipeline = 0;
+		const Material* lastMaterial = nullptr;
+		const Mesh* lastMesh = nullptr;
+		bool first = true;
+
+		for (const RenderItem& item : items)
+		{
+			if (!item.mesh || !item.material)
+			{
+				continue;
+			}
+
+			const size_t pipeline = item.material->GetHash();
+			if (first || pipeline != lastPipeline)
+			{
+				++changes.pipelineChanges;
+				lastPipeline = pipeline;
+			}
+			if (item.material != lastMaterial)
+			{
+				++changes.materialChanges;
+				lastMaterial = item.material;
+			}
+			if (item.mesh != lastMesh)
+			{
+				++changes.meshChanges;
+				lastMesh = item.mesh;
+			}
+			first = false;
+		}
+
+		return changes;
+	}
+
+} // namespace Graphics
@@ -0,0 +1,587 @@
+﻿#include "Math/MathBatch.h"
+#include "MathBatchKernels.h"
+
+#if MATH_BATCH_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <emmintrin.h>
+#endif
+
+namespace Math
+{
+	namespace
+	{
+		SimdLevel DetectSimdLevel() noexcept
+		{
+#if MATH_BATCH_X86
+#if defined(_MSC_VER)
+			int info[4] = {};
+			__cpuid(info, 0);
+			const int maxLeaf = info[0];
+
+			__cpuid(info, 1);
+			const bool hasOsxsave = (info[2] & (1 << 27)) != 0;
+			const bool hasAvx = (info[2] & (1 << 28)) != 0;
+
+			bool hasAvx2 = false;
+			if (maxLeaf >= 7)
+			{
+				__cpuidex(info, 7, 0);
+				hasAvx2 = (info[1] & (1 << 5)) != 0;
+			}
+
+			// OS가 컨텍스트 전환 시 YMM 레지스터를 저장하는지 확인 (XCR0의 SSE/AVX 비트)
+			const bool osSavesYmm = hasOsxsave && (_xgetbv(0) & 0x6) == 0x6;
+
+			return (hasAvx && hasAvx2 && osSavesYmm) ? SimdLevel::AVX2 : SimdLevel::SSE2;
+#else
+			return __builtin_cpu_supports("avx2") ? SimdLevel::AVX2 : SimdLevel::SSE2;
+#endif
+#else
+			return SimdLevel::Scalar;
+#endif
+		}
+
+		SimdLevel& ActiveSimdLevel() noexcept
+		{
+			static SimdLevel sLevel = GetSupportedSimdLevel();
+			return sLevel;
+		}
+	}
+
+	//=============================================================================
+	// SIMD 경로 선택
+	//=============================================================================
+
+	SimdLevel GetSupportedSimdLevel() noexcept
+	{
+		static const SimdLevel sSupported = DetectSimdLevel();
+		return sSupported;
+	}
+
+	SimdLevel GetSimdLevel() noexcept
+	{
+		return ActiveSimdLevel();
+	}
+
+	void SetSimdLevel(SimdLevel level) noexcept
+	{
+		const SimdLevel supported = GetSupportedSimdLevel();
+		ActiveSimdLevel() = (level > supported) ? supported : level;
+	}
+
+	const char* GetSimdLevelName(SimdLevel level) noexcept
+	{
+		switch (level)
+		{
+		case SimdLevel::SSE2:
+			return "SSE2";
+		case SimdLevel::AVX2:
+			return "AVX2";
+		default:
+			return "Scalar";
+		}
+	}
+
+	//=============================================================================
+	// 배치 커널 (경로 분기)
+	//=============================================================================
+
+	namespace
+	{
+		// Matrix4x4/Matrix3x4 공용 분기 (Internal 구현은 행렬 형식별로 오버로드됨)
+		template<typename M>
+		void ComposeTRSDispatch(
+			const Vector3* positions,
+			const Quaternion* rotations,
+			const Vector3* scales,
+			M* outMatrices,
+			Core::uint32 count
+		) noexcept
+		{
+			switch (GetSimdLevel())
+			{
+#if MATH_BATCH_X86
+			case SimdLevel::AVX2:
+				Internal::ComposeTRSBatchAVX2(positions, rotations, scales, outMatrices, count);
+				return;
+			case SimdLevel::SSE2:
+				Internal::ComposeTRSBatchSSE2(positions, rotations, scales, outMatrices, count);
+				return;
+#endif
+			default:
+				for (Core::uint32 i = 0; i < count; ++i)
+				{
+					Internal::ComposeTRSScalar(positions[i], rotations[i], scales[i], outMatrices[i]);
+				}
+				return;
+			}
+		}
+
+		// rhsIndices가 nullptr면 rhs[i]를 사용
+		template<typename M>
+		void MultiplyMatrixDispatch(
+			const M* lhs,
+			const M* rhs,
+			const Core::uint32* rhsIndices,
+			M* outMatrices,
+			Core::uint32 count
+		) noexcept
+		{
+			switch (GetSimdLevel())
+			{
+#if MATH_BATCH_X86
+			case SimdLevel::AVX2:
+				Internal::MultiplyMatrixBatchAVX2(lhs, rhs, rhsIndices, outMatrices, count);
+				return;
+			case SimdLevel::SSE2:
+				Internal::MultiplyMatrixBatchSSE2(lhs, rhs, rhsIndices, outMatrices, count);
+				return;
+#endif
+			default:
+				for (Core::uint32 i = 0; i < count; ++i)
+				{
+					Internal::MultiplyMatrixScalar(lhs[i], rhsIndices ? rhs[rhsIndices[i]] : rhs[i], outMatrices[i]);
+				}
+				return;
+			}
+		}
+
+		template<typename M>
+		void InverseTransposeDispatch(
+			const M* matrices,
+			M* outMatrices,
+			Core::uint32 count
+		) noexcept
+		{
+			switch (GetSimdLevel())
+			{
+#if MATH_BATCH_X86
+			case SimdLevel::AVX2:
+				Internal::InverseTransposeBatchAVX2(matrices, outMatrices, count);
+				return;
+			case SimdLevel::SSE2:
+				Internal::InverseTransposeBatchSSE2(matrices, outMatrices, count);
+				return;
+#endif
+			default:
+				for (Core::uint32 i = 0; i < count; ++i)
+				{
+					Internal::InverseTransposeScalar(matrices[i], outMatrices[i]);
+				}
+				return;
+			}
+		}
+	}
+
+	void ComposeTRSBatch(
+		const Vector3* positions,
+		const Quaternion* rotations,
+		const Vector3* scales,
+		Matrix4x4* outMatrices,
+		Core::uint32 count
+	) noexcept
+	{
+		ComposeTRSDispatch(positions, rotations, scales, outMatrices, count);
+	}
+
+	void MultiplyMatrixBatch(
+		const Matrix4x4* lhs,
+		const Matrix4x4* rhs,
+		Matrix4x4* outMatrices,
+		Core::uint32 count
+	) noexcept
+	{
+		MultiplyMatrixDispatch(lhs, rhs, nullptr, outMatrices, count);
+	}
+
+	void MultiplyMatrixBatchIndexed(
+		const Matrix4x4* lhs,
+		const Matrix4x4* rhs,
+		const Core::uint32* rhsIndices,
+		Matrix4x4* outMatrices,
+		Core::uint32 count
+	) noexcept
+	{
+		MultiplyMatrixDispatch(lhs, rhs, rhsIndices, outMatrices, count);
+	}
+
+	void InverseTransposeBatch(
+		const Matrix4x4* matrices,
+		Matrix4x4* outMatrices,
+		Core::uint32 count
+	) noexcept
+	{
+		InverseTransposeDispatch(matrices, outMatrices, count);
+	}
+
+	void ComposeTRSBatch(
+		const Vector3* positions,
+		const Quaternion* rotations,
+		const Vector3* scales,
+		Matrix3x4* outMatrices,
+		Core::uint32 count
+	) noexcept
+	{
+		ComposeTRSDispatch(positions, rotations, scales, outMatrices, count);
+	}
+
+	void MultiplyMatrixBatch(
+		const Matrix3x4* lhs,
+		const Matrix3x4* rhs,
+		Matrix3x4* outMatrices,
+		Core::uint32 count
+	) noexcept
+	{
+		MultiplyMatrixDispatch(lhs, rhs, nullptr, outMatrices, count);
+	}
+
+	void MultiplyMatrixBatchIndexed(
+		const Matrix3x4* lhs,
+		const Matrix3x4* rhs,
+		const Core::uint32* rhsIndices,
+		Matrix3x4* outMatrices,
+		Core::uint32 count
+	) noexcept
+	{
+		MultiplyMatrixDispatch(lhs, rhs, rhsIndices, outMatrices, count);
+	}
+
+	void InverseTransposeBatch(
+		const Matrix3x4* matrices,
+		Matrix3x4* outMatrices,
+		Core::uint32 count
+	) noexcept
+	{
+		InverseTransposeDispatch(matrices, outMatrices, count);
+	}
+
+	Core::uint32 FrustumCullBatch(
+		const Frustum& frustum,
+		const AABB* boxes,
+		Core::uint8* outVisible,
+		Core::uint32 count
+	) noexcept
+	{
+		switch (GetSimdLevel())
+		{
+#if MATH_BATCH_X86
+		case SimdLevel::AVX2:
+			return Internal::FrustumCullBatchAVX2(frustum, boxes, outVisible, count);
+		case SimdLevel::SSE2:
+			return Internal::FrustumCullBatchSSE2(frustum, boxes, outVisible, count);
+#endif
+		default:
+		{
+			Core::uint32 visibleCount = 0;
+			for (Core::uint32 i = 0; i < count; ++i)
+			{
+				const bool visible = Internal::FrustumCullScalar(frustum, boxes[i]);
+				outVisible[i] = visible ? 1 : 0;
+				visibleCount += visible ? 1 : 0;
+			}
+			return visibleCount;
+		}
+		}
+	}
+
+#if MATH_BATCH_X86
+	//=============================================================================
+	// SSE2 경로 (4-wide)
+	//=============================================================================
+
+	namespace Internal
+	{
+		namespace
+		{
+			struct Float4
+			{
+				__m128 v;
+
+				Float4() = default;
+				Float4(__m128 value) : v(value) {}
+				explicit Float4(Core::float32 scalar) : v(_mm_set1_ps(scalar)) {}
+			};
+
+			inline Float4 operator+(Float4 a, Float4 b) { return _mm_add_ps(a.v, b.v); }
+			inline Float4 operator-(Float4 a, Float4 b) { return _mm_sub_ps(a.v, b.v); }
+			inline Float4 operator*(Float4 a, Float4 b) { return _mm_mul_ps(a.v, b.v); }
+			inline Float4 operator/(Float4 a, Float4 b) { return _mm_div_ps(a.v, b.v); }
+			inline Float4 Min(Float4 a, Float4 b) { return _mm_min_ps(a.v, b.v); }
+
+			// 원소 4개의 행 row를 레인 배열 lanes[4]로 전치 (lanes[c] = 원소 0~3의 (row, c))
+			template<typename M>
+			inline void LoadMatrixRowLanes(const M* matrices, int row, Float4* lanes)
+			{
+				__m128 r0 = _mm_loadu_ps(matrices[0].m[row]);
+				__m128 r1 = _mm_loadu_ps(matrices[1].m[row]);
+				__m128 r2 = _mm_loadu_ps(matrices[2].m[row]);
+				__m128 r3 = _mm_loadu_ps(matrices[3].m[row]);
+				_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+				lanes[0] = r0;
+				lanes[1] = r1;
+				lanes[2] = r2;
+				lanes[3] = r3;
+			}
+
+			// LoadMatrixRowLanes의 역변환
+			template<typename M>
+			inline void StoreMatrixRowLanes(const Float4* lanes, int row, M* matrices)
+			{
+				__m128 r0 = lanes[0].v;
+				__m128 r1 = lanes[1].v;
+				__m128 r2 = lanes[2].v;
+				__m128 r3 = lanes[3].v;
+				_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+				_mm_storeu_ps(matrices[0].m[row], r0);
+				_mm_storeu_ps(matrices[1].m[row], r1);
+				_mm_storeu_ps(matrices[2].m[row], r2);
+				_mm_storeu_ps(matrices[3].m[row], r3);
+			}
+
+			template<typename M>
+			void ComposeTRSBatchSSE2Impl(
+				const Vector3* positions,
+				const Quaternion* rotations,
+				const Vector3* scales,
+				M* outMatrices,
+				Core::uint32 count
+			) noexcept
+			{
+				constexpr int rows = MATRIX_ROWS<M>;
+
+				Core::uint32 i = 0;
+				for (; i + 4 <= count; i += 4)
+				{
+					const Vector3* p = positions + i;
+					const Vector3* s = scales + i;
+
+					const Float4 position[3] = {
+						_mm_setr_ps(p[0].x, p[1].x, p[2].x, p[3].x),
+						_mm_setr_ps(p[0].y, p[1].y, p[2].y, p[3].y),
+						_mm_setr_ps(p[0].z, p[1].z, p[2].z, p[3].z)
+					};
+					const Float4 scale[3] = {
+						_mm_setr_ps(s[0].x, s[1].x, s[2].x, s[3].x),
+						_mm_setr_ps(s[0].y, s[1].y, s[2].y, s[3].y),
+						_mm_setr_ps(s[0].z, s[1].z, s[2].z, s[3].z)
+					};
+
+					__m128 q0 = _mm_loadu_ps(&rotations[i + 0].x);
+					__m128 q1 = _mm_loadu_ps(&rotations[i + 1].x);
+					__m128 q2 = _mm_loadu_ps(&rotations[i + 2].x);
+					__m128 q3 = _mm_loadu_ps(&rotations[i + 3].x);
+					_MM_TRANSPOSE4_PS(q0, q1, q2, q3);
+					const Float4 rotation[4] = { q0, q1, q2, q3 };
+
+					Float4 result[rows * 4];
+					ComposeLanes(position, rotation, scale, result, outMatrices);
+
+					for (int row = 0; row < rows; ++row)
+					{
+						StoreMatrixRowLanes(result + row * 4, row, outMatrices + i);
+					}
+				}
+
+				for (; i < count; ++i)
+				{
+					ComposeTRSScalar(positions[i], rotations[i], scales[i], outMatrices[i]);
+				}
+			}
+
+			template<typename M>
+			void InverseTransposeBatchSSE2Impl(
+				const M* matrices,
+				M* outMatrices,
+				Core::uint32 count
+			) noexcept
+			{
+				constexpr int rows = MATRIX_ROWS<M>;
+
+				Core::uint32 i = 0;
+				for (; i + 4 <= count; i += 4)
+				{
+					Float4 source[rows * 4];
+					for (int row = 0; row < rows; ++row)
+					{
+						LoadMatrixRowLanes(matrices + i, row, source + row * 4);
+					}
+
+					Float4 result[rows * 4];
+					InverseTransposeLanes(source, result, outMatrices);
+
+					for (int row = 0; row < rows; ++row)
+					{
+						StoreMatrixRowLanes(result + row * 4, row, outMatrices + i);
+					}
+				}
+
+				for (; i < count; ++i)
+				{
+					InverseTransposeScalar(matrices[i], outMatrices[i]);
+				}
+			}
+		}
+
+		void ComposeTRSBatchSSE2(
+			const Vector3* positions,
+			const Quaternion* rotations,
+			const Vector3* scales,
+			Matrix4x4* outMatrices,
+			Core::uint32 count
+		) noexcept
+		{
+			ComposeTRSBatchSSE2Impl(positions, rotations, scales, outMatrices, count);
+		}
+
+		void ComposeTRSBatchSSE2(
+			const Vector3* positions,
+			const Quaternion* rotations,
+			const Vector3* scales,
+			Matrix3x4* outMatrices,
+			Core::uint32 count
+		) noexcept
+		{
+			ComposeTRSBatchSSE2Impl(positions, rotations, scales, outMatrices, count);
+		}
+
+		void MultiplyMatrixBatchSSE2(
+			const Matrix4x4* lhs,
+			const Matrix4x4* rhs,
+			const Core::uint32* rhsIndices,
+			Matrix4x4* outMatrices,
+			Core::uint32 count
+		) noexcept
+		{
+			// 행렬 하나씩 순서대로 처리 (rhsIndices가 앞쪽 결과를 참조할 수 있음)
+			for (Core::uint32 i = 0; i < count; ++i)
+			{
+				const Matrix4x4& b = rhsIndices ? rhs[rhsIndices[i]] : rhs[i];
+				const __m128 b0 = _mm_loadu_ps(b.m[0]);
+				const __m128 b1 = _mm_loadu_ps(b.m[1]);
+				const __m128 b2 = _mm_loadu_ps(b.m[2]);
+				const __m128 b3 = _mm_loadu_ps(b.m[3]);
+
+				__m128 rows[4];
+				for (int row = 0; row < 4; ++row)
+				{
+					const __m128 a = _mm_loadu_ps(lhs[i].m[row]);
+					__m128 r = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+					r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+					r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+					r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+					rows[row] = r;
+				}
+
+				for (int row = 0; row < 4; ++row)
+				{
+					_mm_storeu_ps(outMatrices[i].m[row], rows[row]);
+				}
+			}
+		}
+
+		void MultiplyMatrixBatchSSE2(
+			const Matrix3x4* lhs,
+			const Matrix3x4* rhs,
+			const Core::uint32* rhsIndices,
+			Matrix3x4* outMatrices,
+			Core::uint32 count
+		) noexcept
+		{
+			// 행 r = rhs[r].xyz로 lhs 행들을 섞고, 생략된 (0, 0, 0, 1) 행의 기여분 (0, 0, 0, rhs[r].w)를 더함
+			const __m128 wMask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+
+			for (Core::uint32 i = 0; i < count; ++i)
+			{
+				const Matrix3x4& b = rhsIndices ? rhs[rhsIndices[i]] : rhs[i];
+				const __m128 a0 = _mm_loadu_ps(lhs[i].m[0]);
+				const __m128 a1 = _mm_loadu_ps(lhs[i].m[1]);
+				const __m128 a2 = _mm_loadu_ps(lhs[i].m[2]);
+
+				__m128 rows[3];
+				for (int row = 0; row < 3; ++row)
+				{
+					const __m128 bRow = _mm_loadu_ps(b.m[row]);
+					__m128 r = _mm_mul_ps(_mm_shuffle_ps(bRow, bRow, _MM_SHUFFLE(0, 0, 0, 0)), a0);
+					r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(bRow, bRow, _MM_SHUFFLE(1, 1, 1, 1)), a1));
+					r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(bRow, bRow, _MM_SHUFFLE(2, 2, 2, 2)), a2));
+					r = _mm_add_ps(r, _mm_and_ps(bRow, wMask));
+					rows[row] = r;
+				}
+
+				for (int row = 0; row < 3; ++row)
+				{
+					_mm_storeu_ps(outMatrices[i].m[row], rows[row]);
+				}
+			}
+		}
+
+		void InverseTransposeBatchSSE2(
+			const Matrix4x4* matrices,
+			Matrix4x4* outMatrices,
+			Core::uint32 count
+		) noexcept
+		{
+			InverseTransposeBatchSSE2Impl(matrices, outMatrices, count);
+		}
+
+		void InverseTransposeBatchSSE2(
+			const Matrix3x4* matrices,
+			Matrix3x4* outMatrices,
+			Core::uint32 count
+		) noexcept
+		{
+			InverseTransposeBatchSSE2Impl(matrices, outMatrices, count);
+		}
+
+		Core::uint32 FrustumCullBatchSSE2(
+			const Frustum& frustum,
+			const AABB* boxes,
+			Core::uint8* outVisible,
+			Core::uint32 count
+		) noexcept
+		{
+			const __m128 zero = _mm_setzero_ps();
+			Core::uint32 visibleCount = 0;
+
+			Core::uint32 i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const AABB* b = boxes + i;
+
+				const Float4 center[3] = {
+					_mm_setr_ps(b[0].center.x, b[1].center.x, b[2].center.x, b[3].center.x),
+					_mm_setr_ps(b[0].center.y, b[1].center.y, b[2].center.y, b[3].center.y),
+					_mm_setr_ps(b[0].center.z, b[1].center.z, b[2].center.z, b[3].center.z)
+				};
+				const Float4 extents[3] = {
+					_mm_setr_ps(b[0].extents.x, b[1].extents.x, b[2].extents.x, b[3].extents.x),
+					_mm_setr_ps(b[0].extents.y, b[1].extents.y, b[2].extents.y, b[3].extents.y),
+					_mm_setr_ps(b[0].extents.z, b[1].extents.z, b[2].extents.z, b[3].extents.z)
+				};
+
+				const Float4 distance = FrustumDistanceLanes(frustum, center, extents);
+				const int mask = _mm_movemask_ps(_mm_cmpge_ps(distance.v, zero));
+
+				for (int lane = 0; lane < 4; ++lane)
+				{
+					const Core::uint8 visible = static_cast<Core::uint8>((mask >> lane) & 1);
+					outVisible[i + lane] = visible;
+					visibleCount += visible;
+				}
+			}
+
+			for (; i < count; ++i)
+			{
+				const bool visible = FrustumCullScalar(frustum, boxes[i]);
+				outVisible[i] = visible ? 1 : 0;
+				visibleCount += visible ? 1 : 0;
+			}
+
+			return visibleCount;
+		}
+	}
+#endif
+
+} // namespace Math
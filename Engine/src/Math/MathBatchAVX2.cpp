@@ -0,0 +1,332 @@
+﻿// 이 파일은 AVX2 명령어로 컴파일됨 (MSVC: 파일별 /arch:AVX2, GCC: 아래 pragma)
+// GetSupportedSimdLevel()이 AVX2를 반환할 때만 호출됨
+// pragma는 레인 커널 템플릿까지 같은 대상으로 컴파일되도록 모든 include보다 앞에 둠
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__AVX2__) && (defined(__x86_64__) || defined(__i386__))
+#pragma GCC target("avx2")
+#endif
+
+#include "Math/MathBatch.h"
+#include "MathBatchKernels.h"
+
+#if MATH_BATCH_X86
+
+#include <immintrin.h>
+
+namespace Math::Internal
+{
+	namespace
+	{
+		struct Float8
+		{
+			__m256 v;
+
+			Float8() = default;
+			Float8(__m256 value) : v(value) {}
+			explicit Float8(Core::float32 scalar) : v(_mm256_set1_ps(scalar)) {}
+		};
+
+		inline Float8 operator+(Float8 a, Float8 b) { return _mm256_add_ps(a.v, b.v); }
+		inline Float8 operator-(Float8 a, Float8 b) { return _mm256_sub_ps(a.v, b.v); }
+		inline Float8 operator*(Float8 a, Float8 b) { return _mm256_mul_ps(a.v, b.v); }
+		inline Float8 operator/(Float8 a, Float8 b) { return _mm256_div_ps(a.v, b.v); }
+		inline Float8 Min(Float8 a, Float8 b) { return _mm256_min_ps(a.v, b.v); }
+
+		// 128비트 절반마다 독립적으로 4x4 전치
+		inline void TransposeHalves(__m256& r0, __m256& r1, __m256& r2, __m256& r3)
+		{
+			const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+			const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+			const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+			const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+			r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+			r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+			r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+			r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+		}
+
+		// 아래 절반 = 원소 k, 위 절반 = 원소 k + 4
+		inline __m256 LoadPair(const Core::float32* low, const Core::float32* high)
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(high), 1);
+		}
+
+		inline void StorePair(__m256 value, Core::float32* low, Core::float32* high)
+		{
+			_mm_storeu_ps(low, _mm256_castps256_ps128(value));
+			_mm_storeu_ps(high, _mm256_extractf128_ps(value, 1));
+		}
+
+		// 원소 8개의 행 row를 레인 배열 lanes[4]로 전치 (lanes[c] = 원소 0~7의 (row, c))
+		template<typename M>
+		inline void LoadMatrixRowLanes(const M* matrices, int row, Float8* lanes)
+		{
+			__m256 r0 = LoadPair(matrices[0].m[row], matrices[4].m[row]);
+			__m256 r1 = LoadPair(matrices[1].m[row], matrices[5].m[row]);
+			__m256 r2 = LoadPair(matrices[2].m[row], matrices[6].m[row]);
+			__m256 r3 = LoadPair(matrices[3].m[row], matrices[7].m[row]);
+			TransposeHalves(r0, r1, r2, r3);
+			lanes[0] = r0;
+			lanes[1] = r1;
+			lanes[2] = r2;
+			lanes[3] = r3;
+		}
+
+		// LoadMatrixRowLanes의 역변환
+		template<typename M>
+		inline void StoreMatrixRowLanes(const Float8* lanes, int row, M* matrices)
+		{
+			__m256 r0 = lanes[0].v;
+			__m256 r1 = lanes[1].v;
+			__m256 r2 = lanes[2].v;
+			__m256 r3 = lanes[3].v;
+			TransposeHalves(r0, r1, r2, r3);
+			StorePair(r0, matrices[0].m[row], matrices[4].m[row]);
+			StorePair(r1, matrices[1].m[row], matrices[5].m[row]);
+			StorePair(r2, matrices[2].m[row], matrices[6].m[row]);
+			StorePair(r3, matrices[3].m[row], matrices[7].m[row]);
+		}
+
+		template<typename M>
+		void ComposeTRSBatchAVX2Impl(
+			const Vector3* positions,
+			const Quaternion* rotations,
+			const Vector3* scales,
+			M* outMatrices,
+			Core::uint32 count
+		) noexcept
+		{
+			constexpr int rows = MATRIX_ROWS<M>;
+
+			Core::uint32 i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const Vector3* p = positions + i;
+				const Vector3* s = scales + i;
+
+				const Float8 position[3] = {
+					_mm256_setr_ps(p[0].x, p[1].x, p[2].x, p[3].x, p[4].x, p[5].x, p[6].x, p[7].x),
+					_mm256_setr_ps(p[0].y, p[1].y, p[2].y, p[3].y, p[4].y, p[5].y, p[6].y, p[7].y),
+					_mm256_setr_ps(p[0].z, p[1].z, p[2].z, p[3].z, p[4].z, p[5].z, p[6].z, p[7].z)
+				};
+				const Float8 scale[3] = {
+					_mm256_setr_ps(s[0].x, s[1].x, s[2].x, s[3].x, s[4].x, s[5].x, s[6].x, s[7].x),
+					_mm256_setr_ps(s[0].y, s[1].y, s[2].y, s[3].y, s[4].y, s[5].y, s[6].y, s[7].y),
+					_mm256_setr_ps(s[0].z, s[1].z, s[2].z, s[3].z, s[4].z, s[5].z, s[6].z, s[7].z)
+				};
+
+				const Quaternion* q = rotations + i;
+				__m256 q0 = LoadPair(&q[0].x, &q[4].x);
+				__m256 q1 = LoadPair(&q[1].x, &q[5].x);
+				__m256 q2 = LoadPair(&q[2].x, &q[6].x);
+				__m256 q3 = LoadPair(&q[3].x, &q[7].x);
+				TransposeHalves(q0, q1, q2, q3);
+				const Float8 rotation[4] = { q0, q1, q2, q3 };
+
+				Float8 result[rows * 4];
+				ComposeLanes(position, rotation, scale, result, outMatrices);
+
+				for (int row = 0; row < rows; ++row)
+				{
+					StoreMatrixRowLanes(result + row * 4, row, outMatrices + i);
+				}
+			}
+
+			for (; i < count; ++i)
+			{
+				ComposeTRSScalar(positions[i], rotations[i], scales[i], outMatrices[i]);
+			}
+		}
+
+		template<typename M>
+		void InverseTransposeBatchAVX2Impl(
+			const M* matrices,
+			M* outMatrices,
+			Core::uint32 count
+		) noexcept
+		{
+			constexpr int rows = MATRIX_ROWS<M>;
+
+			Core::uint32 i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				Float8 source[rows * 4];
+				for (int row = 0; row < rows; ++row)
+				{
+					LoadMatrixRowLanes(matrices + i, row, source + row * 4);
+				}
+
+				Float8 result[rows * 4];
+				InverseTransposeLanes(source, result, outMatrices);
+
+				for (int row = 0; row < rows; ++row)
+				{
+					StoreMatrixRowLanes(result + row * 4, row, outMatrices + i);
+				}
+			}
+
+			for (; i < count; ++i)
+			{
+				InverseTransposeScalar(matrices[i], outMatrices[i]);
+			}
+		}
+	}
+
+	void ComposeTRSBatchAVX2(
+		const Vector3* positions,
+		const Quaternion* rotations,
+		const Vector3* scales,
+		Matrix4x4* outMatrices,
+		Core::uint32 count
+	) noexcept
+	{
+		ComposeTRSBatchAVX2Impl(positions, rotations, scales, outMatrices, count);
+	}
+
+	void ComposeTRSBatchAVX2(
+		const Vector3* positions,
+		const Quaternion* rotations,
+		const Vector3* scales,
+		Matrix3x4* outMatrices,
+		Core::uint32 count
+	) noexcept
+	{
+		ComposeTRSBatchAVX2Impl(positions, rotations, scales, outMatrices, count);
+	}
+
+	void MultiplyMatrixBatchAVX2(
+		const Matrix4x4* lhs,
+		const Matrix4x4* rhs,
+		const Core::uint32* rhsIndices,
+		Matrix4x4* outMatrices,
+		Core::uint32 count
+	) noexcept
+	{
+		// 행렬 하나씩 순서대로 처리 (rhsIndices가 앞쪽 결과를 참조할 수 있음)
+		// 256비트 레지스터 하나에 lhs의 두 행을 담아 SSE2 경로와 같은 연산을 두 행씩 수행
+		for (Core::uint32 i = 0; i < count; ++i)
+		{
+			const Matrix4x4& b = rhsIndices ? rhs[rhsIndices[i]] : rhs[i];
+			const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b.m[0]));
+			const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b.m[1]));
+			const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b.m[2]));
+			const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b.m[3]));
+
+			__m256 rows[2];
+			for (int half = 0; half < 2; ++half)
+			{
+				const __m256 a = _mm256_loadu_ps(lhs[i].m[half * 2]);
+				__m256 r = _mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+				r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+				r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+				r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+				rows[half] = r;
+			}
+
+			_mm256_storeu_ps(outMatrices[i].m[0], rows[0]);
+			_mm256_storeu_ps(outMatrices[i].m[2], rows[1]);
+		}
+	}
+
+	void MultiplyMatrixBatchAVX2(
+		const Matrix3x4* lhs,
+		const Matrix3x4* rhs,
+		const Core::uint32* rhsIndices,
+		Matrix3x4* outMatrices,
+		Core::uint32 count
+	) noexcept
+	{
+		// 행 0~1은 256비트 레지스터 하나로, 행 2는 128비트로 SSE2 경로와 같은 연산 수행
+		const __m256 wMask = _mm256_castsi256_ps(_mm256_setr_epi32(0, 0, 0, -1, 0, 0, 0, -1));
+
+		for (Core::uint32 i = 0; i < count; ++i)
+		{
+			const Matrix3x4& b = rhsIndices ? rhs[rhsIndices[i]] : rhs[i];
+			const __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs[i].m[0]));
+			const __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs[i].m[1]));
+			const __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs[i].m[2]));
+
+			const __m256 b01 = _mm256_loadu_ps(b.m[0]);
+			__m256 r01 = _mm256_mul_ps(_mm256_permute_ps(b01, _MM_SHUFFLE(0, 0, 0, 0)), a0);
+			r01 = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_permute_ps(b01, _MM_SHUFFLE(1, 1, 1, 1)), a1));
+			r01 = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_permute_ps(b01, _MM_SHUFFLE(2, 2, 2, 2)), a2));
+			r01 = _mm256_add_ps(r01, _mm256_and_ps(b01, wMask));
+
+			const __m128 b2 = _mm_loadu_ps(b.m[2]);
+			__m128 r2 = _mm_mul_ps(_mm_permute_ps(b2, _MM_SHUFFLE(0, 0, 0, 0)), _mm256_castps256_ps128(a0));
+			r2 = _mm_add_ps(r2, _mm_mul_ps(_mm_permute_ps(b2, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_castps256_ps128(a1)));
+			r2 = _mm_add_ps(r2, _mm_mul_ps(_mm_permute_ps(b2, _MM_SHUFFLE(2, 2, 2, 2)), _mm256_castps256_ps128(a2)));
+			r2 = _mm_add_ps(r2, _mm_and_ps(b2, _mm256_castps256_ps128(wMask)));
+
+			_mm256_storeu_ps(outMatrices[i].m[0], r01);
+			_mm_storeu_ps(outMatrices[i].m[2], r2);
+		}
+	}
+
+	void InverseTransposeBatchAVX2(
+		const Matrix4x4* matrices,
+		Matrix4x4* outMatrices,
+		Core::uint32 count
+	) noexcept
+	{
+		InverseTransposeBatchAVX2Impl(matrices, outMatrices, count);
+	}
+
+	void InverseTransposeBatchAVX2(
+		const Matrix3x4* matrices,
+		Matrix3x4* outMatrices,
+		Core::uint32 count
+	) noexcept
+	{
+		InverseTransposeBatchAVX2Impl(matrices, outMatrices, count);
+	}
+
+	Core::uint32 FrustumCullBatchAVX2(
+		const Frustum& frustum,
+		const AABB* boxes,
+		Core::uint8* outVisible,
+		Core::uint32 count
+	) noexcept
+	{
+		const __m256 zero = _mm256_setzero_ps();
+		Core::uint32 visibleCount = 0;
+
+		Core::uint32 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const AABB* b = boxes + i;
+
+			const Float8 center[3] = {
+				_mm256_setr_ps(b[0].center.x, b[1].center.x, b[2].center.x, b[3].center.x, b[4].center.x, b[5].center.x, b[6].center.x, b[7].center.x),
+				_mm256_setr_ps(b[0].center.y, b[1].center.y, b[2].center.y, b[3].center.y, b[4].center.y, b[5].center.y, b[6].center.y, b[7].center.y),
+				_mm256_setr_ps(b[0].center.z, b[1].center.z, b[2].center.z, b[3].center.z, b[4].center.z, b[5].center.z, b[6].center.z, b[7].center.z)
+			};
+			const Float8 extents[3] = {
+				_mm256_setr_ps(b[0].extents.x, b[1].extents.x, b[2].extents.x, b[3].extents.x, b[4].extents.x, b[5].extents.x, b[6].extents.x, b[7].extents.x),
+				_mm256_setr_ps(b[0].extents.y, b[1].extents.y, b[2].extents.y, b[3].extents.y, b[4].extents.y, b[5].extents.y, b[6].extents.y, b[7].extents.y),
+				_mm256_setr_ps(b[0].extents.z, b[1].extents.z, b[2].extents.z, b[3].extents.z, b[4].extents.z, b[5].extents.z, b[6].extents.z, b[7].extents.z)
+			};
+
+			const Float8 distance = FrustumDistanceLanes(frustum, center, extents);
+			const int mask = _mm256_movemask_ps(_mm256_cmp_ps(distance.v, zero, _CMP_GE_OQ));
+
+			for (int lane = 0; lane < 8; ++lane)
+			{
+				const Core::uint8 visible = static_cast<Core::uint8>((mask >> lane) & 1);
+				outVisible[i + lane] = visible;
+				visibleCount += visible;
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			const bool visible = FrustumCullScalar(frustum, boxes[i]);
+			outVisible[i] = visible ? 1 : 0;
+			visibleCount += visible ? 1 : 0;
+		}
+
+		return visibleCount;
+	}
+
+} // namespace Math::Internal
+
+#endif
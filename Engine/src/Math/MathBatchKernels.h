@@ -0,0 +1,346 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Math/MathBatch.h"
+#include "Math/MathTypes.h"
+#include <cmath>
+#include <cstring>
+
+// SIMD 경로는 x86/x64에서만 사용 (그 외 플랫폼은 스칼라 폴백)
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define MATH_BATCH_X86 1
+#else
+#define MATH_BATCH_X86 0
+#endif
+
+namespace Math::Internal
+{
+	// 아래 inline 함수들은 AVX2로 컴파일되는 파일에도 포함되므로 내부 링크로 둠
+	// (외부 링크면 링커가 AVX2 버전 하나만 남겨 AVX2 미지원 CPU의 스칼라/SSE2 경로에서 쓸 수 있음)
+	namespace
+	{
+		/// 행렬 저장 행 수 (Matrix4x4: 4, Matrix3x4: 3)
+		template<typename M>
+		constexpr int MATRIX_ROWS = static_cast<int>(sizeof(M::m) / sizeof(M::m[0]));
+
+		//=============================================================================
+		// 레인 커널
+		//
+		// V는 float(스칼라), Float4(SSE2), Float8(AVX2) 중 하나입니다.
+		// 레인 하나가 원소 하나를 담당하므로 경로와 무관하게 원소별 연산 순서가 같습니다.
+		// (FMA를 쓰지 않는 이유도 같음: 경로마다 결과가 달라지지 않도록)
+		//=============================================================================
+
+		/**
+		 * @brief S * R 합성 (q[4], s[3] -> 행 우선 3x3 out[9])
+		 */
+		template<typename V>
+		inline void RotationScaleLanes(const V* q, const V* s, V* out)
+		{
+			const V one(1.0f);
+
+			const V x2 = q[0] + q[0];
+			const V y2 = q[1] + q[1];
+			const V z2 = q[2] + q[2];
+
+			const V xx = q[0] * x2;
+			const V yy = q[1] * y2;
+			const V zz = q[2] * z2;
+			const V xy = q[0] * y2;
+			const V xz = q[0] * z2;
+			const V yz = q[1] * z2;
+			const V wx = q[3] * x2;
+			const V wy = q[3] * y2;
+			const V wz = q[3] * z2;
+
+			// 회전 행렬의 각 행에 해당 축 스케일을 곱함
+			out[0] = (one - (yy + zz)) * s[0];
+			out[1] = (xy + wz) * s[0];
+			out[2] = (xz - wy) * s[0];
+
+			out[3] = (xy - wz) * s[1];
+			out[4] = (one - (xx + zz)) * s[1];
+			out[5] = (yz + wx) * s[1];
+
+			out[6] = (xz + wy) * s[2];
+			out[7] = (yz - wx) * s[2];
+			out[8] = (one - (xx + yy)) * s[2];
+		}
+
+		/**
+		 * @brief S * R * T 합성 (p[3], q[4], s[3] -> 행 우선 out[16])
+		 */
+		template<typename V>
+		inline void ComposeTRSLanes(const V* p, const V* q, const V* s, V* out)
+		{
+			V rs[9];
+			RotationScaleLanes(q, s, rs);
+
+			const V zero(0.0f);
+			for (int row = 0; row < 3; ++row)
+			{
+				out[row * 4 + 0] = rs[row * 3 + 0];
+				out[row * 4 + 1] = rs[row * 3 + 1];
+				out[row * 4 + 2] = rs[row * 3 + 2];
+				out[row * 4 + 3] = zero;
+			}
+
+			// 마지막 행에 이동
+			out[12] = p[0];
+			out[13] = p[1];
+			out[14] = p[2];
+			out[15] = V(1.0f);
+		}
+
+		/**
+		 * @brief S * R * T 합성 (p[3], q[4], s[3] -> Matrix3x4 배치 out[12])
+		 * @note 값은 ComposeTRSLanes 결과를 전치한 것과 같음 (out[r * 4 + c] = M[c][r])
+		 */
+		template<typename V>
+		inline void ComposeTRSAffineLanes(const V* p, const V* q, const V* s, V* out)
+		{
+			V rs[9];
+			RotationScaleLanes(q, s, rs);
+
+			for (int row = 0; row < 3; ++row)
+			{
+				out[row * 4 + 0] = rs[row];
+				out[row * 4 + 1] = rs[3 + row];
+				out[row * 4 + 2] = rs[6 + row];
+				out[row * 4 + 3] = p[row];
+			}
+		}
+
+		/**
+		 * @brief 역전치 행렬 (행 우선 a[16] -> out[16])
+		 *
+		 * 2x2 소행렬식으로 여인수 행렬을 구한 뒤 행렬식으로 나눕니다.
+		 * (역행렬 = 여인수 행렬의 전치 / 행렬식 이므로, 역전치 = 여인수 행렬 / 행렬식)
+		 */
+		template<typename V>
+		inline void InverseTransposeLanes(const V* a, V* out)
+		{
+			const V s0 = a[0] * a[5] - a[4] * a[1];
+			const V s1 = a[0] * a[6] - a[4] * a[2];
+			const V s2 = a[0] * a[7] - a[4] * a[3];
+			const V s3 = a[1] * a[6] - a[5] * a[2];
+			const V s4 = a[1] * a[7] - a[5] * a[3];
+			const V s5 = a[2] * a[7] - a[6] * a[3];
+
+			const V c5 = a[10] * a[15] - a[14] * a[11];
+			const V c4 = a[9] * a[15] - a[13] * a[11];
+			const V c3 = a[9] * a[14] - a[13] * a[10];
+			const V c2 = a[8] * a[15] - a[12] * a[11];
+			const V c1 = a[8] * a[14] - a[12] * a[10];
+			const V c0 = a[8] * a[13] - a[12] * a[9];
+
+			const V det = (((((s0 * c5 - s1 * c4) + s2 * c3) + s3 * c2) - s4 * c1) + s5 * c0);
+			const V invDet = V(1.0f) / det;
+
+			// out[r][c] = inverse[c][r]
+			out[0] = ((a[5] * c5 - a[6] * c4) + a[7] * c3) * invDet;
+			out[4] = ((a[2] * c4 - a[1] * c5) - a[3] * c3) * invDet;
+			out[8] = ((a[13] * s5 - a[14] * s4) + a[15] * s3) * invDet;
+			out[12] = ((a[10] * s4 - a[9] * s5) - a[11] * s3) * invDet;
+
+			out[1] = ((a[6] * c2 - a[4] * c5) - a[7] * c1) * invDet;
+			out[5] = ((a[0] * c5 - a[2] * c2) + a[3] * c1) * invDet;
+			out[9] = ((a[14] * s2 - a[12] * s5) - a[15] * s1) * invDet;
+			out[13] = ((a[8] * s5 - a[10] * s2) + a[11] * s1) * invDet;
+
+			out[2] = ((a[4] * c4 - a[5] * c2) + a[7] * c0) * invDet;
+			out[6] = ((a[1] * c2 - a[0] * c4) - a[3] * c0) * invDet;
+			out[10] = ((a[12] * s4 - a[13] * s2) + a[15] * s0) * invDet;
+			out[14] = ((a[9] * s2 - a[8] * s4) - a[11] * s0) * invDet;
+
+			out[3] = ((a[5] * c1 - a[4] * c3) - a[6] * c0) * invDet;
+			out[7] = ((a[0] * c3 - a[1] * c1) + a[2] * c0) * invDet;
+			out[11] = ((a[13] * s1 - a[12] * s3) - a[14] * s0) * invDet;
+			out[15] = ((a[8] * s3 - a[9] * s1) + a[10] * s0) * invDet;
+		}
+
+		/**
+		 * @brief 3x3 부분의 역전치 (Matrix3x4 배치 a[12] -> out[12], 이동은 0)
+		 *
+		 * 여인수 행렬의 각 행은 원래 행렬의 다른 두 행의 외적입니다.
+		 * (역전치 = 여인수 행렬 / 행렬식)
+		 */
+		template<typename V>
+		inline void InverseTransposeAffineLanes(const V* a, V* out)
+		{
+			// 행렬 M의 원소 (a는 M의 열을 행으로 저장)
+			const V m00 = a[0], m01 = a[4], m02 = a[8];
+			const V m10 = a[1], m11 = a[5], m12 = a[9];
+			const V m20 = a[2], m21 = a[6], m22 = a[10];
+
+			const V c00 = m11 * m22 - m12 * m21;
+			const V c01 = m12 * m20 - m10 * m22;
+			const V c02 = m10 * m21 - m11 * m20;
+
+			const V c10 = m21 * m02 - m22 * m01;
+			const V c11 = m22 * m00 - m20 * m02;
+			const V c12 = m20 * m01 - m21 * m00;
+
+			const V c20 = m01 * m12 - m02 * m11;
+			const V c21 = m02 * m10 - m00 * m12;
+			const V c22 = m00 * m11 - m01 * m10;
+
+			const V det = (m00 * c00 + m01 * c01) + m02 * c02;
+			const V invDet = V(1.0f) / det;
+			const V zero(0.0f);
+
+			// out[r][c] = cofactor[c][r] / det
+			out[0] = c00 * invDet;
+			out[1] = c10 * invDet;
+			out[2] = c20 * invDet;
+			out[3] = zero;
+
+			out[4] = c01 * invDet;
+			out[5] = c11 * invDet;
+			out[6] = c21 * invDet;
+			out[7] = zero;
+
+			out[8] = c02 * invDet;
+			out[9] = c12 * invDet;
+			out[10] = c22 * invDet;
+			out[11] = zero;
+		}
+
+		inline Core::float32 Min(Core::float32 a, Core::float32 b) { return a < b ? a : b; }
+
+		/**
+		 * @brief 평면별 (중심 거리 + 투영 반경)의 최솟값 (중심 c[3], 반 크기 e[3], 음수면 절두체 바깥)
+		 * @note Min은 경로별로 a < b ? a : b 와 같은 의미 (_mm_min_ps 등)
+		 */
+		template<typename V>
+		inline V FrustumDistanceLanes(const Frustum& frustum, const V* c, const V* e)
+		{
+			V result(0.0f);
+			for (Core::uint32 p = 0; p < Frustum::PLANE_COUNT; ++p)
+			{
+				const Vector4& plane = frustum.planes[p];
+				const V distance = ((V(plane.x) * c[0] + V(plane.y) * c[1]) + V(plane.z) * c[2]) + V(plane.w);
+				const V radius = (V(std::abs(plane.x)) * e[0] + V(std::abs(plane.y)) * e[1]) + V(std::abs(plane.z)) * e[2];
+				result = (p == 0) ? (distance + radius) : Min(result, distance + radius);
+			}
+			return result;
+		}
+
+		/// 행렬 형식에 맞는 합성 레인 커널
+		template<typename V>
+		inline void ComposeLanes(const V* p, const V* q, const V* s, V* out, const Matrix4x4*) { ComposeTRSLanes(p, q, s, out); }
+		template<typename V>
+		inline void ComposeLanes(const V* p, const V* q, const V* s, V* out, const Matrix3x4*) { ComposeTRSAffineLanes(p, q, s, out); }
+
+		/// 행렬 형식에 맞는 역전치 레인 커널
+		template<typename V>
+		inline void InverseTransposeLanes(const V* a, V* out, const Matrix4x4*) { InverseTransposeLanes(a, out); }
+		template<typename V>
+		inline void InverseTransposeLanes(const V* a, V* out, const Matrix3x4*) { InverseTransposeAffineLanes(a, out); }
+
+		//=============================================================================
+		// 스칼라 원소 처리 (모든 경로의 나머지 원소 처리에도 사용)
+		//=============================================================================
+
+		inline void ComposeTRSScalar(const Vector3& position, const Quaternion& rotation, const Vector3& scale, Matrix4x4& out) noexcept
+		{
+			const Core::float32 p[3] = { position.x, position.y, position.z };
+			const Core::float32 q[4] = { rotation.x, rotation.y, rotation.z, rotation.w };
+			const Core::float32 s[3] = { scale.x, scale.y, scale.z };
+			ComposeTRSLanes(p, q, s, &out.m[0][0]);
+		}
+
+		inline void ComposeTRSScalar(const Vector3& position, const Quaternion& rotation, const Vector3& scale, Matrix3x4& out) noexcept
+		{
+			const Core::float32 p[3] = { position.x, position.y, position.z };
+			const Core::float32 q[4] = { rotation.x, rotation.y, rotation.z, rotation.w };
+			const Core::float32 s[3] = { scale.x, scale.y, scale.z };
+			ComposeTRSAffineLanes(p, q, s, &out.m[0][0]);
+		}
+
+		inline void InverseTransposeScalar(const Matrix3x4& matrix, Matrix3x4& out) noexcept
+		{
+			Core::float32 result[12];
+			InverseTransposeAffineLanes(&matrix.m[0][0], result);
+			std::memcpy(out.m, result, sizeof(result));
+		}
+
+		inline void InverseTransposeScalar(const Matrix4x4& matrix, Matrix4x4& out) noexcept
+		{
+			Core::float32 result[16];
+			InverseTransposeLanes(&matrix.m[0][0], result);
+			std::memcpy(out.m, result, sizeof(result));
+		}
+
+		inline bool FrustumCullScalar(const Frustum& frustum, const AABB& box) noexcept
+		{
+			const Core::float32 c[3] = { box.center.x, box.center.y, box.center.z };
+			const Core::float32 e[3] = { box.extents.x, box.extents.y, box.extents.z };
+			return FrustumDistanceLanes(frustum, c, e) >= 0.0f;
+		}
+
+		/// 행 r = ((a[r][0] * b[0] + a[r][1] * b[1]) + a[r][2] * b[2]) + a[r][3] * b[3] (SIMD 경로와 같은 순서)
+		inline void MultiplyMatrixScalar(const Matrix4x4& lhs, const Matrix4x4& rhs, Matrix4x4& out) noexcept
+		{
+			Core::float32 result[4][4];
+			for (int row = 0; row < 4; ++row)
+			{
+				for (int col = 0; col < 4; ++col)
+				{
+					result[row][col] =
+						((lhs.m[row][0] * rhs.m[0][col] + lhs.m[row][1] * rhs.m[1][col])
+							+ lhs.m[row][2] * rhs.m[2][col])
+						+ lhs.m[row][3] * rhs.m[3][col];
+				}
+			}
+			std::memcpy(out.m, result, sizeof(result));
+		}
+
+		/**
+		 * @brief 아핀 행렬 곱 out = lhs * rhs (Matrix3x4 배치는 전치 형태이므로 out = rhs' * lhs')
+		 *
+		 * 행 r = ((rhs[r][0] * lhs[0] + rhs[r][1] * lhs[1]) + rhs[r][2] * lhs[2]) + (0, 0, 0, rhs[r][3])
+		 * (생략된 마지막 행 (0, 0, 0, 1)의 기여분, SIMD 경로와 같은 순서)
+		 */
+		inline void MultiplyMatrixScalar(const Matrix3x4& lhs, const Matrix3x4& rhs, Matrix3x4& out) noexcept
+		{
+			Core::float32 result[3][4];
+			for (int row = 0; row < 3; ++row)
+			{
+				for (int col = 0; col < 4; ++col)
+				{
+					result[row][col] =
+						((rhs.m[row][0] * lhs.m[0][col] + rhs.m[row][1] * lhs.m[1][col])
+							+ rhs.m[row][2] * lhs.m[2][col])
+						+ (col == 3 ? rhs.m[row][3] : 0.0f);
+				}
+			}
+			std::memcpy(out.m, result, sizeof(result));
+		}
+	}
+
+	//=============================================================================
+	// 경로별 구현 (MathBatch.cpp: SSE2, MathBatchAVX2.cpp: AVX2)
+	//=============================================================================
+
+#if MATH_BATCH_X86
+	void ComposeTRSBatchSSE2(const Vector3* positions, const Quaternion* rotations, const Vector3* scales, Matrix4x4* outMatrices, Core::uint32 count) noexcept;
+	void MultiplyMatrixBatchSSE2(const Matrix4x4* lhs, const Matrix4x4* rhs, const Core::uint32* rhsIndices, Matrix4x4* outMatrices, Core::uint32 count) noexcept;
+	void InverseTransposeBatchSSE2(const Matrix4x4* matrices, Matrix4x4* outMatrices, Core::uint32 count) noexcept;
+
+	void ComposeTRSBatchAVX2(const Vector3* positions, const Quaternion* rotations, const Vector3* scales, Matrix4x4* outMatrices, Core::uint32 count) noexcept;
+	void MultiplyMatrixBatchAVX2(const Matrix4x4* lhs, const Matrix4x4* rhs, const Core::uint32* rhsIndices, Matrix4x4* outMatrices, Core::uint32 count) noexcept;
+	void InverseTransposeBatchAVX2(const Matrix4x4* matrices, Matrix4x4* outMatrices, Core::uint32 count) noexcept;
+
+	void ComposeTRSBatchSSE2(const Vector3* positions, const Quaternion* rotations, const Vector3* scales, Matrix3x4* outMatrices, Core::uint32 count) noexcept;
+	void MultiplyMatrixBatchSSE2(const Matrix3x4* lhs, const Matrix3x4* rhs, const Core::uint32* rhsIndices, Matrix3x4* outMatrices, Core::uint32 count) noexcept;
+	void InverseTransposeBatchSSE2(const Matrix3x4* matrices, Matrix3x4* outMatrices, Core::uint32 count) noexcept;
+
+	void ComposeTRSBatchAVX2(const Vector3* positions, const Quaternion* rotations, const Vector3* scales, Matrix3x4* outMatrices, Core::uint32 count) noexcept;
+	void MultiplyMatrixBatchAVX2(const Matrix3x4* lhs, const Matrix3x4* rhs, const Core::uint32* rhsIndices, Matrix3x4* outMatrices, Core::uint32 count) noexcept;
+	void InverseTransposeBatchAVX2(const Matrix3x4* matrices, Matrix3x4* outMatrices, Core::uint32 count) noexcept;
+
+	Core::uint32 FrustumCullBatchSSE2(const Frustum& frustum, const AABB* boxes, Core::uint8* outVisible, Core::uint32 count) noexcept;
+	Core::uint32 FrustumCullBatchAVX2(const Frustum& frustum, const AABB* boxes, Core::uint8* outVisible, Core::uint32 count) noexcept;
+#endif
+
+} // namespace Math::Internal
@@ -4,6 +4,7 @@
 #include "Framework/Resources/ResourceId.h"
 #include "Framework/Resources/ResourceManager.h"
 #include "Framework/DebugUI/ECSInspector.h"
+#include "Framework/DebugUI/PerformancePanel.h"
 
 // Core Engine
 #include "Core/Logging/LogMacros.h"
@@ -14,6 +15,7 @@
 #include "Math/MeshUtils.h"
 
 // Platform
+#include "Platform/Input.h"
 #include "Platform/Window.h"
 
 // Graphics
@@ -26,8 +28,10 @@
 #include "Graphics/DX12/DX12Device.h"
 #include "Graphics/DX12/DX12CommandQueue.h"
 #include "Graphics/DX12/DX12Renderer.h"
+#include "Graphics/DebugDraw/DebugRenderer.h"
 
 // ECS
+#include "ECS/Components/BoundsComponent.h"
 #include "ECS/Components/CameraComponent.h"
 #include "ECS/Components/HierarchyComponent.h"
 #include "ECS/Components/LightComponents.h"
@@ -40,6 +44,7 @@
 #include "ECS/Systems/CameraSystem.h"
 #include "ECS/Systems/LightingSystem.h"
 #include "ECS/Systems/RenderSystem.h"
+#include "ECS/Systems/SpatialIndexSystem.h"
 #include "ECS/Systems/TransformSystem.h"
 
 // Standard Library
@@ -94,9 +99,10 @@ void PhongLightingApp::InitializeECS()
 	mSystemManager = std::make_unique<ECS::SystemManager>(*mRegistry);
 
 	// System 등록 (순서 중요!)
-	// Transform → Camera → Lighting → Render
+	// Transform → SpatialIndex → Camera → Lighting → Render
 	// Registry는 SystemManager가 자동으로 전달
 	mSystemManager->RegisterSystem<ECS::TransformSystem>();
+	mSystemManager->RegisterSystem<ECS::SpatialIndexSystem>();
 	mSystemManager->RegisterSystem<ECS::CameraSystem>();
 	mSystemManager->RegisterSystem<ECS::LightingSystem>();
 	mSystemManager->RegisterSystem<ECS::RenderSystem>(mResourceManager.get());
@@ -217,11 +223,12 @@ void PhongLightingApp::CreateCubeEntities()
 
 	// 공유 리소스 생성
 	mSharedMeshId = mResourceManager->CreateMesh("CubeMesh");
-	mSharedMaterialId = mResourceManager->CreateMaterial(
-		"PhongMaterial",
-		L"PhongVS.hlsl",
-		L"PhongPS.hlsl"
-	);
+	// PhongVS는 인스턴스 버퍼를 읽으므로 같은 메시/머티리얼 큐브는 인스턴스 Draw 한 번으로 그려짐
+	Graphics::MaterialDesc phongDesc;
+	phongDesc.vertexShaderPath = L"PhongVS.hlsl";
+	phongDesc.pixelShaderPath = L"PhongPS.hlsl";
+	phongDesc.instancing = true;
+	mSharedMaterialId = mResourceManager->CreateMaterial("PhongMaterial", phongDesc);
 
 	// 그리드 형태로 큐브 배치
 	constexpr Core::int32 gridSize = 4;
@@ -266,6 +273,12 @@ void PhongLightingApp::CreateCubeEntities()
 	SetupSharedMeshData();
 	SetupSharedMaterial();
 
+	// 경계 볼륨은 메시 정점이 올라간 뒤에 계산되므로 마지막에 추가
+	for (ECS::Entity cubeEntity : mCubeEntities)
+	{
+		AddSharedMeshBounds(cubeEntity);
+	}
+
 	LOG_INFO(
 		"[Scene] Created %zu Cubes in %dx%d grid",
 		mCubeEntities.size(),
@@ -426,6 +439,22 @@ void PhongLightingApp::SetupSharedMaterial()
 	LOG_INFO("[Material] Material setup complete");
 }
 
+void PhongLightingApp::AddSharedMeshBounds(ECS::Entity entity)
+{
+	const Graphics::Mesh* mesh = mResourceManager->GetMesh(mSharedMeshId);
+	if (!mesh)
+	{
+		LOG_WARN("[Scene] Shared mesh not found, entity %u will not be culled", entity.id);
+		return;
+	}
+
+	// 월드 경계는 다음 TransformSystem::Update에서 계산됨
+	ECS::BoundsComponent bounds;
+	bounds.localBounds = mesh->GetLocalBounds();
+	bounds.localSphere = mesh->GetLocalSphere();
+	mRegistry->AddComponent(entity, bounds);
+}
+
 void PhongLightingApp::CreateHierarchyTestEntities()
 {
 	LOG_INFO("[Scene] Creating Hierarchy Test Entities (Phase 3.5)...");
@@ -454,6 +483,8 @@ void PhongLightingApp::CreateHierarchyTestEntities()
 		material.materialId = mSharedMaterialId;
 		mRegistry->AddComponent<ECS::MaterialComponent>(mHierarchyParent, material);
 
+		AddSharedMeshBounds(mHierarchyParent);
+
 		// Root Entity로 등록
 		transformSystem->SetParent(mHierarchyParent, ECS::Entity::Invalid());
 	}
@@ -492,6 +523,8 @@ void PhongLightingApp::CreateHierarchyTestEntities()
 		material.materialId = mSharedMaterialId;
 		mRegistry->AddComponent<ECS::MaterialComponent>(child, material);
 
+		AddSharedMeshBounds(child);
+
 		// 부모 설정
 		transformSystem->SetParent(child, mHierarchyParent);
 
@@ -521,6 +554,8 @@ void PhongLightingApp::CreateHierarchyTestEntities()
 		material.materialId = mSharedMaterialId;
 		mRegistry->AddComponent<ECS::MaterialComponent>(mHierarchyGrandChild, material);
 
+		AddSharedMeshBounds(mHierarchyGrandChild);
+
 		// 첫 번째 자식의 자식으로 설정 (2단계 계층)
 		transformSystem->SetParent(mHierarchyGrandChild, mHierarchyChildren[0]);
 	}
@@ -623,6 +658,43 @@ void PhongLightingApp::OnUpdate(Core::float32 deltaTime)
 	// - CameraSystem::Update() → UpdateAllCameras() 자동 호출
 	// - RenderSystem::Update() → FrameData 수집
 	mSystemManager->UpdateSystems(deltaTime);
+
+	// 좌클릭 피킹 (공간 인덱스가 이번 프레임 경계로 갱신된 뒤, ImGui가 마우스를 쓰지 않을 때만)
+	Platform::Input& input = GetWindow()->GetInput();
+	if (input.IsMouseAvailable() && input.IsMouseButtonPressed(Platform::MouseButton::Left))
+	{
+		PickEntityAtCursor(input.GetMousePosition());
+	}
+}
+
+void PhongLightingApp::PickEntityAtCursor(const Math::Vector2& screenPosition)
+{
+	auto* spatialIndex = mSystemManager->GetSystem<ECS::SpatialIndexSystem>();
+	const auto* camera = mRegistry->GetComponent<ECS::CameraComponent>(mCameraEntity);
+	Graphics::DebugRenderer* debugRenderer = GetRenderer()->GetDebugRenderer();
+	if (!spatialIndex || !camera || !debugRenderer)
+	{
+		return;
+	}
+
+	// 스크린 좌표 → NDC → 근/원 평면 위의 월드 좌표
+	const Core::float32 ndcX = screenPosition.x / static_cast<Core::float32>(GetWindow()->GetWidth()) * 2.0f - 1.0f;
+	const Core::float32 ndcY = 1.0f - screenPosition.y / static_cast<Core::float32>(GetWindow()->GetHeight()) * 2.0f;
+	const Math::Matrix4x4 inverseViewProjection = Math::MatrixInverse(camera->viewMatrix * camera->projectionMatrix);
+	const Math::Vector3 nearPoint = Math::Vector3TransformCoord(Math::Vector3(ndcX, ndcY, 0.0f), inverseViewProjection);
+	const Math::Vector3 farPoint = Math::Vector3TransformCoord(Math::Vector3(ndcX, ndcY, 1.0f), inverseViewProjection);
+
+	// 방향 길이가 근평면~원평면 거리이므로 최대 거리 1 = 원평면까지
+	Core::float32 distance = 0.0f;
+	const ECS::Entity picked = spatialIndex->RayCast(nearPoint, farPoint - nearPoint, 1.0f, &distance);
+	if (!picked.IsValid())
+	{
+		debugRenderer->ClearSelectedEntity();
+		return;
+	}
+
+	debugRenderer->SetSelectedEntity(picked);
+	LOG_INFO("[Picking] Entity (id=%u), %.2f units from the near plane", picked.id, distance * (farPoint - nearPoint).Length());
 }
 
 void PhongLightingApp::OnRender()
@@ -632,6 +704,16 @@ void PhongLightingApp::OnRender()
 	{
 		const Graphics::FrameData& frameData = renderSystem->GetFrameData();
 
+		// 컬링 통계 표시
+		if (Framework::PerformancePanel* performancePanel = GetPerformancePanel())
+		{
+			performancePanel->SetRenderStats(
+				frameData.stats.renderableCount,
+				frameData.stats.visibleCount,
+				frameData.stats.culledCount
+			);
+		}
+
 		// RenderFrame() 대신 RenderScene()만 호출
 		// BeginFrame, EndFrame, Present는 Application이 관리
 		GetRenderer()->RenderScene(frameData);
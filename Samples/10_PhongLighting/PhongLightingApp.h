@@ -8,6 +8,7 @@
 #include "Core/Types.h"
 #include "ECS/Entity.h"
 #include "Framework/Resources/ResourceId.h"
+#include "Math/MathTypes.h"
 
 #include <memory>
 #include <vector>
@@ -76,9 +77,15 @@ class PhongLightingApp : public Framework::Application
 	void SetupSharedMeshData();
 	void SetupSharedMaterial();
 
+	// 공유 메시의 로컬 경계를 BoundsComponent로 추가 (절두체 컬링 대상)
+	void AddSharedMeshBounds(ECS::Entity entity);
+
 	// Phase 3.5: 계층 구조 테스트
 	void CreateHierarchyTestEntities();
 
+	// 커서 아래 Entity를 SpatialIndexSystem 반직선 쿼리로 찾아 디버그 렌더러에서 강조
+	void PickEntityAtCursor(const Math::Vector2& screenPosition);
+
 	// ECS
 	std::unique_ptr<ECS::Registry> mRegistry;
 	std::unique_ptr<ECS::SystemManager> mSystemManager;
@@ -7,6 +7,7 @@ cbuffer ObjectConstants : register(b0)
 {
 	float4x4 worldMatrix;
 	float4x4 mvpMatrix;
+	float4x4 normalMatrix; // World 역전치 (비균등 스케일에서도 노멀이 표면에 수직 유지)
 };
 
 cbuffer MaterialConstants : register(b1)
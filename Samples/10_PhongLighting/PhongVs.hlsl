@@ -1,13 +1,18 @@
 // PhongVS.hlsl - Phong Shading Vertex Shader
 // Phase 3.3: Basic Phong Shading (No Normal Mapping)
 
-// Constant Buffers
-cbuffer ObjectConstants : register(b0)
+// Instance Buffer (Graphics::InstanceData와 레이아웃 일치)
+// 렌더러가 배치 시작 원소 주소로 설정하므로 SV_InstanceID가 배치 내 인덱스
+// (MaterialDesc::instancing이 false인 Material은 아이템마다 이 아이템 하나만 가리키도록 설정됨)
+struct InstanceData
 {
 	float4x4 worldMatrix;
 	float4x4 mvpMatrix;
+	float4x4 normalMatrix; // World 역전치 (비균등 스케일에서도 노멀이 표면에 수직 유지)
 };
 
+StructuredBuffer<InstanceData> gInstances : register(t0, space1);
+
 // Input Layout (StandardVertex)
 struct VS_INPUT
 {
@@ -28,9 +33,13 @@ struct VS_OUTPUT
 	float3 Bitangent : BITANGENT;
 };
 
-VS_OUTPUT VSMain(VS_INPUT input)
+VS_OUTPUT VSMain(VS_INPUT input, uint instanceID : SV_InstanceID)
 {
 	VS_OUTPUT output;
+
+	const float4x4 worldMatrix = gInstances[instanceID].worldMatrix;
+	const float4x4 mvpMatrix = gInstances[instanceID].mvpMatrix;
+	const float4x4 normalMatrix = gInstances[instanceID].normalMatrix;
     
     // 1. Clip Space 위치 (미리 계산된 MVP 사용)
 	output.Position = mul(float4(input.Position, 1.0f), mvpMatrix);
@@ -39,8 +48,8 @@ VS_OUTPUT VSMain(VS_INPUT input)
 	output.WorldPos = mul(float4(input.Position, 1.0f), worldMatrix).xyz;
     
     // 3. 월드 노멀 변환
-    // worldMatrix의 3x3 부분만 사용 (회전/스케일만, 평행이동 제외)
-	output.Normal = mul(input.Normal, (float3x3) worldMatrix);
+    // normalMatrix(World 역전치)의 3x3 부분 사용 (균등 스케일이면 CPU에서 worldMatrix를 그대로 넘김)
+	output.Normal = mul(input.Normal, (float3x3) normalMatrix);
 	output.Normal = normalize(output.Normal);
     
     // 4. 월드 Tangent 변환 (Phase 3.3.4)
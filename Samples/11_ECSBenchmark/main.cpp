@@ -0,0 +1,337 @@
+#include "Common/BenchmarkUtils.h"
+#include "ECS/ArchetypeGroup.h"
+#include "ECS/ComponentStorage.h"
+#include "ECS/Registry.h"
+#include "ECS/RegistryView.h"
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+// Benchmark component (TransformComponent-sized POD)
+struct BenchTransform
+{
+    float position[3] = { 0.0f, 0.0f, 0.0f };
+    float rotation[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    float scale[3] = { 1.0f, 1.0f, 1.0f };
+    float padding[6] = {};
+};
+
+struct BenchMesh
+{
+    uint32_t meshId = 0;
+};
+
+struct BenchMaterial
+{
+    uint32_t materialId = 0;
+};
+
+// RenderItem equivalent produced by the gather loop
+struct BenchRenderItem
+{
+    const void* mesh = nullptr;
+    const void* material = nullptr;
+    BenchTransform transform;
+};
+
+// Previous ComponentStorage implementation (unordered_map), kept as a baseline
+template<typename T>
+class MapComponentStorage
+{
+public:
+    T* AddComponent(uint32_t entityId, const T& component)
+    {
+        mComponents[entityId] = component;
+        return &mComponents[entityId];
+    }
+
+    void RemoveComponent(uint32_t entityId) { mComponents.erase(entityId); }
+
+    T* GetComponent(uint32_t entityId)
+    {
+        auto it = mComponents.find(entityId);
+        return (it != mComponents.end()) ? &it->second : nullptr;
+    }
+
+    std::unordered_map<uint32_t, T>& GetAllComponents() { return mComponents; }
+
+private:
+    std::unordered_map<uint32_t, T> mComponents;
+};
+
+void PrintResult(const char* name, double mapMs, double sparseMs)
+{
+    std::cout << "  " << std::left << std::setw(10) << name << std::right
+        << std::fixed << std::setprecision(3)
+        << "map: " << std::setw(9) << mapMs << " ms   "
+        << "sparse set: " << std::setw(9) << sparseMs << " ms   "
+        << "(x" << std::setprecision(2) << (sparseMs > 0.0 ? mapMs / sparseMs : 0.0) << ")"
+        << std::endl;
+}
+
+// Test 1: ComponentStorage add / get / iterate / remove
+void BenchmarkComponentStorage(uint32_t entityCount)
+{
+    std::cout << "Test 1: ComponentStorage (" << entityCount << " entities)" << std::endl;
+
+    // Random access order for Get/Remove
+    std::vector<uint32_t> shuffledIds(entityCount);
+    std::iota(shuffledIds.begin(), shuffledIds.end(), 0u);
+    std::shuffle(shuffledIds.begin(), shuffledIds.end(), std::mt19937(1234));
+
+    MapComponentStorage<BenchTransform> mapStorage;
+    ECS::ComponentStorage<BenchTransform> sparseStorage;
+    volatile float sink = 0.0f;
+
+    // Add
+    double mapAdd = MeasureMs([&]()
+        {
+            for (uint32_t id = 0; id < entityCount; ++id)
+            {
+                mapStorage.AddComponent(id, BenchTransform{});
+            }
+        });
+    double sparseAdd = MeasureMs([&]()
+        {
+            for (uint32_t id = 0; id < entityCount; ++id)
+            {
+                sparseStorage.AddComponent(id, BenchTransform{}, 1);
+            }
+        });
+    PrintResult("Add", mapAdd, sparseAdd);
+
+    // Get (random order)
+    double mapGet = MeasureMs([&]()
+        {
+            float sum = 0.0f;
+            for (uint32_t id : shuffledIds)
+            {
+                sum += mapStorage.GetComponent(id)->scale[0];
+            }
+            sink = sink + sum;
+        });
+    double sparseGet = MeasureMs([&]()
+        {
+            float sum = 0.0f;
+            for (uint32_t id : shuffledIds)
+            {
+                sum += sparseStorage.GetComponent(id)->scale[0];
+            }
+            sink = sink + sum;
+        });
+    PrintResult("Get", mapGet, sparseGet);
+
+    // Iterate (write every component)
+    double mapIterate = MeasureMs([&]()
+        {
+            for (auto& [id, transform] : mapStorage.GetAllComponents())
+            {
+                transform.position[0] += 1.0f;
+            }
+        });
+    double sparseIterate = MeasureMs([&]()
+        {
+            for (BenchTransform& transform : sparseStorage.GetComponents())
+            {
+                transform.position[0] += 1.0f;
+            }
+        });
+    PrintResult("Iterate", mapIterate, sparseIterate);
+
+    // Remove (random order)
+    double mapRemove = MeasureMs([&]()
+        {
+            for (uint32_t id : shuffledIds)
+            {
+                mapStorage.RemoveComponent(id);
+            }
+        });
+    double sparseRemove = MeasureMs([&]()
+        {
+            for (uint32_t id : shuffledIds)
+            {
+                sparseStorage.RemoveComponent(id);
+            }
+        });
+    PrintResult("Remove", mapRemove, sparseRemove);
+
+    std::cout << "  Remaining: map=" << mapStorage.GetAllComponents().size()
+        << ", sparse set=" << sparseStorage.Size() << std::endl;
+    std::cout << std::endl;
+}
+
+// Test 2: RenderSystem gather loop (Transform + Mesh + Material -> RenderItem)
+void BenchmarkRenderGather(uint32_t renderableCount)
+{
+    const uint32_t transformOnlyCount = renderableCount / 4;
+    std::cout << "Test 2: RenderSystem gather (" << renderableCount << " renderables, "
+        << transformOnlyCount << " transform-only)" << std::endl;
+
+    // Stand-in resource tables (ResourceManager lookups)
+    std::vector<int> meshes(64);
+    std::vector<int> materials(16);
+
+    ECS::Registry registry;
+    for (uint32_t i = 0; i < renderableCount + transformOnlyCount; ++i)
+    {
+        ECS::Entity entity = registry.CreateEntity();
+        registry.AddComponent(entity, BenchTransform{});
+
+        // Interleave transform-only entities
+        if (i % 5 != 4)
+        {
+            registry.AddComponent(entity, BenchMesh{ i % 64 });
+            registry.AddComponent(entity, BenchMaterial{ i % 16 });
+        }
+    }
+
+    std::vector<BenchRenderItem> items;
+    items.reserve(renderableCount + transformOnlyCount);
+    const int iterations = 10;
+
+    // Before: Entity view + GetComponent per component
+    double lookupMs = MeasureMs([&]()
+        {
+            for (int iteration = 0; iteration < iterations; ++iteration)
+            {
+                items.clear();
+                for (ECS::Entity entity : registry.CreateView<BenchTransform, BenchMesh, BenchMaterial>())
+                {
+                    auto* transform = registry.GetComponent<BenchTransform>(entity);
+                    auto* mesh = registry.GetComponent<BenchMesh>(entity);
+                    auto* material = registry.GetComponent<BenchMaterial>(entity);
+                    items.push_back({ &meshes[mesh->meshId], &materials[material->materialId], *transform });
+                }
+            }
+        }) / iterations;
+
+    // After: view.Each (component references from storage)
+    double viewEachMs = MeasureMs([&]()
+        {
+            for (int iteration = 0; iteration < iterations; ++iteration)
+            {
+                items.clear();
+                registry.CreateView<BenchTransform, BenchMesh, BenchMaterial>().Each(
+                    [&](ECS::Entity, BenchTransform& transform, BenchMesh& mesh, BenchMaterial& material)
+                    {
+                        items.push_back({ &meshes[mesh.meshId], &materials[material.materialId], transform });
+                    });
+            }
+        }) / iterations;
+
+    // After: archetype group (packed arrays)
+    registry.GetGroup<BenchTransform, BenchMesh, BenchMaterial>();
+    double groupEachMs = MeasureMs([&]()
+        {
+            for (int iteration = 0; iteration < iterations; ++iteration)
+            {
+                items.clear();
+                for (auto [entity, transform, mesh, material] : registry.GetGroup<BenchTransform, BenchMesh, BenchMaterial>().Each())
+                {
+                    items.push_back({ &meshes[mesh.meshId], &materials[material.materialId], transform });
+                }
+            }
+        }) / iterations;
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "  View + GetComponent: " << std::setw(9) << lookupMs << " ms" << std::endl;
+    std::cout << "  View.Each:           " << std::setw(9) << viewEachMs << " ms   (x"
+        << std::setprecision(2) << lookupMs / viewEachMs << ")" << std::setprecision(3) << std::endl;
+    std::cout << "  Group.Each:          " << std::setw(9) << groupEachMs << " ms   (x"
+        << std::setprecision(2) << lookupMs / groupEachMs << ")" << std::endl;
+    std::cout << "  Gathered items: " << items.size() << std::endl;
+    std::cout << std::endl;
+}
+
+// Test 3: Level-load spawn (Transform + Mesh + Material per entity)
+void BenchmarkSpawn(uint32_t entityCount)
+{
+    std::cout << "Test 3: Spawn (" << entityCount << " renderables)" << std::endl;
+
+    std::vector<BenchTransform> transforms(entityCount);
+    std::vector<BenchMesh> meshes(entityCount);
+    std::vector<BenchMaterial> materials(entityCount);
+    for (uint32_t i = 0; i < entityCount; ++i)
+    {
+        transforms[i].position[0] = static_cast<float>(i);
+        meshes[i].meshId = i % 64;
+        materials[i].materialId = i % 16;
+    }
+
+    // Before: CreateEntity + AddComponent per entity (cached view alive, as in a running scene)
+    ECS::Registry singleRegistry;
+    singleRegistry.CreateView<BenchTransform, BenchMesh, BenchMaterial>();
+    std::vector<ECS::Entity> singleEntities(entityCount);
+    double singleCreateMs = MeasureMs([&]()
+        {
+            for (uint32_t i = 0; i < entityCount; ++i)
+            {
+                ECS::Entity entity = singleRegistry.CreateEntity();
+                singleRegistry.AddComponent(entity, transforms[i]);
+                singleRegistry.AddComponent(entity, meshes[i]);
+                singleRegistry.AddComponent(entity, materials[i]);
+                singleEntities[i] = entity;
+            }
+        });
+    double singleDestroyMs = MeasureMs([&]()
+        {
+            for (ECS::Entity entity : singleEntities)
+            {
+                singleRegistry.DestroyEntity(entity);
+            }
+        });
+
+    // After: CreateEntities + AddComponents
+    ECS::Registry batchRegistry;
+    batchRegistry.CreateView<BenchTransform, BenchMesh, BenchMaterial>();
+    std::vector<ECS::Entity> batchEntities(entityCount);
+    double batchCreateMs = MeasureMs([&]()
+        {
+            batchRegistry.CreateEntities(entityCount, batchEntities);
+            batchRegistry.AddComponents<BenchTransform>(batchEntities, transforms);
+            batchRegistry.AddComponents<BenchMesh>(batchEntities, meshes);
+            batchRegistry.AddComponents<BenchMaterial>(batchEntities, materials);
+        });
+    const size_t batchMatched = batchRegistry.CreateView<BenchTransform, BenchMesh, BenchMaterial>().size();
+    double batchDestroyMs = MeasureMs([&]()
+        {
+            batchRegistry.DestroyEntities(batchEntities);
+        });
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "  Create (single): " << std::setw(9) << singleCreateMs << " ms" << std::endl;
+    std::cout << "  Create (batch):  " << std::setw(9) << batchCreateMs << " ms   (x"
+        << std::setprecision(2) << singleCreateMs / batchCreateMs << ")" << std::setprecision(3) << std::endl;
+    std::cout << "  Destroy (single):" << std::setw(9) << singleDestroyMs << " ms" << std::endl;
+    std::cout << "  Destroy (batch): " << std::setw(9) << batchDestroyMs << " ms" << std::endl;
+    std::cout << "  Matched: " << batchMatched << ", remaining: "
+        << singleRegistry.GetEntityCount() + batchRegistry.GetEntityCount() << std::endl;
+    std::cout << std::endl;
+}
+
+int main()
+{
+    std::cout << "========================================" << std::endl;
+    std::cout << "    ECS Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    BenchmarkComponentStorage(10000);
+    BenchmarkComponentStorage(100000);
+
+    BenchmarkRenderGather(10000);
+    BenchmarkRenderGather(100000);
+
+    BenchmarkSpawn(100000);
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "    All benchmarks completed!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return 0;
+}
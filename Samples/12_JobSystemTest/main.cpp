@@ -0,0 +1,175 @@
+#include "Common/BenchmarkUtils.h"
+#include "Core/Jobs/JobSystem.h"
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using Core::Jobs::JobCounter;
+using Core::Jobs::JobSystem;
+
+// Arbitrary per-element workload
+float HeavyWork(uint32_t index)
+{
+    float value = static_cast<float>(index);
+    for (int i = 0; i < 64; ++i)
+    {
+        value = std::sqrt(value * 1.0001f + 1.0f);
+    }
+    return value;
+}
+
+int main()
+{
+    std::cout << "========================================" << std::endl;
+    std::cout << "    Job System Test" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    JobSystem::Create();
+    JobSystem& jobs = JobSystem::GetInstance();
+
+    std::cout << "Created JobSystem:" << std::endl;
+    std::cout << "  - Worker threads: " << jobs.GetWorkerCount() << std::endl;
+    std::cout << "  - Total threads: " << jobs.GetThreadCount() << std::endl;
+    std::cout << std::endl;
+
+    bool allPassed = true;
+
+    // Test 1: ParallelFor visits every index exactly once
+    std::cout << "Test 1: ParallelFor coverage (1,000,000 indices)" << std::endl;
+    {
+        const uint32_t count = 1000000;
+        std::vector<std::atomic<uint32_t>> visits(count);
+        Core::Jobs::ParallelFor(count, 256, [&](uint32_t i)
+            {
+                visits[i].fetch_add(1, std::memory_order_relaxed);
+            });
+
+        bool passed = true;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            passed = passed && (visits[i].load() == 1);
+        }
+        PrintCheck("Every index visited once", passed);
+        allPassed = allPassed && passed;
+    }
+    std::cout << std::endl;
+
+    // Test 2: Independent jobs with a counter
+    std::cout << "Test 2: Run + Wait (100 batches x 1,000 jobs)" << std::endl;
+    {
+        std::atomic<uint32_t> executed{ 0 };
+        for (int batch = 0; batch < 100; ++batch)
+        {
+            JobCounter counter;
+            for (int i = 0; i < 1000; ++i)
+            {
+                jobs.Run(counter, [&executed]()
+                    {
+                        executed.fetch_add(1, std::memory_order_relaxed);
+                    });
+            }
+            jobs.Wait(counter);
+        }
+
+        bool passed = (executed.load() == 100000);
+        PrintCheck("All jobs executed", passed);
+        allPassed = allPassed && passed;
+    }
+    std::cout << std::endl;
+
+    // Test 3: Nested ParallelFor (jobs that wait on other jobs)
+    std::cout << "Test 3: Nested ParallelFor (64 x 4,096)" << std::endl;
+    {
+        std::atomic<uint64_t> sum{ 0 };
+        Core::Jobs::ParallelFor(64, 1, [&](uint32_t outer)
+            {
+                std::atomic<uint64_t> innerSum{ 0 };
+                Core::Jobs::ParallelFor(4096, 128, [&](uint32_t inner)
+                    {
+                        innerSum.fetch_add(inner, std::memory_order_relaxed);
+                    });
+                sum.fetch_add(innerSum.load() + outer, std::memory_order_relaxed);
+            });
+
+        const uint64_t expected = 64ull * (4095ull * 4096ull / 2ull) + (63ull * 64ull / 2ull);
+        bool passed = (sum.load() == expected);
+        PrintCheck("Nested sum matches", passed);
+        allPassed = allPassed && passed;
+    }
+    std::cout << std::endl;
+
+    // Test 4: Many tiny ParallelFor calls (wake/sleep stress)
+    std::cout << "Test 4: Wake/sleep stress (10,000 small ParallelFor)" << std::endl;
+    {
+        std::atomic<uint32_t> total{ 0 };
+        double ms = MeasureMs([&]()
+            {
+                for (int iteration = 0; iteration < 10000; ++iteration)
+                {
+                    Core::Jobs::ParallelFor(64, 8, [&](uint32_t)
+                        {
+                            total.fetch_add(1, std::memory_order_relaxed);
+                        });
+                }
+            });
+
+        bool passed = (total.load() == 640000);
+        PrintCheck("No lost iterations", passed);
+        std::cout << "  - Time: " << std::fixed << std::setprecision(3) << ms << " ms" << std::endl;
+        allPassed = allPassed && passed;
+    }
+    std::cout << std::endl;
+
+    // Test 5: Speedup on a CPU-bound loop
+    std::cout << "Test 5: Speedup (2,000,000 elements)" << std::endl;
+    {
+        const uint32_t count = 2000000;
+        std::vector<float> serialResults(count);
+        std::vector<float> parallelResults(count);
+
+        double serialMs = MeasureMs([&]()
+            {
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    serialResults[i] = HeavyWork(i);
+                }
+            });
+        double parallelMs = MeasureMs([&]()
+            {
+                Core::Jobs::ParallelFor(count, 1024, [&](uint32_t i)
+                    {
+                        parallelResults[i] = HeavyWork(i);
+                    });
+            });
+
+        bool passed = (serialResults == parallelResults);
+        PrintCheck("Results identical", passed);
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "  - Serial:   " << std::setw(9) << serialMs << " ms" << std::endl;
+        std::cout << "  - Parallel: " << std::setw(9) << parallelMs << " ms   (x"
+            << std::setprecision(2) << serialMs / parallelMs << ")" << std::endl;
+        allPassed = allPassed && passed;
+    }
+    std::cout << std::endl;
+
+    // Jobs executed per thread (work stealing distribution)
+    std::cout << "Jobs executed per thread:" << std::endl;
+    for (uint32_t i = 0; i < jobs.GetThreadCount(); ++i)
+    {
+        std::cout << "  - Thread " << i << (i == 0 ? " (main)" : "") << ": "
+            << jobs.GetExecutedJobCount(i) << std::endl;
+    }
+    std::cout << std::endl;
+
+    JobSystem::Destroy();
+
+    std::cout << "========================================" << std::endl;
+    std::cout << (allPassed ? "    All tests passed!" : "    Some tests FAILED!") << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,340 @@
+#include "Common/BenchmarkUtils.h"
+#include "Core/Jobs/JobSystem.h"
+#include "ECS/Registry.h"
+#include "ECS/SystemManager.h"
+#include "ECS/Systems/TransformSystem.h"
+#include "Math/MathBatch.h"
+#include "Math/MathUtils.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using Core::Jobs::JobSystem;
+using ECS::Entity;
+using ECS::HierarchyComponent;
+using ECS::Registry;
+using ECS::SystemManager;
+using ECS::TransformComponent;
+using ECS::TransformMatrix;
+using ECS::TransformSystem;
+
+// Scene layout (100,000 transforms in mixed depth)
+constexpr uint32_t SMALL_TREE_COUNT = 200;      // root -> 8 -> 64 (73 nodes each)
+constexpr uint32_t WIDE_TREE_COUNT = 2;         // root -> 64 -> 16,384 (16,449 nodes each)
+constexpr uint32_t CHAIN_COUNT = 100;           // 100-deep chains
+constexpr uint32_t CHAIN_DEPTH = 100;
+constexpr uint32_t TOTAL_TRANSFORMS = 100000;   // remainder = standalone (no hierarchy)
+
+constexpr int FRAME_COUNT = 50;
+
+struct BenchScene
+{
+    Registry registry;
+    SystemManager systemManager{ registry };
+    TransformSystem* transformSystem = nullptr;
+    std::vector<Entity> entities;
+    std::vector<Entity> roots;      // hierarchy roots + standalone entities
+    std::mt19937 rng{ 42 };
+
+    BenchScene()
+    {
+        transformSystem = systemManager.RegisterSystem<TransformSystem>();
+    }
+
+    Entity CreateTransform(bool withHierarchy)
+    {
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+        Entity entity = registry.CreateEntity();
+        TransformComponent transform;
+        transform.position = Math::Vector3(dist(rng), dist(rng), dist(rng));
+        transform.rotation = Math::QuaternionFromEuler(Math::Vector3(dist(rng), dist(rng), dist(rng)));
+        transform.scale = Math::Vector3(1.0f + dist(rng) * 0.1f);
+        registry.AddComponent(entity, transform);
+
+        if (withHierarchy)
+        {
+            registry.AddComponent(entity, HierarchyComponent{});
+        }
+
+        entities.push_back(entity);
+        return entity;
+    }
+
+    Entity CreateChild(Entity parent)
+    {
+        Entity child = CreateTransform(true);
+        transformSystem->SetParent(child, parent);
+        return child;
+    }
+
+    Entity CreateRoot()
+    {
+        Entity root = CreateTransform(true);
+        transformSystem->SetParent(root, Entity::Invalid());
+        roots.push_back(root);
+        return root;
+    }
+
+    void Build()
+    {
+        // Many small trees (batched per job)
+        for (uint32_t tree = 0; tree < SMALL_TREE_COUNT; ++tree)
+        {
+            Entity root = CreateRoot();
+            for (int i = 0; i < 8; ++i)
+            {
+                Entity child = CreateChild(root);
+                for (int j = 0; j < 8; ++j)
+                {
+                    CreateChild(child);
+                }
+            }
+        }
+
+        // A few very wide trees (split by level)
+        for (uint32_t tree = 0; tree < WIDE_TREE_COUNT; ++tree)
+        {
+            Entity root = CreateRoot();
+            for (int i = 0; i < 64; ++i)
+            {
+                Entity child = CreateChild(root);
+                for (int j = 0; j < 256; ++j)
+                {
+                    CreateChild(child);
+                }
+            }
+        }
+
+        // Deep chains
+        for (uint32_t chain = 0; chain < CHAIN_COUNT; ++chain)
+        {
+            Entity node = CreateRoot();
+            for (uint32_t depth = 1; depth < CHAIN_DEPTH; ++depth)
+            {
+                node = CreateChild(node);
+            }
+        }
+
+        // Standalone transforms
+        while (entities.size() < TOTAL_TRANSFORMS)
+        {
+            roots.push_back(CreateTransform(false));
+        }
+    }
+
+    // Moves every root so that the whole scene is recomputed
+    void MoveAllRoots()
+    {
+        for (Entity root : roots)
+        {
+            transformSystem->Translate(root, Math::Vector3(0.001f, 0.0f, 0.0f));
+        }
+    }
+
+    // Moves a random 1% of all transforms
+    void MoveRandom()
+    {
+        std::uniform_int_distribution<size_t> pick(0, entities.size() - 1);
+        for (size_t i = 0; i < entities.size() / 100; ++i)
+        {
+            transformSystem->Translate(entities[pick(rng)], Math::Vector3(0.0f, 0.001f, 0.0f));
+        }
+    }
+
+    std::vector<TransformMatrix> CollectWorldMatrices()
+    {
+        std::vector<TransformMatrix> result;
+        result.reserve(entities.size());
+        for (Entity entity : entities)
+        {
+            result.push_back(registry.GetComponent<TransformComponent>(entity)->worldMatrix);
+        }
+        return result;
+    }
+};
+
+struct RunResult
+{
+    double buildMs = 0.0;
+    double fullMs = 0.0;
+    double partialMs = 0.0;
+    std::vector<TransformMatrix> worldMatrices;
+};
+
+RunResult RunBenchmark()
+{
+    RunResult result;
+    BenchScene scene;
+    scene.Build();
+
+    // First update includes flattening the hierarchy
+    result.buildMs = MeasureMs([&]()
+        {
+            scene.systemManager.UpdateSystems(0.016f);
+        });
+
+    for (int frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        scene.MoveAllRoots();
+        result.fullMs += MeasureMs([&]()
+            {
+                scene.systemManager.UpdateSystems(0.016f);
+            });
+    }
+
+    for (int frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        scene.MoveRandom();
+        result.partialMs += MeasureMs([&]()
+            {
+                scene.systemManager.UpdateSystems(0.016f);
+            });
+    }
+
+    result.fullMs /= FRAME_COUNT;
+    result.partialMs /= FRAME_COUNT;
+    result.worldMatrices = scene.CollectWorldMatrices();
+    return result;
+}
+
+// Batch kernel throughput for each SIMD level (results must be bitwise identical)
+// Matrix = Math::Matrix4x4 or Math::Matrix3x4 (compact affine)
+template<typename Matrix>
+bool RunKernelBenchmark(const char* layoutName)
+{
+    const uint32_t count = TOTAL_TRANSFORMS;
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    std::vector<Math::Vector3> positions(count);
+    std::vector<Math::Quaternion> rotations(count);
+    std::vector<Math::Vector3> scales(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        positions[i] = Math::Vector3(dist(rng), dist(rng), dist(rng));
+        rotations[i] = Math::QuaternionFromEuler(Math::Vector3(dist(rng), dist(rng), dist(rng)));
+        scales[i] = Math::Vector3(1.0f + dist(rng) * 0.5f, 1.0f + dist(rng) * 0.5f, 1.0f + dist(rng) * 0.5f);
+    }
+
+    const Math::SimdLevel supported = Math::GetSupportedSimdLevel();
+    std::vector<Matrix> scalarResult;
+
+    std::cout << "Batch kernels, " << layoutName << " (" << count << " matrices, best of 10):" << std::endl;
+    bool passed = true;
+    for (int level = 0; level <= static_cast<int>(supported); ++level)
+    {
+        Math::SetSimdLevel(static_cast<Math::SimdLevel>(level));
+
+        std::vector<Matrix> local(count);
+        std::vector<Matrix> world(count);
+        std::vector<Matrix> inverseTranspose(count);
+
+        double composeMs = 1e9;
+        double multiplyMs = 1e9;
+        double inverseMs = 1e9;
+        for (int iteration = 0; iteration < 10; ++iteration)
+        {
+            composeMs = std::min(composeMs, MeasureMs([&]()
+                {
+                    Math::ComposeTRSBatch(positions.data(), rotations.data(), scales.data(), local.data(), count);
+                }));
+            multiplyMs = std::min(multiplyMs, MeasureMs([&]()
+                {
+                    Math::MultiplyMatrixBatch(local.data(), local.data(), world.data(), count);
+                }));
+            inverseMs = std::min(inverseMs, MeasureMs([&]()
+                {
+                    Math::InverseTransposeBatch(world.data(), inverseTranspose.data(), count);
+                }));
+        }
+
+        std::cout << "  " << std::left << std::setw(8) << Math::GetSimdLevelName(static_cast<Math::SimdLevel>(level))
+            << std::right << std::fixed << std::setprecision(3)
+            << "compose: " << std::setw(7) << composeMs << " ms   "
+            << "multiply: " << std::setw(7) << multiplyMs << " ms   "
+            << "inverse-transpose: " << std::setw(7) << inverseMs << " ms" << std::endl;
+
+        // The last stage depends on the other two, so comparing it covers all kernels
+        if (level == 0)
+        {
+            scalarResult = inverseTranspose;
+        }
+        else
+        {
+            passed = passed && std::memcmp(scalarResult.data(), inverseTranspose.data(),
+                count * sizeof(Matrix)) == 0;
+        }
+    }
+
+    Math::SetSimdLevel(supported);
+    PrintCheck("All SIMD levels bitwise identical", passed);
+    std::cout << std::endl;
+    return passed;
+}
+
+void PrintTiming(const char* name, double serialMs, double parallelMs)
+{
+    std::cout << "  " << std::left << std::setw(20) << name << std::right
+        << std::fixed << std::setprecision(3)
+        << "serial: " << std::setw(8) << serialMs << " ms   "
+        << "parallel: " << std::setw(8) << parallelMs << " ms   (x"
+        << std::setprecision(2) << serialMs / parallelMs << ")" << std::endl;
+}
+
+int main()
+{
+    std::cout << "========================================" << std::endl;
+    std::cout << "    Transform Hierarchy Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Scene: " << TOTAL_TRANSFORMS << " transforms" << std::endl;
+    std::cout << "  - " << SMALL_TREE_COUNT << " small trees (depth 3, 73 nodes)" << std::endl;
+    std::cout << "  - " << WIDE_TREE_COUNT << " wide trees (depth 3, 16,449 nodes)" << std::endl;
+    std::cout << "  - " << CHAIN_COUNT << " chains (depth " << CHAIN_DEPTH << ")" << std::endl;
+    std::cout << "  - Remaining transforms without hierarchy" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Transform layout: " << (ECS_COMPACT_TRANSFORM ? "compact (Matrix3x4)" : "full (Matrix4x4)")
+        << ", sizeof(TransformComponent) = " << sizeof(TransformComponent) << " bytes" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = RunKernelBenchmark<Math::Matrix4x4>("Matrix4x4");
+    passed = RunKernelBenchmark<Math::Matrix3x4>("Matrix3x4") && passed;
+
+    // Serial: no JobSystem, every ParallelFor runs inline
+    RunResult serial = RunBenchmark();
+
+    JobSystem::Create();
+    std::cout << "Worker threads: " << JobSystem::GetInstance().GetWorkerCount() << std::endl;
+    std::cout << std::endl;
+
+    RunResult parallel = RunBenchmark();
+
+    JobSystem::Destroy();
+
+    std::cout << "Average update time (" << FRAME_COUNT << " frames):" << std::endl;
+    PrintTiming("First (flatten)", serial.buildMs, parallel.buildMs);
+    PrintTiming("All roots moved", serial.fullMs, parallel.fullMs);
+    PrintTiming("1% random moved", serial.partialMs, parallel.partialMs);
+    std::cout << std::endl;
+
+    std::cout << "Determinism:" << std::endl;
+    bool identical = serial.worldMatrices.size() == parallel.worldMatrices.size()
+        && std::memcmp(serial.worldMatrices.data(), parallel.worldMatrices.data(),
+            serial.worldMatrices.size() * sizeof(TransformMatrix)) == 0;
+    PrintCheck("World matrices bitwise identical", identical);
+    passed = passed && identical;
+    std::cout << std::endl;
+
+    std::cout << "========================================" << std::endl;
+    std::cout << (passed ? "    All tests passed!" : "    Some tests FAILED!") << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
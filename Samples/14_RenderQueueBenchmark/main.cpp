@@ -0,0 +1,288 @@
+#include "Common/BenchmarkUtils.h"
+#include "Common/HeadlessRenderFixture.h"
+#include "Graphics/InstanceBatcher.h"
+#include "Graphics/RenderQueue.h"
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using Graphics::InstanceBatch;
+using Graphics::InstanceBatcher;
+using Graphics::InstanceData;
+using Graphics::RenderItem;
+using Graphics::RenderLayer;
+using Graphics::RenderQueueSorter;
+using Graphics::RenderStateChanges;
+
+// Scene layout
+constexpr uint32_t ITEM_COUNT = 20000;
+constexpr uint32_t TRANSPARENT_PERCENT = 10;
+
+constexpr int SORT_ITERATIONS = 50;
+
+void PrintChanges(const char* label, const RenderStateChanges& changes)
+{
+    std::cout << "  - " << label
+        << "  PSO: " << std::setw(6) << changes.pipelineChanges
+        << "  Material: " << std::setw(6) << changes.materialChanges
+        << "  Mesh: " << std::setw(6) << changes.meshChanges << std::endl;
+}
+
+bool SameOrder(const std::vector<RenderItem>& a, const std::vector<RenderItem>& b)
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        if (a[i].sortKey != b[i].sortKey || a[i].worldMatrix.m[3][0] != b[i].worldMatrix.m[3][0]
+            || a[i].material != b[i].material || a[i].mesh != b[i].mesh)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main()
+{
+    std::cout << "========================================" << std::endl;
+    std::cout << "    Render Queue Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    BenchResources resources;
+    const Math::Matrix4x4 view = MakeBenchView();
+
+    std::cout << "Scene:" << std::endl;
+    std::cout << "  - Items: " << ITEM_COUNT << " (" << TRANSPARENT_PERCENT << "% transparent)" << std::endl;
+    std::cout << "  - Meshes: " << MESH_COUNT << std::endl;
+    std::cout << "  - Materials: " << resources.GetMaterialCount()
+        << " (5 pipeline variants)" << std::endl;
+    std::cout << std::endl;
+
+    bool allPassed = true;
+    RenderQueueSorter sorter;
+
+    // Test 1: Radix sort is a stable sort by key
+    std::cout << "Test 1: Radix sort matches std::stable_sort" << std::endl;
+    {
+        bool passed = true;
+        // Both sides of the insertion sort threshold
+        constexpr uint32_t threshold = RenderQueueSorter::SMALL_SORT_THRESHOLD;
+        for (uint32_t count : { 0u, 1u, threshold, threshold + 1, 1000u, ITEM_COUNT })
+        {
+            std::vector<RenderItem> items = BuildItems(resources, count, TRANSPARENT_PERCENT, view, count + 1);
+            std::vector<RenderItem> reference = items;
+            std::stable_sort(reference.begin(), reference.end(), [](const RenderItem& a, const RenderItem& b)
+                {
+                    return a.sortKey < b.sortKey;
+                });
+            sorter.Sort(items);
+            passed = passed && SameOrder(items, reference);
+        }
+        PrintCheck("Same order for 0 .. 20,000 items", passed);
+        allPassed = allPassed && passed;
+    }
+    std::cout << std::endl;
+
+    // Test 2: Queue order (opaque by state then front-to-back, transparent back-to-front)
+    // Depth is compared at key precision; items in the same depth bucket keep submission order
+    std::cout << "Test 2: Queue order" << std::endl;
+    {
+        std::vector<RenderItem> items = BuildItems(resources, ITEM_COUNT, TRANSPARENT_PERCENT, view, 7);
+        sorter.Sort(items);
+
+        auto firstTransparent = std::find_if(items.begin(), items.end(), [](const RenderItem& item)
+            {
+                return Graphics::GetSortKeyLayer(item.sortKey) != RenderLayer::Opaque;
+            });
+
+        bool layersSplit = std::all_of(firstTransparent, items.end(), [](const RenderItem& item)
+            {
+                return item.material->IsTransparent();
+            }) && std::none_of(items.begin(), firstTransparent, [](const RenderItem& item)
+            {
+                return item.material->IsTransparent();
+            });
+
+        bool frontToBack = true;
+        for (auto it = items.begin(); it != firstTransparent && it + 1 != firstTransparent; ++it)
+        {
+            const auto next = it + 1;
+            if (it->material == next->material && it->mesh == next->mesh)
+            {
+                frontToBack = frontToBack && (Graphics::QuantizeSortDepth(ViewDepth(*it, view), Graphics::OPAQUE_DEPTH_BITS)
+                    <= Graphics::QuantizeSortDepth(ViewDepth(*next, view), Graphics::OPAQUE_DEPTH_BITS));
+            }
+        }
+
+        bool backToFront = true;
+        for (auto it = firstTransparent; it != items.end() && it + 1 != items.end(); ++it)
+        {
+            backToFront = backToFront && (Graphics::QuantizeSortDepth(ViewDepth(*it, view), Graphics::TRANSPARENT_DEPTH_BITS)
+                >= Graphics::QuantizeSortDepth(ViewDepth(*(it + 1), view), Graphics::TRANSPARENT_DEPTH_BITS));
+        }
+
+        PrintCheck("Opaque before transparent", layersSplit);
+        PrintCheck("Opaque front-to-back within a state", frontToBack);
+        PrintCheck("Transparent back-to-front", backToFront);
+        allPassed = allPassed && layersSplit && frontToBack && backToFront;
+    }
+    std::cout << std::endl;
+
+    // Test 3: State changes when drawing in iteration order vs sorted order
+    std::cout << "Test 3: State changes (" << ITEM_COUNT << " items)" << std::endl;
+    {
+        std::vector<RenderItem> items = BuildItems(resources, ITEM_COUNT, TRANSPARENT_PERCENT, view, 11);
+        const RenderStateChanges unsorted = Graphics::CountStateChanges(items);
+
+        sorter.Sort(items);
+        auto firstTransparent = std::find_if(items.begin(), items.end(), [](const RenderItem& item)
+            {
+                return Graphics::GetSortKeyLayer(item.sortKey) != RenderLayer::Opaque;
+            });
+        std::vector<RenderItem> opaqueItems(items.begin(), firstTransparent);
+        std::vector<RenderItem> transparentItems(firstTransparent, items.end());
+
+        const RenderStateChanges sortedOpaque = Graphics::CountStateChanges(opaqueItems);
+        const RenderStateChanges sortedTransparent = Graphics::CountStateChanges(transparentItems);
+
+        PrintChanges("Unsorted        ", unsorted);
+        PrintChanges("Sorted opaque   ", sortedOpaque);
+        PrintChanges("Sorted transp.  ", sortedTransparent);
+
+        const uint32_t sortedPipelines = sortedOpaque.pipelineChanges + sortedTransparent.pipelineChanges;
+        bool passed = sortedPipelines < unsorted.pipelineChanges
+            && sortedOpaque.materialChanges + sortedTransparent.materialChanges < unsorted.materialChanges;
+        PrintCheck("Fewer PSO/material changes after sorting", passed);
+        allPassed = allPassed && passed;
+    }
+    std::cout << std::endl;
+
+    // Test 4: Instance batching (sorted queues -> one instanced draw per (mesh, material) run)
+    std::cout << "Test 4: Instance batching (" << ITEM_COUNT << " items)" << std::endl;
+    {
+        std::vector<RenderItem> items = BuildItems(resources, ITEM_COUNT, TRANSPARENT_PERCENT, view, 13);
+        sorter.Sort(items);
+        auto firstTransparent = std::find_if(items.begin(), items.end(), [](const RenderItem& item)
+            {
+                return Graphics::GetSortKeyLayer(item.sortKey) != RenderLayer::Opaque;
+            });
+        const std::vector<RenderItem> opaqueItems(items.begin(), firstTransparent);
+        const std::vector<RenderItem> transparentItems(firstTransparent, items.end());
+
+        InstanceBatcher batcher;
+        bool coversInOrder = true;
+        bool runsMaximal = true;
+        bool packMatches = true;
+        bool rangePackMatches = true;
+
+        for (const std::vector<RenderItem>* queue : { &opaqueItems, &transparentItems })
+        {
+            batcher.Build(*queue);
+            const auto& batches = batcher.GetBatches();
+
+            // Batches cover every item exactly once, in submission order, with one (mesh, material) each
+            uint32_t nextItem = 0;
+            for (size_t b = 0; b < batches.size(); ++b)
+            {
+                const InstanceBatch& batch = batches[b];
+                coversInOrder = coversInOrder && batch.firstItem == nextItem && batch.firstInstance == nextItem;
+                for (uint32_t i = 0; i < batch.instanceCount; ++i)
+                {
+                    const RenderItem& item = (*queue)[batch.firstItem + i];
+                    coversInOrder = coversInOrder && item.mesh == batch.mesh && item.material == batch.material;
+                }
+                if (b > 0)
+                {
+                    runsMaximal = runsMaximal
+                        && (batches[b - 1].mesh != batch.mesh || batches[b - 1].material != batch.material);
+                }
+                nextItem += batch.instanceCount;
+            }
+            coversInOrder = coversInOrder && nextItem == queue->size() && batcher.GetInstanceCount() == nextItem;
+
+            // Packed data matches the per-item conversion (full pack and split-range pack)
+            std::vector<InstanceData> packed(batcher.GetInstanceCount());
+            batcher.PackInstances(packed.data());
+            for (size_t i = 0; i < queue->size(); ++i)
+            {
+                const InstanceData expected = InstanceBatcher::MakeInstanceData((*queue)[i]);
+                packMatches = packMatches && std::memcmp(&expected, &packed[i], sizeof(InstanceData)) == 0;
+            }
+
+            std::vector<InstanceData> split(batcher.GetInstanceCount());
+            const uint32_t half = batcher.GetBatchCount() / 2;
+            batcher.PackInstances(split.data(), half, batcher.GetBatchCount() - half);
+            batcher.PackInstances(split.data(), 0, half);
+            rangePackMatches = rangePackMatches
+                && std::memcmp(split.data(), packed.data(), packed.size() * sizeof(InstanceData)) == 0;
+
+            std::cout << "  - " << (queue == &opaqueItems ? "Opaque      " : "Transparent ")
+                << std::setw(6) << queue->size() << " items -> " << std::setw(6) << batcher.GetBatchCount()
+                << " instanced draws" << std::endl;
+        }
+
+        PrintCheck("Batches cover items in order", coversInOrder);
+        PrintCheck("Adjacent batches differ (maximal runs)", runsMaximal);
+        PrintCheck("Packed instances match items", packMatches);
+        PrintCheck("Split-range packing matches full packing", rangePackMatches);
+        allPassed = allPassed && coversInOrder && runsMaximal && packMatches && rangePackMatches;
+    }
+    std::cout << std::endl;
+
+    // Test 5: Sort and batch time
+    std::cout << "Test 5: Sort and batch time (average of " << SORT_ITERATIONS << " runs)" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    for (uint32_t count : { 1000u, 10000u, 100000u })
+    {
+        const std::vector<RenderItem> source = BuildItems(resources, count, TRANSPARENT_PERCENT, view, 3);
+        std::vector<RenderItem> items;
+        InstanceBatcher batcher;
+        std::vector<InstanceData> instances(count);
+
+        double radixMs = 0.0;
+        double stableMs = 0.0;
+        double batchMs = 0.0;
+        for (int iteration = 0; iteration < SORT_ITERATIONS; ++iteration)
+        {
+            items = source;
+            radixMs += MeasureMs([&]()
+                {
+                    sorter.Sort(items);
+                });
+
+            // Batch + pack the sorted queue (what the renderer does before recording draws)
+            batchMs += MeasureMs([&]()
+                {
+                    batcher.Build(items);
+                    batcher.PackInstances(instances.data());
+                });
+
+            items = source;
+            stableMs += MeasureMs([&]()
+                {
+                    std::stable_sort(items.begin(), items.end(), [](const RenderItem& a, const RenderItem& b)
+                        {
+                            return a.sortKey < b.sortKey;
+                        });
+                });
+        }
+
+        std::cout << "  - " << std::setw(7) << count << " items   radix: " << std::setw(8) << radixMs / SORT_ITERATIONS
+            << " ms   std::stable_sort: " << std::setw(8) << stableMs / SORT_ITERATIONS
+            << " ms   batch+pack: " << std::setw(8) << batchMs / SORT_ITERATIONS << " ms" << std::endl;
+    }
+    std::cout << std::endl;
+
+    std::cout << "========================================" << std::endl;
+    std::cout << (allPassed ? "    All tests passed!" : "    Some tests FAILED!") << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return allPassed ? 0 : 1;
+}
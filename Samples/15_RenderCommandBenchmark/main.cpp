@@ -0,0 +1,377 @@
+#include "Common/BenchmarkUtils.h"
+#include "Common/HeadlessRenderFixture.h"
+#include "Graphics/Mesh.h"
+#include "Graphics/NullRenderBackend.h"
+#include "Graphics/RenderCommandBuilder.h"
+#include "Graphics/RenderQueue.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using Graphics::InstanceBatcher;
+using Graphics::InstanceData;
+using Graphics::Mesh;
+using Graphics::NullRenderBackend;
+using Graphics::RenderBackendStats;
+using Graphics::RenderCommandBuilder;
+using Graphics::RenderCommandStream;
+using Graphics::RenderCommandType;
+using Graphics::RenderItem;
+using Graphics::RenderLayer;
+using Graphics::RenderQueueSorter;
+using Graphics::RootSlot;
+
+// Scene layout
+constexpr uint32_t ITEM_COUNT = 20000;
+constexpr uint32_t TRANSPARENT_PERCENT = 10;
+
+constexpr int BUILD_ITERATIONS = 20;
+
+// Builds items with keys computed the same way as RenderSystem, then sorts them
+std::vector<RenderItem> BuildSortedItems(const BenchResources& resources, uint32_t count, uint32_t seed)
+{
+    std::vector<RenderItem> items = BuildItems(resources, count, TRANSPARENT_PERCENT, MakeBenchView(), seed);
+
+    RenderQueueSorter sorter;
+    sorter.Sort(items);
+    return items;
+}
+
+// Material constants pool exhausted for one material (DX12MaterialConstantsPool returns 0)
+class ExhaustedConstantsProvider : public HeadlessResourceProvider
+{
+public:
+    ExhaustedConstantsProvider(const BenchResources& resources, const Graphics::Material* exhausted)
+        : HeadlessResourceProvider(resources)
+        , mExhausted(exhausted)
+    {
+    }
+
+    uint64_t GetMaterialConstants(const Graphics::Material& material) override
+    {
+        return &material == mExhausted ? 0 : HeadlessResourceProvider::GetMaterialConstants(material);
+    }
+
+private:
+    const Graphics::Material* mExhausted;
+};
+
+// Splits a sorted list into the opaque and transparent queues (what RenderSystem hands to the renderer)
+void SplitQueues(const std::vector<RenderItem>& items, std::vector<RenderItem>& opaque, std::vector<RenderItem>& transparent)
+{
+    auto firstTransparent = std::find_if(items.begin(), items.end(), [](const RenderItem& item)
+        {
+            return Graphics::GetSortKeyLayer(item.sortKey) != RenderLayer::Opaque;
+        });
+    opaque.assign(items.begin(), firstTransparent);
+    transparent.assign(firstTransparent, items.end());
+}
+
+// Records one frame the way DX12Renderer::DrawRenderItems does (lighting + builder per queue)
+bool RecordFrame(
+    const std::vector<RenderItem>& opaque,
+    const std::vector<RenderItem>& transparent,
+    RenderCommandBuilder& builder,
+    HeadlessResourceProvider& provider,
+    RenderCommandStream& opaqueStream,
+    RenderCommandStream& transparentStream)
+{
+    constexpr uint64_t LIGHTING_CB = 0x30000000ull;
+
+    provider.BeginFrame(HeadlessResourceProvider::UploadCapacity(opaque.size() + transparent.size()));
+
+    bool succeeded = true;
+    opaqueStream.Clear();
+    opaqueStream.SetConstantBuffer(RootSlot::Lighting, LIGHTING_CB);
+    succeeded = builder.Build(opaque, provider, opaqueStream) && succeeded;
+
+    transparentStream.Clear();
+    transparentStream.SetConstantBuffer(RootSlot::Lighting, LIGHTING_CB);
+    succeeded = builder.Build(transparent, provider, transparentStream) && succeeded;
+    return succeeded;
+}
+
+int main()
+{
+    std::cout << "========================================" << std::endl;
+    std::cout << "    Render Command Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    BenchResources resources(true);
+
+    std::cout << "Scene:" << std::endl;
+    std::cout << "  - Items: " << ITEM_COUNT << " (" << TRANSPARENT_PERCENT << "% transparent)" << std::endl;
+    std::cout << "  - Meshes: " << MESH_COUNT << std::endl;
+    std::cout << "  - Materials: " << resources.GetMaterialCount()
+        << " (5 pipeline variants, half instanced)" << std::endl;
+    std::cout << "  - Command size: " << sizeof(Graphics::RenderCommand) << " bytes" << std::endl;
+    std::cout << std::endl;
+
+    bool allPassed = true;
+    RenderCommandBuilder builder;
+    HeadlessResourceProvider provider(resources);
+    NullRenderBackend backend;
+    RenderCommandStream opaqueStream;
+    RenderCommandStream transparentStream;
+
+    std::vector<RenderItem> opaque;
+    std::vector<RenderItem> transparent;
+    SplitQueues(BuildSortedItems(resources, ITEM_COUNT, 5), opaque, transparent);
+
+    // Test 1: Generated streams pass validation and draw every item exactly once
+    std::cout << "Test 1: Command stream validation (" << ITEM_COUNT << " items)" << std::endl;
+    {
+        const bool built = RecordFrame(opaque, transparent, builder, provider, opaqueStream, transparentStream);
+
+        backend.ResetStats();
+        const bool valid = backend.Submit(opaqueStream) && backend.Submit(transparentStream);
+        const RenderBackendStats& stats = backend.GetStats();
+
+        // Expected draws: one per instanced batch, one per item of a non-instanced batch.
+        // Expected upload: each item written once, instanced items packed at 192 bytes,
+        // non-instanced items in 256-byte constant buffer slots (one allocation per queue)
+        uint64_t expectedDraws = 0;
+        size_t expectedUpload = 0;
+        for (const std::vector<RenderItem>* queue : { &opaque, &transparent })
+        {
+            Graphics::InstanceBatcher batcher;
+            batcher.Build(*queue);
+
+            size_t instancedCount = 0;
+            size_t objectCount = 0;
+            for (const Graphics::InstanceBatch& batch : batcher.GetBatches())
+            {
+                const bool instancing = batch.material->SupportsInstancing();
+                expectedDraws += instancing ? 1 : batch.instanceCount;
+                (instancing ? instancedCount : objectCount) += batch.instanceCount;
+            }
+            expectedUpload += (instancedCount * sizeof(InstanceData) + 255) / 256 * 256 + objectCount * 256;
+        }
+
+        // The instance buffer bound at each draw holds that draw's items in queue order,
+        // also for non-instanced materials (shaders that only read t0 must not see another item)
+        bool instancesMatch = true;
+        for (const std::vector<RenderItem>* queue : { &opaque, &transparent })
+        {
+            const RenderCommandStream& stream = queue == &opaque ? opaqueStream : transparentStream;
+
+            uint64_t instanceBuffer = 0;
+            size_t itemIndex = 0;
+            for (const Graphics::RenderCommand& command : stream.GetCommands())
+            {
+                if (command.type == RenderCommandType::SetShaderResource && command.slot == RootSlot::InstanceBuffer)
+                {
+                    instanceBuffer = command.gpuAddress;
+                }
+                else if (command.type == RenderCommandType::DrawInstanced || command.type == RenderCommandType::DrawIndexed)
+                {
+                    const uint32_t instanceCount = command.type == RenderCommandType::DrawIndexed
+                        ? command.drawIndexed.instanceCount
+                        : command.drawInstanced.instanceCount;
+
+                    // Headless GPU addresses are host pointers into the provider's arena
+                    const auto* instances = reinterpret_cast<const InstanceData*>(static_cast<uintptr_t>(instanceBuffer));
+                    for (uint32_t i = 0; i < instanceCount && instancesMatch; ++i, ++itemIndex)
+                    {
+                        instancesMatch = instances && itemIndex < queue->size();
+                        if (instancesMatch)
+                        {
+                            const InstanceData expected = InstanceBatcher::MakeInstanceData((*queue)[itemIndex]);
+                            instancesMatch = std::memcmp(&instances[i], &expected, sizeof(InstanceData)) == 0;
+                        }
+                    }
+                }
+            }
+            instancesMatch = instancesMatch && itemIndex == queue->size();
+        }
+
+        std::cout << "  - Commands: " << stats.commandCount << "  Draws: " << stats.drawCount
+            << "  Instances: " << stats.instanceCount << "  Upload: " << provider.GetUsedBytes() / 1024 << " KB" << std::endl;
+
+        PrintCheck("Streams built", built);
+        PrintCheck("No validation errors", valid && stats.errorCount == 0);
+        PrintCheck("Every item drawn once", stats.instanceCount == ITEM_COUNT);
+        PrintCheck("One draw per instanced batch / non-instanced item", stats.drawCount == expectedDraws);
+        PrintCheck("Instance buffer matches drawn items", instancesMatch);
+        PrintCheck("Each item uploaded once", provider.GetUsedBytes() == expectedUpload);
+        allPassed = allPassed && built && valid && stats.errorCount == 0
+            && stats.instanceCount == ITEM_COUNT && stats.drawCount == expectedDraws && instancesMatch
+            && provider.GetUsedBytes() == expectedUpload;
+    }
+    std::cout << std::endl;
+
+    // Test 2: Redundant bindings are not recorded
+    std::cout << "Test 2: Redundant binding elimination" << std::endl;
+    {
+        bool noRepeats = true;
+        bool psoMatchesSort = true;
+        for (const std::vector<RenderItem>* queue : { &opaque, &transparent })
+        {
+            const RenderCommandStream& stream = queue == &opaque ? opaqueStream : transparentStream;
+
+            const void* lastPso = nullptr;
+            const Mesh* lastMesh = nullptr;
+            uint64_t lastMaterialCb = 0;
+            uint32_t psoCommands = 0;
+            for (const Graphics::RenderCommand& command : stream.GetCommands())
+            {
+                if (command.type == RenderCommandType::SetPipelineState)
+                {
+                    noRepeats = noRepeats && command.pipelineState != lastPso;
+                    lastPso = command.pipelineState;
+                    ++psoCommands;
+                }
+                else if (command.type == RenderCommandType::SetMesh)
+                {
+                    noRepeats = noRepeats && command.setMesh.mesh != lastMesh;
+                    lastMesh = command.setMesh.mesh;
+                }
+                else if (command.type == RenderCommandType::SetConstantBuffer && command.slot == RootSlot::MaterialConstants)
+                {
+                    noRepeats = noRepeats && command.gpuAddress != lastMaterialCb;
+                    lastMaterialCb = command.gpuAddress;
+                }
+            }
+
+            // PSO handles are per pipeline hash, so PSO commands equal the pipeline changes of the queue
+            psoMatchesSort = psoMatchesSort && psoCommands == Graphics::CountStateChanges(*queue).pipelineChanges;
+        }
+
+        PrintCheck("No consecutive duplicate PSO/material/mesh bindings", noRepeats);
+        PrintCheck("PSO commands == pipeline changes", psoMatchesSort);
+        allPassed = allPassed && noRepeats && psoMatchesSort;
+    }
+    std::cout << std::endl;
+
+    // Test 3: Null backend rejects invalid streams
+    std::cout << "Test 3: Null backend validation" << std::endl;
+    {
+        const Mesh* mesh = resources.meshes[0].get();
+        const void* pso = reinterpret_cast<const void*>(uintptr_t{ 0x1001 });
+
+        auto bindAll = [](RenderCommandStream& stream)
+            {
+                stream.SetConstantBuffer(RootSlot::ObjectConstants, 0x1000);
+                stream.SetConstantBuffer(RootSlot::MaterialConstants, 0x2000);
+                stream.SetConstantBuffer(RootSlot::Lighting, 0x3000);
+                stream.SetDescriptorTable(RootSlot::MaterialTextures, 0x4000);
+                stream.SetShaderResource(RootSlot::InstanceBuffer, 0x5000);
+            };
+
+        NullRenderBackend validator;
+        RenderCommandStream stream;
+
+        // Valid reference stream
+        bindAll(stream);
+        stream.SetPipelineState(pso);
+        stream.SetMesh(mesh, MESH_EXTENT);
+        stream.DrawIndexed(MESH_EXTENT.indexCount, 1);
+        const bool acceptsValid = validator.Submit(stream);
+
+        // Draw without PSO
+        stream.Clear();
+        bindAll(stream);
+        stream.SetMesh(mesh, MESH_EXTENT);
+        stream.DrawIndexed(MESH_EXTENT.indexCount, 1);
+        const bool rejectsNoPso = !validator.Submit(stream);
+
+        // Draw with an unbound root parameter
+        stream.Clear();
+        stream.SetPipelineState(pso);
+        stream.SetMesh(mesh, MESH_EXTENT);
+        stream.SetConstantBuffer(RootSlot::Lighting, 0x3000);
+        stream.DrawIndexed(MESH_EXTENT.indexCount, 1);
+        const bool rejectsUnbound = !validator.Submit(stream);
+
+        // Misaligned constant buffer, zero instances, range beyond the mesh
+        stream.Clear();
+        bindAll(stream);
+        stream.SetConstantBuffer(RootSlot::ObjectConstants, 0x1010);
+        stream.SetPipelineState(pso);
+        stream.SetMesh(mesh, MESH_EXTENT);
+        stream.DrawIndexed(MESH_EXTENT.indexCount, 0);
+        stream.DrawIndexed(MESH_EXTENT.indexCount + 3, 1);
+        const uint64_t errorsBefore = validator.GetStats().errorCount;
+        const bool rejectsBadArgs = !validator.Submit(stream) && validator.GetStats().errorCount - errorsBefore == 3;
+
+        // Material without constants: its items are skipped, no null CBV is recorded
+        const Graphics::Material* exhausted = opaque.front().material;
+        ExhaustedConstantsProvider exhaustedProvider(resources, exhausted);
+        exhaustedProvider.BeginFrame(HeadlessResourceProvider::UploadCapacity(opaque.size()));
+        stream.Clear();
+        stream.SetConstantBuffer(RootSlot::Lighting, 0x30000000ull);
+        const bool exhaustedBuilt = builder.Build(opaque, exhaustedProvider, stream);
+
+        bool noNullCbv = true;
+        for (const Graphics::RenderCommand& command : stream.GetCommands())
+        {
+            noNullCbv = noNullCbv && !(command.type == RenderCommandType::SetConstantBuffer && command.gpuAddress == 0);
+        }
+        const uint64_t keptItems = std::count_if(opaque.begin(), opaque.end(), [&](const RenderItem& item)
+            {
+                return item.material != exhausted;
+            });
+        validator.ResetStats();
+        const bool skipsMissingConstants = exhaustedBuilt && noNullCbv && validator.Submit(stream)
+            && validator.GetStats().instanceCount == keptItems;
+
+        PrintCheck("Valid stream accepted", acceptsValid);
+        PrintCheck("Draw without PSO rejected", rejectsNoPso);
+        PrintCheck("Unbound root parameter rejected", rejectsUnbound);
+        PrintCheck("Misaligned CBV / zero instances / bad range rejected", rejectsBadArgs);
+        PrintCheck("Batch without material constants skipped", skipsMissingConstants);
+        allPassed = allPassed && acceptsValid && rejectsNoPso && rejectsUnbound && rejectsBadArgs && skipsMissingConstants;
+    }
+    std::cout << std::endl;
+
+    // Test 4: Command generation throughput
+    std::cout << "Test 4: Command generation (average of " << BUILD_ITERATIONS << " frames)" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    for (uint32_t count : { 1000u, 10000u, 100000u })
+    {
+        std::vector<RenderItem> sceneOpaque;
+        std::vector<RenderItem> sceneTransparent;
+        SplitQueues(BuildSortedItems(resources, count, 9), sceneOpaque, sceneTransparent);
+
+        double buildMs = 0.0;
+        double submitMs = 0.0;
+        bool valid = true;
+        for (int iteration = 0; iteration < BUILD_ITERATIONS; ++iteration)
+        {
+            buildMs += MeasureMs([&]()
+                {
+                    valid = RecordFrame(sceneOpaque, sceneTransparent, builder, provider, opaqueStream, transparentStream) && valid;
+                });
+
+            backend.ResetStats();
+            submitMs += MeasureMs([&]()
+                {
+                    valid = backend.Submit(opaqueStream) && valid;
+                    valid = backend.Submit(transparentStream) && valid;
+                });
+        }
+
+        const uint64_t commands = backend.GetStats().commandCount;
+        const double buildAverage = buildMs / BUILD_ITERATIONS;
+
+        std::cout << "  - " << std::setw(7) << count << " items   build: " << std::setw(8) << buildAverage
+            << " ms   null submit: " << std::setw(8) << submitMs / BUILD_ITERATIONS
+            << " ms   commands: " << std::setw(7) << commands
+            << " (" << std::setw(6) << commands * sizeof(Graphics::RenderCommand) / 1024 << " KB)"
+            << "   " << std::setw(7) << std::setprecision(2) << count / buildAverage / 1000.0 << " M items/s"
+            << std::setprecision(3) << std::endl;
+
+        allPassed = allPassed && valid && backend.GetStats().instanceCount == count;
+    }
+    std::cout << std::endl;
+
+    std::cout << "========================================" << std::endl;
+    std::cout << (allPassed ? "    All tests passed!" : "    Some tests FAILED!") << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return allPassed ? 0 : 1;
+}
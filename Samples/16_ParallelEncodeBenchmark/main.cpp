@@ -0,0 +1,315 @@
+#include "Common/BenchmarkUtils.h"
+#include "Common/HeadlessRenderFixture.h"
+#include "Core/Jobs/JobSystem.h"
+#include "Graphics/Mesh.h"
+#include "Graphics/NullRenderBackend.h"
+#include "Graphics/ParallelCommandEncoder.h"
+#include "Graphics/RenderCommandBuilder.h"
+#include "Graphics/RenderQueue.h"
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+
+using Core::Jobs::JobSystem;
+using Graphics::IRenderResourceProvider;
+using Graphics::Mesh;
+using Graphics::NullRenderBackend;
+using Graphics::ParallelCommandEncoder;
+using Graphics::RenderCommand;
+using Graphics::RenderCommandBuilder;
+using Graphics::RenderCommandStream;
+using Graphics::RenderCommandType;
+using Graphics::RenderItem;
+using Graphics::RenderLayer;
+using Graphics::RenderQueueSorter;
+using Graphics::RootSlot;
+
+// Scene layout
+constexpr uint32_t ITEM_COUNT = 20000;
+constexpr uint32_t BENCHMARK_ITEM_COUNT = 100000;
+
+constexpr int ENCODE_ITERATIONS = 20;
+constexpr uint64_t LIGHTING_CB = 0x30000000ull;
+
+// One provider per chunk, sized for the largest chunk the encoder can produce (1.5x the average)
+class ProviderSet
+{
+public:
+    ProviderSet(const BenchResources& resources, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            mProviders.push_back(std::make_unique<HeadlessResourceProvider>(resources));
+            mPointers.push_back(mProviders.back().get());
+        }
+    }
+
+    std::span<IRenderResourceProvider* const> BeginFrame(size_t itemCount, uint32_t chunkCount)
+    {
+        const size_t maxChunkItems = itemCount / chunkCount * 2 + 1;
+        for (uint32_t i = 0; i < chunkCount; ++i)
+        {
+            mProviders[i]->BeginFrame(HeadlessResourceProvider::UploadCapacity(maxChunkItems));
+        }
+        return std::span<IRenderResourceProvider* const>(mPointers.data(), chunkCount);
+    }
+
+private:
+    std::vector<std::unique_ptr<HeadlessResourceProvider>> mProviders;
+    std::vector<IRenderResourceProvider*> mPointers;
+};
+
+// Builds opaque items with keys computed the same way as RenderSystem, then sorts them
+std::vector<RenderItem> BuildSortedItems(const BenchResources& resources, uint32_t count, uint32_t seed)
+{
+    std::vector<RenderItem> items = BuildItems(resources, count, 0, MakeBenchView(), seed);
+
+    RenderQueueSorter sorter;
+    sorter.Sort(items);
+    return items;
+}
+
+// Draw as seen by the GPU: the state bound at the draw (upload addresses differ per chunk and are excluded)
+struct DrawRecord
+{
+    const void* pso = nullptr;
+    uint64_t materialCb = 0;
+    const Mesh* mesh = nullptr;
+    uint32_t instanceCount = 0;
+
+    bool operator==(const DrawRecord& other) const
+    {
+        return pso == other.pso && materialCb == other.materialCb
+            && mesh == other.mesh && instanceCount == other.instanceCount;
+    }
+};
+
+void CollectDraws(const RenderCommandStream& stream, std::vector<DrawRecord>& draws)
+{
+    DrawRecord state;
+    for (const RenderCommand& command : stream.GetCommands())
+    {
+        switch (command.type)
+        {
+        case RenderCommandType::SetPipelineState:
+            state.pso = command.pipelineState;
+            break;
+        case RenderCommandType::SetConstantBuffer:
+            if (command.slot == RootSlot::MaterialConstants)
+            {
+                state.materialCb = command.gpuAddress;
+            }
+            break;
+        case RenderCommandType::SetMesh:
+            state.mesh = command.setMesh.mesh;
+            break;
+        case RenderCommandType::DrawIndexed:
+            state.instanceCount = command.drawIndexed.instanceCount;
+            draws.push_back(state);
+            break;
+        case RenderCommandType::DrawInstanced:
+            state.instanceCount = command.drawInstanced.instanceCount;
+            draws.push_back(state);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+// Submits every chunk stream in order; each stream must be valid on its own (separate command lists)
+bool SubmitChunks(const ParallelCommandEncoder& encoder, NullRenderBackend& backend)
+{
+    bool valid = true;
+    for (uint32_t i = 0; i < encoder.GetChunkCount(); ++i)
+    {
+        valid = backend.Submit(encoder.GetStream(i)) && valid;
+    }
+    return valid;
+}
+
+int main()
+{
+    std::cout << "========================================" << std::endl;
+    std::cout << "    Parallel Command Encoding Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    BenchResources resources(true);
+    const uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::cout << "Scene:" << std::endl;
+    std::cout << "  - Items: " << ITEM_COUNT << " (benchmark: " << BENCHMARK_ITEM_COUNT << ")" << std::endl;
+    std::cout << "  - Meshes: " << MESH_COUNT << std::endl;
+    std::cout << "  - Materials: " << resources.opaqueMaterials.size() << " (4 opaque pipeline variants, half instanced)" << std::endl;
+    std::cout << "  - Hardware threads: " << hardwareThreads << std::endl;
+    std::cout << std::endl;
+
+    bool allPassed = true;
+    NullRenderBackend backend;
+    ProviderSet providers(resources, std::max(hardwareThreads, 8u));
+
+    RenderCommandStream preamble;
+    preamble.SetConstantBuffer(RootSlot::Lighting, LIGHTING_CB);
+
+    const std::vector<RenderItem> items = BuildSortedItems(resources, ITEM_COUNT, 5);
+
+    // Serial reference: one builder, one stream
+    std::vector<DrawRecord> serialDraws;
+    {
+        RenderCommandBuilder builder;
+        RenderCommandStream stream;
+        stream.Append(preamble);
+        builder.Build(items, *providers.BeginFrame(items.size(), 1).front(), stream);
+        CollectDraws(stream, serialDraws);
+    }
+
+    JobSystem::Create();
+    std::cout << "Worker threads: " << JobSystem::GetInstance().GetWorkerCount() << std::endl;
+    std::cout << std::endl;
+
+    // Test 1: Chunked encoding draws exactly what serial encoding draws, in the same order
+    std::cout << "Test 1: Parallel output matches serial (" << ITEM_COUNT << " items)" << std::endl;
+    {
+        bool matches = true;
+        bool valid = true;
+        bool aligned = true;
+        for (uint32_t chunkCount : { 1u, 2u, 3u, 8u })
+        {
+            ParallelCommandEncoder encoder;
+            const bool encoded = encoder.Encode(items, providers.BeginFrame(items.size(), chunkCount), &preamble);
+
+            backend.ResetStats();
+            valid = encoded && SubmitChunks(encoder, backend) && backend.GetStats().instanceCount == ITEM_COUNT && valid;
+
+            std::vector<DrawRecord> draws;
+            for (uint32_t i = 0; i < encoder.GetChunkCount(); ++i)
+            {
+                CollectDraws(encoder.GetStream(i), draws);
+
+                // Chunk boundaries fall between (mesh, material) runs in this scene
+                const uint32_t first = encoder.GetChunkFirstItem(i);
+                if (first > 0 && first < ITEM_COUNT)
+                {
+                    aligned = aligned && (items[first - 1].mesh != items[first].mesh
+                        || items[first - 1].material != items[first].material);
+                }
+            }
+            matches = matches && draws == serialDraws;
+
+            std::cout << "  - " << chunkCount << " chunks: " << encoder.GetCommandCount() << " commands, "
+                << draws.size() << " draws" << std::endl;
+        }
+
+        PrintCheck("Every chunk stream valid, every item drawn once", valid);
+        PrintCheck("Draw sequence identical to serial", matches);
+        PrintCheck("Chunks split on batch boundaries", aligned);
+        allPassed = allPassed && valid && matches && aligned;
+    }
+    std::cout << std::endl;
+
+    // Test 2: A single huge batch is still split across chunks
+    std::cout << "Test 2: Single batch split" << std::endl;
+    {
+        std::vector<RenderItem> sameItems(ITEM_COUNT);
+        for (RenderItem& item : sameItems)
+        {
+            item.material = resources.opaqueMaterials[0].get();
+            item.mesh = resources.meshes[0].get();
+        }
+
+        constexpr uint32_t chunkCount = 4;
+        ParallelCommandEncoder encoder;
+        const bool encoded = encoder.Encode(sameItems, providers.BeginFrame(sameItems.size(), chunkCount), &preamble);
+
+        backend.ResetStats();
+        const bool valid = encoded && SubmitChunks(encoder, backend);
+
+        bool balanced = true;
+        for (uint32_t i = 0; i < chunkCount; ++i)
+        {
+            balanced = balanced && encoder.GetChunkItemCount(i) == ITEM_COUNT / chunkCount;
+        }
+
+        PrintCheck("Streams valid, every item drawn once", valid && backend.GetStats().instanceCount == ITEM_COUNT);
+        PrintCheck("Work evenly distributed", balanced);
+        PrintCheck("One instanced draw per chunk", backend.GetStats().drawCount == chunkCount);
+        allPassed = allPassed && valid && balanced
+            && backend.GetStats().instanceCount == ITEM_COUNT && backend.GetStats().drawCount == chunkCount;
+    }
+    std::cout << std::endl;
+
+    JobSystem::Destroy();
+
+    // Test 3: Encode throughput against thread count (JobSystem recreated per thread count)
+    std::cout << "Test 3: Encode throughput (" << BENCHMARK_ITEM_COUNT << " items, average of "
+        << ENCODE_ITERATIONS << " frames)" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    {
+        const std::vector<RenderItem> sceneItems = BuildSortedItems(resources, BENCHMARK_ITEM_COUNT, 9);
+
+        std::vector<uint32_t> threadCounts;
+        for (uint32_t threads = 1; threads < hardwareThreads; threads *= 2)
+        {
+            threadCounts.push_back(threads);
+        }
+        threadCounts.push_back(hardwareThreads);
+
+        double baselineMs = 0.0;
+        for (uint32_t threads : threadCounts)
+        {
+            // Serial baseline runs without a JobSystem, like a renderer without worker threads
+            if (threads > 1)
+            {
+                JobSystem::Create(threads - 1);
+            }
+
+            ParallelCommandEncoder encoder;
+            const uint32_t chunkCount = ParallelCommandEncoder::ComputeChunkCount(sceneItems.size());
+
+            double encodeMs = 0.0;
+            bool valid = true;
+            for (int iteration = 0; iteration < ENCODE_ITERATIONS; ++iteration)
+            {
+                auto frameProviders = providers.BeginFrame(sceneItems.size(), chunkCount);
+                encodeMs += MeasureMs([&]()
+                    {
+                        valid = encoder.Encode(sceneItems, frameProviders, &preamble) && valid;
+                    });
+            }
+
+            backend.ResetStats();
+            valid = SubmitChunks(encoder, backend) && backend.GetStats().instanceCount == BENCHMARK_ITEM_COUNT && valid;
+
+            if (threads > 1)
+            {
+                JobSystem::Destroy();
+            }
+
+            const double average = encodeMs / ENCODE_ITERATIONS;
+            if (threads == 1)
+            {
+                baselineMs = average;
+            }
+
+            std::cout << "  - " << std::setw(2) << threads << " threads (" << std::setw(2) << chunkCount << " chunks): "
+                << std::setw(8) << average << " ms   " << std::setw(7) << std::setprecision(2)
+                << BENCHMARK_ITEM_COUNT / average / 1000.0 << " M items/s   x" << baselineMs / average
+                << std::setprecision(3) << (valid ? "" : "   INVALID") << std::endl;
+
+            allPassed = allPassed && valid;
+        }
+    }
+    std::cout << std::endl;
+
+    std::cout << "========================================" << std::endl;
+    std::cout << (allPassed ? "    All tests passed!" : "    Some tests FAILED!") << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return allPassed ? 0 : 1;
+}
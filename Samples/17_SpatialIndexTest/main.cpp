@@ -0,0 +1,596 @@
+#include "Common/BenchmarkUtils.h"
+#include "ECS/Components/BoundsComponent.h"
+#include "ECS/Components/TransformComponent.h"
+#include "ECS/DynamicAABBTree.h"
+#include "ECS/Registry.h"
+#include "ECS/SystemManager.h"
+#include "ECS/Systems/SpatialIndexSystem.h"
+#include "ECS/Systems/TransformSystem.h"
+#include "Math/BoundingVolumes.h"
+#include "Math/MathUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+using ECS::BoundsComponent;
+using ECS::DynamicAABBTree;
+using ECS::Entity;
+using ECS::Registry;
+using ECS::SpatialIndexSystem;
+using ECS::SystemManager;
+using ECS::TransformComponent;
+using ECS::TransformSystem;
+
+// Scene layout
+constexpr uint32_t PROXY_COUNT = 3000;
+constexpr uint32_t ENTITY_COUNT = 5000;
+constexpr float WORLD_EXTENT = 100.0f;
+
+constexpr uint32_t QUERIES_PER_PHASE = 50;
+constexpr uint32_t FRUSTUM_COUNT = 3;               // per multi-frustum query
+constexpr uint32_t NO_HIT = UINT32_MAX;
+
+// One randomized query of every kind
+struct QuerySet
+{
+    Math::AABB box;
+    Math::BoundingSphere sphere;
+    Math::Frustum frustums[FRUSTUM_COUNT];
+    Math::Vector3 rayOrigin;
+    Math::Vector3 rayDirection;
+    float rayMaxDistance = 500.0f;
+};
+
+// Results keyed by proxy user data / entity id, sorted so traversal order does not matter
+struct QueryAnswer
+{
+    std::vector<uint32_t> box;
+    std::vector<uint32_t> sphere;
+    std::vector<uint32_t> frustum;
+    std::vector<std::pair<uint32_t, uint32_t>> masks;
+    uint32_t rayHit = NO_HIT;
+    float rayDistance = 0.0f;
+
+    void Sort()
+    {
+        std::sort(box.begin(), box.end());
+        std::sort(sphere.begin(), sphere.end());
+        std::sort(frustum.begin(), frustum.end());
+        std::sort(masks.begin(), masks.end());
+    }
+};
+
+// Number of queries (out of QUERIES_PER_PHASE) whose answer differs from brute force, per kind
+struct MismatchCounts
+{
+    uint32_t box = 0;
+    uint32_t sphere = 0;
+    uint32_t frustum = 0;
+    uint32_t masks = 0;
+    uint32_t ray = 0;
+
+    bool None() const { return box + sphere + frustum + masks + ray == 0; }
+};
+
+struct ReferenceProxy
+{
+    uint32_t key = 0;
+    Math::AABB bounds;
+};
+
+Math::AABB RandomBox(std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> position(-WORLD_EXTENT, WORLD_EXTENT);
+    std::uniform_real_distribution<float> extent(0.01f, 3.0f);
+
+    Math::AABB box;
+    box.center = Math::Vector3(position(rng), position(rng), position(rng));
+    box.extents = Math::Vector3(extent(rng), extent(rng), extent(rng));
+    return box;
+}
+
+QuerySet RandomQuery(std::mt19937& rng, uint32_t index)
+{
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    QuerySet query;
+    query.box = RandomBox(rng);
+    query.box.extents = query.box.extents * 8.0f;
+    query.sphere.center = query.box.center;
+    query.sphere.radius = 20.0f;
+
+    for (uint32_t i = 0; i < FRUSTUM_COUNT; ++i)
+    {
+        const Math::Vector3 eye(unit(rng) * 50.0f, unit(rng) * 50.0f, unit(rng) * 50.0f);
+        const Math::Vector3 target(unit(rng) * 100.0f, unit(rng) * 100.0f, unit(rng) * 100.0f);
+        const Math::Matrix4x4 view = Math::MatrixLookAtLH(eye, target, Math::Vector3(0.0f, 1.0f, 0.0f));
+        const Math::Matrix4x4 projection = Math::MatrixPerspectiveFovLH(0.8f + i * 0.2f, 1.5f, 0.5f, 60.0f + i * 30.0f);
+        query.frustums[i] = Math::ExtractFrustum(view * projection);
+    }
+
+    query.rayOrigin = Math::Vector3(unit(rng) * 120.0f, unit(rng) * 120.0f, unit(rng) * 120.0f);
+    query.rayDirection = Math::Vector3(unit(rng), unit(rng), unit(rng));
+    if (index % 7 == 0)
+    {
+        // Axis-parallel component (infinite inverse direction)
+        query.rayDirection.y = 0.0f;
+    }
+    return query;
+}
+
+QueryAnswer BruteForce(const std::vector<ReferenceProxy>& proxies, const QuerySet& query)
+{
+    const Math::Vector3 inverseDirection(
+        1.0f / query.rayDirection.x, 1.0f / query.rayDirection.y, 1.0f / query.rayDirection.z);
+
+    QueryAnswer answer;
+    answer.rayDistance = query.rayMaxDistance;
+    for (const ReferenceProxy& proxy : proxies)
+    {
+        if (Math::Intersects(proxy.bounds, query.box))
+        {
+            answer.box.push_back(proxy.key);
+        }
+        if (Math::Intersects(proxy.bounds, query.sphere))
+        {
+            answer.sphere.push_back(proxy.key);
+        }
+        if (Math::IntersectsFrustum(query.frustums[0], proxy.bounds))
+        {
+            answer.frustum.push_back(proxy.key);
+        }
+
+        uint32_t mask = 0;
+        for (uint32_t i = 0; i < FRUSTUM_COUNT; ++i)
+        {
+            mask |= Math::IntersectsFrustum(query.frustums[i], proxy.bounds) ? (1u << i) : 0u;
+        }
+        if (mask != 0)
+        {
+            answer.masks.emplace_back(proxy.key, mask);
+        }
+
+        float distance = 0.0f;
+        if (Math::IntersectsRay(proxy.bounds, query.rayOrigin, inverseDirection, query.rayMaxDistance, distance)
+            && (answer.rayHit == NO_HIT || distance < answer.rayDistance))
+        {
+            answer.rayHit = proxy.key;
+            answer.rayDistance = distance;
+        }
+    }
+    answer.Sort();
+    return answer;
+}
+
+QueryAnswer QueryTree(const DynamicAABBTree& tree, const QuerySet& query)
+{
+    QueryAnswer answer;
+    tree.QueryAABB(query.box, [&](uint32_t key) { answer.box.push_back(key); });
+    tree.QuerySphere(query.sphere, [&](uint32_t key) { answer.sphere.push_back(key); });
+    tree.QueryFrustum(query.frustums[0], [&](uint32_t key) { answer.frustum.push_back(key); });
+    tree.QueryFrustums(query.frustums, FRUSTUM_COUNT, [&](uint32_t key, uint32_t mask)
+        {
+            answer.masks.emplace_back(key, mask);
+        });
+
+    // Closest hit, the same way SpatialIndexSystem::RayCast uses the tree
+    answer.rayDistance = query.rayMaxDistance;
+    tree.RayCast(query.rayOrigin, query.rayDirection, query.rayMaxDistance, [&](uint32_t key, float distance)
+        {
+            if (answer.rayHit == NO_HIT || distance < answer.rayDistance)
+            {
+                answer.rayHit = key;
+                answer.rayDistance = distance;
+            }
+            return answer.rayDistance;
+        });
+
+    answer.Sort();
+    return answer;
+}
+
+// Entities are reported by id; a stale handle (destroyed entity) is reported as NO_HIT so it never matches
+uint32_t EntityKey(const Registry& registry, Entity entity)
+{
+    return registry.IsEntityValid(entity) ? entity.id : NO_HIT;
+}
+
+QueryAnswer QuerySystem(const SpatialIndexSystem& system, const Registry& registry, const QuerySet& query)
+{
+    QueryAnswer answer;
+    std::vector<Entity> entities;
+
+    system.QueryBox(query.box, entities);
+    for (Entity entity : entities)
+    {
+        answer.box.push_back(EntityKey(registry, entity));
+    }
+
+    entities.clear();
+    system.QuerySphere(query.sphere, entities);
+    for (Entity entity : entities)
+    {
+        answer.sphere.push_back(EntityKey(registry, entity));
+    }
+
+    entities.clear();
+    system.QueryFrustum(query.frustums[0], entities);
+    for (Entity entity : entities)
+    {
+        answer.frustum.push_back(EntityKey(registry, entity));
+    }
+
+    entities.clear();
+    std::vector<uint32_t> masks;
+    system.QueryFrustums(query.frustums, FRUSTUM_COUNT, entities, masks);
+    for (size_t i = 0; i < entities.size(); ++i)
+    {
+        answer.masks.emplace_back(EntityKey(registry, entities[i]), masks[i]);
+    }
+
+    float distance = 0.0f;
+    const Entity hit = system.RayCast(query.rayOrigin, query.rayDirection, query.rayMaxDistance, &distance);
+    if (hit.IsValid())
+    {
+        answer.rayHit = EntityKey(registry, hit);
+        answer.rayDistance = distance;
+    }
+
+    answer.Sort();
+    return answer;
+}
+
+// Equal hits, or two different boxes entered at exactly the same distance (either is a closest hit)
+bool SameRayHit(const QueryAnswer& a, const QueryAnswer& b)
+{
+    if ((a.rayHit == NO_HIT) != (b.rayHit == NO_HIT))
+    {
+        return false;
+    }
+    return a.rayHit == NO_HIT || a.rayHit == b.rayHit || a.rayDistance == b.rayDistance;
+}
+
+void Compare(const QueryAnswer& expected, const QueryAnswer& actual, MismatchCounts& counts)
+{
+    counts.box += expected.box != actual.box;
+    counts.sphere += expected.sphere != actual.sphere;
+    counts.frustum += expected.frustum != actual.frustum;
+    counts.masks += expected.masks != actual.masks;
+    counts.ray += !SameRayHit(expected, actual);
+}
+
+bool ReportPhase(const char* phase, uint32_t proxyCount, const MismatchCounts& counts)
+{
+    std::cout << "  " << std::left << std::setw(28) << phase << std::right
+        << "proxies: " << std::setw(5) << proxyCount << std::endl;
+    PrintCheck("AABB / sphere / frustum / multi-frustum / ray match brute force", counts.None());
+    if (!counts.None())
+    {
+        std::cout << "    mismatched queries  AABB: " << counts.box << "  Sphere: " << counts.sphere
+            << "  Frustum: " << counts.frustum << "  Masks: " << counts.masks << "  Ray: " << counts.ray << std::endl;
+    }
+    return counts.None();
+}
+
+//=============================================================================
+// Test 1: DynamicAABBTree
+//=============================================================================
+
+struct TreeScene
+{
+    DynamicAABBTree tree{ 0.2f };
+    std::vector<uint32_t> proxies;      // index -> proxy id (INVALID_PROXY = destroyed)
+    std::vector<Math::AABB> boxes;
+    std::mt19937 rng{ 3 };
+
+    std::vector<ReferenceProxy> Reference() const
+    {
+        std::vector<ReferenceProxy> reference;
+        for (uint32_t i = 0; i < proxies.size(); ++i)
+        {
+            if (proxies[i] != DynamicAABBTree::INVALID_PROXY)
+            {
+                reference.push_back({ i, boxes[i] });
+            }
+        }
+        return reference;
+    }
+
+    bool Check(const char* phase)
+    {
+        tree.Validate();
+
+        const std::vector<ReferenceProxy> reference = Reference();
+        MismatchCounts counts;
+        for (uint32_t i = 0; i < QUERIES_PER_PHASE; ++i)
+        {
+            const QuerySet query = RandomQuery(rng, i);
+            Compare(BruteForce(reference, query), QueryTree(tree, query), counts);
+        }
+        return ReportPhase(phase, static_cast<uint32_t>(reference.size()), counts);
+    }
+};
+
+bool RunTreeTest()
+{
+    std::cout << "Test 1: DynamicAABBTree vs brute force (" << QUERIES_PER_PHASE << " queries per phase)" << std::endl;
+
+    TreeScene scene;
+    bool passed = true;
+
+    for (uint32_t i = 0; i < PROXY_COUNT; ++i)
+    {
+        scene.boxes.push_back(RandomBox(scene.rng));
+        scene.proxies.push_back(scene.tree.CreateProxy(scene.boxes[i], i));
+    }
+    passed = scene.Check("Incremental insert") && passed;
+
+    scene.tree.Rebuild();
+    passed = scene.Check("After Rebuild") && passed;
+
+    // Small moves stay inside the fat bounds, larger accumulated drift reinserts leaves
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    uint32_t reinserted = 0;
+    for (int step = 0; step < 20; ++step)
+    {
+        for (uint32_t i = 0; i < PROXY_COUNT; ++i)
+        {
+            scene.boxes[i].center += Math::Vector3(unit(scene.rng), unit(scene.rng), unit(scene.rng)) * 0.3f;
+            reinserted += scene.tree.MoveProxy(scene.proxies[i], scene.boxes[i]) ? 1 : 0;
+        }
+    }
+    passed = scene.Check("After 20 move steps") && passed;
+    std::cout << "    leaves reinserted: " << reinserted << std::endl;
+
+    for (uint32_t i = 0; i < PROXY_COUNT; i += 3)
+    {
+        scene.tree.DestroyProxy(scene.proxies[i]);
+        scene.proxies[i] = DynamicAABBTree::INVALID_PROXY;
+    }
+    passed = scene.Check("After destroying 1/3") && passed;
+
+    // Freed proxy ids are reused
+    for (uint32_t i = 0; i < PROXY_COUNT; i += 6)
+    {
+        scene.boxes[i] = RandomBox(scene.rng);
+        scene.proxies[i] = scene.tree.CreateProxy(scene.boxes[i], i);
+    }
+    passed = scene.Check("After reusing freed proxies") && passed;
+
+    scene.tree.Rebuild();
+    passed = scene.Check("After second Rebuild") && passed;
+
+    std::cout << "    height: " << scene.tree.GetHeight() << "  area ratio: " << std::fixed << std::setprecision(2)
+        << scene.tree.GetAreaRatio() << std::endl;
+    std::cout << std::endl;
+    return passed;
+}
+
+//=============================================================================
+// Test 2: SpatialIndexSystem (Transform -> SpatialIndex)
+//=============================================================================
+
+struct SystemScene
+{
+    Registry registry;
+    SystemManager systemManager{ registry };
+    TransformSystem* transformSystem = nullptr;
+    SpatialIndexSystem* spatialIndex = nullptr;
+    std::vector<Entity> entities;
+    std::mt19937 rng{ 5 };
+
+    SystemScene()
+    {
+        transformSystem = systemManager.RegisterSystem<TransformSystem>();
+        spatialIndex = systemManager.RegisterSystem<SpatialIndexSystem>();
+    }
+
+    ~SystemScene()
+    {
+        systemManager.ShutdownAllSystems();
+    }
+
+    void CreateEntity(bool withBounds)
+    {
+        std::uniform_real_distribution<float> position(-WORLD_EXTENT * 0.5f, WORLD_EXTENT * 0.5f);
+        std::uniform_real_distribution<float> extent(0.2f, 2.0f);
+
+        Entity entity = registry.CreateEntity();
+        TransformComponent transform;
+        transform.position = Math::Vector3(position(rng), position(rng), position(rng));
+        registry.AddComponent(entity, transform);
+
+        if (withBounds)
+        {
+            BoundsComponent bounds;
+            bounds.localBounds.extents = Math::Vector3(extent(rng), extent(rng), extent(rng));
+            bounds.localSphere.radius = bounds.localBounds.extents.Length();
+            registry.AddComponent(entity, bounds);
+        }
+        entities.push_back(entity);
+    }
+
+    Entity PickAlive()
+    {
+        std::uniform_int_distribution<size_t> pick(0, entities.size() - 1);
+        for (;;)
+        {
+            const Entity entity = entities[pick(rng)];
+            if (registry.IsEntityValid(entity))
+            {
+                return entity;
+            }
+        }
+    }
+
+    std::vector<ReferenceProxy> Reference() const
+    {
+        std::vector<ReferenceProxy> reference;
+        for (Entity entity : entities)
+        {
+            // Only Transform + Bounds entities are indexed
+            if (!registry.IsEntityValid(entity) || !registry.HasComponent<TransformComponent>(entity))
+            {
+                continue;
+            }
+            if (const BoundsComponent* bounds = registry.GetComponent<BoundsComponent>(entity))
+            {
+                reference.push_back({ entity.id, bounds->worldBounds });
+            }
+        }
+        return reference;
+    }
+
+    bool Check(const char* phase)
+    {
+        spatialIndex->GetTree().Validate();
+
+        const std::vector<ReferenceProxy> reference = Reference();
+        MismatchCounts counts;
+        for (uint32_t i = 0; i < QUERIES_PER_PHASE; ++i)
+        {
+            const QuerySet query = RandomQuery(rng, i);
+            Compare(BruteForce(reference, query), QuerySystem(*spatialIndex, registry, query), counts);
+        }
+
+        const bool countMatches = spatialIndex->GetTree().GetProxyCount() == reference.size();
+        const bool passed = ReportPhase(phase, static_cast<uint32_t>(reference.size()), counts);
+        PrintCheck("One proxy per entity with transform and bounds", countMatches);
+        return passed && countMatches;
+    }
+};
+
+bool RunSystemTest()
+{
+    std::cout << "Test 2: SpatialIndexSystem vs brute force (" << QUERIES_PER_PHASE << " queries per phase)" << std::endl;
+
+    SystemScene scene;
+    bool passed = true;
+
+    // 3 of 4 entities have bounds (the rest must never be reported)
+    for (uint32_t i = 0; i < ENTITY_COUNT; ++i)
+    {
+        scene.CreateEntity(i % 4 != 0);
+    }
+    scene.systemManager.UpdateSystems(0.016f);
+    passed = scene.Check("Initial") && passed;
+
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    for (int frame = 0; frame < 30; ++frame)
+    {
+        for (int i = 0; i < 500; ++i)
+        {
+            scene.transformSystem->Translate(scene.PickAlive(),
+                Math::Vector3(unit(scene.rng), unit(scene.rng), unit(scene.rng)) * 2.0f);
+        }
+        scene.systemManager.UpdateSystems(0.016f);
+    }
+    passed = scene.Check("After 30 moving frames") && passed;
+
+    // Destroyed entities and removed bounds leave the index, new entities reuse ids
+    for (int i = 0; i < 300; ++i)
+    {
+        scene.registry.DestroyEntity(scene.PickAlive());
+    }
+    for (int i = 0; i < 200; ++i)
+    {
+        const Entity entity = scene.PickAlive();
+        if (scene.registry.HasComponent<BoundsComponent>(entity))
+        {
+            scene.registry.RemoveComponent<BoundsComponent>(entity);
+        }
+    }
+    for (int i = 0; i < 400; ++i)
+    {
+        scene.CreateEntity(true);
+    }
+    scene.systemManager.UpdateSystems(0.016f);
+    passed = scene.Check("After destroy/remove/create") && passed;
+
+    // Losing TransformComponent drops the entity from the index even though it keeps its bounds
+    std::vector<Entity> untransformed;
+    for (int i = 0; i < 200; ++i)
+    {
+        const Entity entity = scene.PickAlive();
+        if (scene.registry.HasComponent<TransformComponent>(entity) && scene.registry.HasComponent<BoundsComponent>(entity))
+        {
+            scene.registry.RemoveComponent<TransformComponent>(entity);
+            untransformed.push_back(entity);
+        }
+    }
+    scene.systemManager.UpdateSystems(0.016f);
+    passed = scene.Check("After Transform removal") && passed;
+
+    // Adding it back (at a new position) indexes the entity again
+    for (Entity entity : untransformed)
+    {
+        TransformComponent transform;
+        transform.position = Math::Vector3(unit(scene.rng), unit(scene.rng), unit(scene.rng)) * WORLD_EXTENT * 0.5f;
+        scene.registry.AddComponent(entity, transform);
+    }
+    scene.systemManager.UpdateSystems(0.016f);
+    passed = scene.Check("After Transform re-added") && passed;
+
+    std::cout << "    rebuilds: " << scene.spatialIndex->GetRebuildCount() << "  height: " << scene.spatialIndex->GetTree().GetHeight()
+        << "  area ratio: " << std::fixed << std::setprecision(2) << scene.spatialIndex->GetTree().GetAreaRatio() << std::endl;
+    std::cout << std::endl;
+    return passed;
+}
+
+//=============================================================================
+// Test 3: Degenerate input
+//=============================================================================
+
+bool RunDegenerateTest()
+{
+    std::cout << "Test 3: Degenerate input" << std::endl;
+
+    DynamicAABBTree tree;
+    Math::AABB same;
+    same.center = Math::Vector3(1.0f, 1.0f, 1.0f);
+    same.extents = Math::Vector3(1.0f, 1.0f, 1.0f);
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        tree.CreateProxy(same, i);
+    }
+    tree.Rebuild();
+    tree.Validate();
+
+    uint32_t found = 0;
+    tree.QueryAABB(same, [&](uint32_t) { ++found; });
+    const bool identicalPassed = found == 100;
+    PrintCheck("100 identical boxes found after Rebuild", identicalPassed);
+
+    tree.Clear();
+    tree.Rebuild();
+    found = 0;
+    tree.QueryAABB(same, [&](uint32_t) { ++found; });
+    const bool emptyPassed = found == 0 && tree.GetProxyCount() == 0;
+    PrintCheck("Empty after Clear + Rebuild", emptyPassed);
+
+    std::cout << std::endl;
+    return identicalPassed && emptyPassed;
+}
+
+int main()
+{
+    std::cout << "========================================" << std::endl;
+    std::cout << "    Spatial Index Test" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    bool passed = RunTreeTest();
+    passed = RunSystemTest() && passed;
+    passed = RunDegenerateTest() && passed;
+
+    std::cout << "========================================" << std::endl;
+    std::cout << (passed ? "    All tests passed!" : "    Some tests FAILED!") << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include <chrono>
+#include <iostream>
+
+// Shared helpers for the console benchmark/test samples
+
+// Wall-clock time of a single call in milliseconds
+template<typename Func>
+double MeasureMs(Func&& func)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    func();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+inline void PrintCheck(const char* name, bool passed)
+{
+    std::cout << "  - " << name << ": " << (passed ? "PASS" : "FAIL") << std::endl;
+}
@@ -0,0 +1,209 @@
+#pragma once
+#include "Graphics/Material.h"
+#include "Graphics/Mesh.h"
+#include "Graphics/RenderCommandBuilder.h"
+#include "Graphics/RenderQueue.h"
+#include "Math/MathUtils.h"
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+// Shared scene and resource provider for the headless render samples (no device, no window)
+
+// Scene layout
+constexpr uint32_t MESH_COUNT = 24;
+constexpr uint32_t MATERIALS_PER_PIPELINE = 12;     // 5 pipeline variants x 12 = 60 materials
+
+// Extent reported for every headless mesh (a cube)
+constexpr Graphics::MeshExtent MESH_EXTENT = { 24, 36 };
+
+// Headless resources: materials and meshes are never uploaded, only their addresses/hashes are used
+struct BenchResources
+{
+    std::vector<std::unique_ptr<Graphics::Material>> opaqueMaterials;
+    std::vector<std::unique_ptr<Graphics::Material>> transparentMaterials;
+    std::vector<std::unique_ptr<Graphics::Mesh>> meshes;
+
+    // Opaque materials first, then transparent ones.
+    // Read-only after construction, so providers on different threads can share it
+    std::unordered_map<const Graphics::Material*, uint64_t> materialIndices;
+
+    // instancing: every other material is instanced
+    explicit BenchResources(bool instancing = false)
+    {
+        // 4 opaque pipeline variants + 1 alpha blended variant
+        // (variants differ in API-independent fields: pixel shader and depth test)
+        Graphics::MaterialDesc lit;
+        Graphics::MaterialDesc unlit;
+        unlit.pixelShaderPath = L"UnlitShader.hlsl";
+        Graphics::MaterialDesc overlay;
+        overlay.depthTestEnabled = false;
+        Graphics::MaterialDesc unlitOverlay = unlit;
+        unlitOverlay.depthTestEnabled = false;
+        Graphics::MaterialDesc blended;
+        blended.blendMode = Graphics::BlendMode::AlphaBlend;
+        blended.depthWriteEnabled = false;
+
+        for (Graphics::MaterialDesc* desc : { &lit, &unlit, &overlay, &unlitOverlay, &blended })
+        {
+            for (uint32_t i = 0; i < MATERIALS_PER_PIPELINE; ++i)
+            {
+                desc->instancing = instancing && (i % 2) == 0;
+                auto& materials = desc == &blended ? transparentMaterials : opaqueMaterials;
+                materials.push_back(std::make_unique<Graphics::Material>(*desc));
+                materialIndices[materials.back().get()] = materialIndices.size();
+            }
+        }
+        for (uint32_t i = 0; i < MESH_COUNT; ++i)
+        {
+            meshes.push_back(std::make_unique<Graphics::Mesh>());
+        }
+    }
+
+    size_t GetMaterialCount() const { return opaqueMaterials.size() + transparentMaterials.size(); }
+};
+
+// Camera at the origin looking down +Z
+inline Math::Matrix4x4 MakeBenchView()
+{
+    return Math::MatrixLookAtLH(
+        Math::Vector3(0.0f, 0.0f, 0.0f),
+        Math::Vector3(0.0f, 0.0f, 1.0f),
+        Math::Vector3(0.0f, 1.0f, 0.0f)
+    );
+}
+
+inline float ViewDepth(const Graphics::RenderItem& item, const Math::Matrix4x4& view)
+{
+    return item.worldMatrix.m[3][0] * view.m[0][2]
+        + item.worldMatrix.m[3][1] * view.m[1][2]
+        + item.worldMatrix.m[3][2] * view.m[2][2]
+        + view.m[3][2];
+}
+
+// Builds items in "view iteration" order (unsorted) with keys computed the same way as RenderSystem
+inline std::vector<Graphics::RenderItem> BuildItems(
+    const BenchResources& resources,
+    uint32_t count,
+    uint32_t transparentPercent,
+    const Math::Matrix4x4& view,
+    uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::uniform_int_distribution<uint32_t> percent(0, 99);
+
+    std::vector<Graphics::RenderItem> items(count);
+    for (Graphics::RenderItem& item : items)
+    {
+        const bool transparent = percent(rng) < transparentPercent;
+        const auto& materials = transparent ? resources.transparentMaterials : resources.opaqueMaterials;
+        const uint32_t meshIndex = rng() % MESH_COUNT;
+
+        item.material = materials[rng() % static_cast<uint32_t>(materials.size())].get();
+        item.mesh = resources.meshes[meshIndex].get();
+        item.worldMatrix = Math::MatrixTranslation(position(rng), position(rng), position(rng) + 150.0f);
+
+        // Resource ids stand in for ResourceId::id (path hashes)
+        const uint64_t materialId = resources.materialIndices.at(item.material);
+        const uint64_t meshId = meshIndex;
+        const float viewDepth = ViewDepth(item, view);
+
+        item.sortKey = transparent
+            ? Graphics::MakeTransparentSortKey(Graphics::RenderLayer::Transparent, item.material->GetHash(), materialId, meshId, viewDepth)
+            : Graphics::MakeOpaqueSortKey(Graphics::RenderLayer::Opaque, item.material->GetHash(), materialId, meshId, viewDepth);
+    }
+    return items;
+}
+
+// Stands in for one DX12Renderer encode context: fake PSO handles and GPU addresses,
+// upload memory from a host arena owned by this provider only.
+// Reports MESH_EXTENT for every mesh, so draws are recorded as DrawIndexed.
+class HeadlessResourceProvider : public Graphics::IRenderResourceProvider
+{
+public:
+    static constexpr uint64_t MATERIAL_CB_BASE = 0x10000000ull;
+    static constexpr uint64_t DESCRIPTOR_TABLE_BASE = 0x20000000ull;
+
+    // Upper bound of upload memory for a queue: instance buffer + one b0 slot per item
+    static size_t UploadCapacity(size_t itemCount)
+    {
+        return itemCount * (sizeof(Graphics::InstanceData) + ALIGNMENT) + ALIGNMENT;
+    }
+
+    explicit HeadlessResourceProvider(const BenchResources& resources)
+        : mResources(&resources)
+    {
+    }
+
+    // Upload memory is reset every frame, like DX12UploadAllocator
+    void BeginFrame(size_t capacity)
+    {
+        if (mArena.size() < capacity + ALIGNMENT)
+        {
+            mArena.assign(capacity + ALIGNMENT, 0);
+        }
+        mOffset = 0;
+        mCapacity = capacity;
+    }
+
+    const void* GetPipelineState(const Graphics::Material& material, const Graphics::Mesh&) override
+    {
+        // One handle per pipeline hash (the PSO cache key)
+        return reinterpret_cast<const void*>(static_cast<uintptr_t>(material.GetHash() | 1));
+    }
+
+    bool SupportsInstancing(const Graphics::Material& material) override
+    {
+        return material.SupportsInstancing();
+    }
+
+    Graphics::MeshExtent GetMeshExtent(const Graphics::Mesh&) override
+    {
+        return MESH_EXTENT;
+    }
+
+    uint64_t GetMaterialConstants(const Graphics::Material& material) override
+    {
+        return MATERIAL_CB_BASE + mResources->materialIndices.at(&material) * ALIGNMENT;
+    }
+
+    uint64_t GetMaterialDescriptorTable(const Graphics::Material& material) override
+    {
+        return DESCRIPTOR_TABLE_BASE + mResources->materialIndices.at(&material) * 7 * 32;
+    }
+
+    Graphics::UploadRegion AllocateUpload(size_t size) override
+    {
+        Graphics::UploadRegion region;
+        if (mOffset + size > mCapacity)
+        {
+            return region;
+        }
+
+        // Arena base is aligned so CPU and GPU addresses share the same 256-byte alignment
+        uint8_t* base = AlignedBase();
+        region.cpuAddress = base + mOffset;
+        region.gpuAddress = reinterpret_cast<uintptr_t>(base + mOffset);
+        mOffset = (mOffset + size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+        return region;
+    }
+
+    size_t GetUsedBytes() const { return mOffset; }
+
+private:
+    static constexpr size_t ALIGNMENT = 256;
+
+    uint8_t* AlignedBase()
+    {
+        const uintptr_t raw = reinterpret_cast<uintptr_t>(mArena.data());
+        return mArena.data() + (((raw + ALIGNMENT - 1) & ~(ALIGNMENT - 1)) - raw);
+    }
+
+    const BenchResources* mResources;
+    std::vector<uint8_t> mArena;
+    size_t mOffset = 0;
+    size_t mCapacity = 0;
+};